@@ -1,4 +1,9 @@
-find_package(CUDAToolkit REQUIRED)
+# The Thrust benchmarks for the host systems build without a CUDA toolkit.
+if (THRUST_ENABLE_HOST_BENCHMARKS)
+  find_package(CUDAToolkit QUIET)
+else()
+  find_package(CUDAToolkit REQUIRED)
+endif()
 
 set(cccl_revision "")
 find_package(Git)
@@ -36,6 +41,9 @@ function(create_benchmark_registry)
   get_meta_path(meta_path)
 
   set(ctk_version "${CUDAToolkit_VERSION}")
+  if ("${ctk_version}" STREQUAL "")
+    set(ctk_version "none")
+  endif()
   message(STATUS "CTK version: ${ctk_version}")
 
   file(REMOVE "${meta_path}")
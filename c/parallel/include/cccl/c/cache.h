@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA Core Compute Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#ifndef CCCL_C_EXPERIMENTAL
+#  error "C exposure is experimental and subject to change. Define CCCL_C_EXPERIMENTAL to acknowledge this notice."
+#endif // !CCCL_C_EXPERIMENTAL
+
+#include <cuda.h>
+
+#include <cccl/c/types.h>
+
+// The cccl_device_*_build functions look up their cubins in a cache before they run NVRTC and nvJitLink. The cache is
+// addressed by the generated source, the compile and link options, the LTO-IRs of the operations and iterators, the
+// target architecture and the CCCL version. It keeps the most recently used cubins of the process in memory and, if a
+// cache directory is set, shares them with other processes through files in that directory. The directory defaults to
+// the CCCL_C_PARALLEL_CACHE_DIR environment variable.
+
+struct cccl_build_cache_stats_t
+{
+  unsigned long long memory_hits;
+  unsigned long long disk_hits;
+  unsigned long long misses;
+};
+
+// Sets the cache directory, which is created on the first write. nullptr or "" disables the directory.
+extern "C" CCCL_C_API CUresult cccl_build_cache_set_directory(const char* path) noexcept;
+
+// Sets the number of cubins kept in memory. 0 disables the in-memory cache.
+extern "C" CCCL_C_API CUresult cccl_build_cache_set_capacity(size_t max_entries) noexcept;
+
+extern "C" CCCL_C_API CUresult cccl_build_cache_get_stats(cccl_build_cache_stats_t* stats) noexcept;
+
+// Drops the cubins kept in memory and resets the counters. The cache directory is left alone.
+extern "C" CCCL_C_API CUresult cccl_build_cache_clear() noexcept;
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cccl/c/cache.h>
+#include <util/cubin_cache.h>
+
+extern "C" CCCL_C_API CUresult cccl_build_cache_set_directory(const char* path) noexcept
+{
+  try
+  {
+    cubin_cache::instance().set_directory(path == nullptr ? std::string{} : std::string{path});
+  }
+  catch (...)
+  {
+    return CUDA_ERROR_UNKNOWN;
+  }
+
+  return CUDA_SUCCESS;
+}
+
+extern "C" CCCL_C_API CUresult cccl_build_cache_set_capacity(size_t max_entries) noexcept
+{
+  try
+  {
+    cubin_cache::instance().set_capacity(max_entries);
+  }
+  catch (...)
+  {
+    return CUDA_ERROR_UNKNOWN;
+  }
+
+  return CUDA_SUCCESS;
+}
+
+extern "C" CCCL_C_API CUresult cccl_build_cache_get_stats(cccl_build_cache_stats_t* stats) noexcept
+{
+  if (stats == nullptr)
+  {
+    return CUDA_ERROR_INVALID_VALUE;
+  }
+
+  try
+  {
+    const cubin_cache_stats result = cubin_cache::instance().stats();
+
+    stats->memory_hits = result.memory_hits;
+    stats->disk_hits   = result.disk_hits;
+    stats->misses      = result.misses;
+  }
+  catch (...)
+  {
+    return CUDA_ERROR_UNKNOWN;
+  }
+
+  return CUDA_SUCCESS;
+}
+
+extern "C" CCCL_C_API CUresult cccl_build_cache_clear() noexcept
+{
+  try
+  {
+    cubin_cache::instance().clear();
+  }
+  catch (...)
+  {
+    return CUDA_ERROR_UNKNOWN;
+  }
+
+  return CUDA_SUCCESS;
+}
@@ -20,6 +20,7 @@
 #include <for/for_op_helper.h>
 #include <nvrtc/command_list.h>
 #include <util/context.h>
+#include <util/cubin_cache.h>
 #include <util/errors.h>
 #include <util/types.h>
 
@@ -100,36 +101,56 @@ extern "C" CCCL_C_API CUresult cccl_device_for_build(
     constexpr size_t num_lto_args   = 2;
     const char* lopts[num_lto_args] = {"-lto", arch.c_str()};
 
-    std::string lowered_name;
-
-    auto cl =
-      make_nvrtc_command_list()
-        .add_program(nvrtc_translation_unit{device_for_kernel, name})
-        .add_expression({for_kernel_name})
-        .compile_program({args, num_args})
-        .get_name({for_kernel_name, lowered_name})
-        .cleanup_program()
-        .add_link({op.ltoir, op.ltoir_size});
-
-    nvrtc_cubin result{};
-
+    cubin_cache_key key;
+    key.add(device_for_kernel)
+      .add(for_kernel_name)
+      .add(args, num_args)
+      .add(lopts, num_lto_args)
+      .add(cc)
+      .add(CCCL_VERSION)
+      .add(op.ltoir, op.ltoir_size);
     if (cccl_iterator_kind_t::iterator == d_data.type)
     {
-      result = cl.add_link({d_data.advance.ltoir, d_data.advance.ltoir_size})
-                 .add_link({d_data.dereference.ltoir, d_data.dereference.ltoir_size})
-                 .finalize_program(num_lto_args, lopts);
-    }
-    else
-    {
-      result = cl.finalize_program(num_lto_args, lopts);
+      key.add(d_data.advance.ltoir, d_data.advance.ltoir_size)
+        .add(d_data.dereference.ltoir, d_data.dereference.ltoir_size);
     }
 
-    cuLibraryLoadData(&build->library, result.cubin.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
-    check(cuLibraryGetKernel(&build->static_kernel, build->library, lowered_name.c_str()));
+    const auto cached = cubin_cache::instance().find_or_build(key, [&] {
+      std::string lowered_name;
+
+      auto cl =
+        make_nvrtc_command_list()
+          .add_program(nvrtc_translation_unit{device_for_kernel, name})
+          .add_expression({for_kernel_name})
+          .compile_program({args, num_args})
+          .get_name({for_kernel_name, lowered_name})
+          .cleanup_program()
+          .add_link({op.ltoir, op.ltoir_size});
+
+      nvrtc_cubin result{};
+
+      if (cccl_iterator_kind_t::iterator == d_data.type)
+      {
+        result = cl.add_link({d_data.advance.ltoir, d_data.advance.ltoir_size})
+                   .add_link({d_data.dereference.ltoir, d_data.dereference.ltoir_size})
+                   .finalize_program(num_lto_args, lopts);
+      }
+      else
+      {
+        result = cl.finalize_program(num_lto_args, lopts);
+      }
+
+      return cubin_cache_entry{{result.cubin.get(), result.cubin.get() + result.size}, {lowered_name}};
+    });
+
+    std::unique_ptr<char[]> cubin = cached->copy_cubin();
+
+    cuLibraryLoadData(&build->library, cubin.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
+    check(cuLibraryGetKernel(&build->static_kernel, build->library, cached->lowered_names[0].c_str()));
 
     build->cc         = cc;
-    build->cubin      = (void*) result.cubin.release();
-    build->cubin_size = result.size;
+    build->cubin      = (void*) cubin.release();
+    build->cubin_size = cached->cubin.size();
   }
   catch (...)
   {
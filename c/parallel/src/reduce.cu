@@ -25,6 +25,7 @@
 #include "kernels/iterators.h"
 #include "kernels/operators.h"
 #include "util/context.h"
+#include "util/cubin_cache.h"
 #include "util/errors.h"
 #include "util/indirect_arg.h"
 #include "util/types.h"
@@ -266,9 +267,6 @@ extern "C" CCCL_C_API CUresult cccl_device_reduce_build(
     std::string single_tile_kernel_name        = get_single_tile_kernel_name(input_it, output_it, op, init, false);
     std::string single_tile_second_kernel_name = get_single_tile_kernel_name(input_it, output_it, op, init, true);
     std::string reduction_kernel_name          = get_device_reduce_kernel_name(op, input_it, init);
-    std::string single_tile_kernel_lowered_name;
-    std::string single_tile_second_kernel_lowered_name;
-    std::string reduction_kernel_lowered_name;
 
     const std::string arch = std::format("-arch=sm_{0}{1}", cc_major, cc_minor);
 
@@ -298,29 +296,54 @@ extern "C" CCCL_C_API CUresult cccl_device_reduce_build(
       ltoir_list_append({output_it.dereference.ltoir, output_it.dereference.ltoir_size});
     }
 
-    nvrtc_cubin result =
-      make_nvrtc_command_list()
-        .add_program(nvrtc_translation_unit{src.c_str(), name})
-        .add_expression({single_tile_kernel_name})
-        .add_expression({single_tile_second_kernel_name})
-        .add_expression({reduction_kernel_name})
-        .compile_program({args, num_args})
-        .get_name({single_tile_kernel_name, single_tile_kernel_lowered_name})
-        .get_name({single_tile_second_kernel_name, single_tile_second_kernel_lowered_name})
-        .get_name({reduction_kernel_name, reduction_kernel_lowered_name})
-        .cleanup_program()
-        .add_link_list(ltoir_list)
-        .finalize_program(num_lto_args, lopts);
-
-    cuLibraryLoadData(&build->library, result.cubin.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
-    check(cuLibraryGetKernel(&build->single_tile_kernel, build->library, single_tile_kernel_lowered_name.c_str()));
-    check(cuLibraryGetKernel(
-      &build->single_tile_second_kernel, build->library, single_tile_second_kernel_lowered_name.c_str()));
-    check(cuLibraryGetKernel(&build->reduction_kernel, build->library, reduction_kernel_lowered_name.c_str()));
+    cubin_cache_key key;
+    key.add(src)
+      .add(single_tile_kernel_name)
+      .add(single_tile_second_kernel_name)
+      .add(reduction_kernel_name)
+      .add(args, num_args)
+      .add(lopts, num_lto_args)
+      .add(cc)
+      .add(CCCL_VERSION);
+    for (const nvrtc_ltoir& lto : ltoir_list)
+    {
+      key.add(lto.ltoir, lto.ltsz);
+    }
+
+    const auto cached = cubin_cache::instance().find_or_build(key, [&] {
+      std::string single_tile_kernel_lowered_name;
+      std::string single_tile_second_kernel_lowered_name;
+      std::string reduction_kernel_lowered_name;
+
+      nvrtc_cubin result =
+        make_nvrtc_command_list()
+          .add_program(nvrtc_translation_unit{src.c_str(), name})
+          .add_expression({single_tile_kernel_name})
+          .add_expression({single_tile_second_kernel_name})
+          .add_expression({reduction_kernel_name})
+          .compile_program({args, num_args})
+          .get_name({single_tile_kernel_name, single_tile_kernel_lowered_name})
+          .get_name({single_tile_second_kernel_name, single_tile_second_kernel_lowered_name})
+          .get_name({reduction_kernel_name, reduction_kernel_lowered_name})
+          .cleanup_program()
+          .add_link_list(ltoir_list)
+          .finalize_program(num_lto_args, lopts);
+
+      return cubin_cache_entry{
+        {result.cubin.get(), result.cubin.get() + result.size},
+        {single_tile_kernel_lowered_name, single_tile_second_kernel_lowered_name, reduction_kernel_lowered_name}};
+    });
+
+    std::unique_ptr<char[]> cubin = cached->copy_cubin();
+
+    cuLibraryLoadData(&build->library, cubin.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
+    check(cuLibraryGetKernel(&build->single_tile_kernel, build->library, cached->lowered_names[0].c_str()));
+    check(cuLibraryGetKernel(&build->single_tile_second_kernel, build->library, cached->lowered_names[1].c_str()));
+    check(cuLibraryGetKernel(&build->reduction_kernel, build->library, cached->lowered_names[2].c_str()));
 
     build->cc               = cc;
-    build->cubin            = (void*) result.cubin.release();
-    build->cubin_size       = result.size;
+    build->cubin            = (void*) cubin.release();
+    build->cubin_size       = cached->cubin.size();
     build->accumulator_size = accum_t.size;
   }
   catch (...)
@@ -0,0 +1,344 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <random>
+
+#include "cubin_cache.h"
+#include "errors.h"
+
+namespace
+{
+
+constexpr char cubin_cache_magic[] = "cccl.c.parallel.cubin.1";
+
+// FNV-1a, run twice with different offset bases for 128 bits
+std::uint64_t fnv1a(std::string_view data, std::uint64_t hash)
+{
+  for (unsigned char c : data)
+  {
+    hash ^= c;
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+void write_size(std::ofstream& out, std::uint64_t size)
+{
+  out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+}
+
+void write_field(std::ofstream& out, std::string_view field)
+{
+  write_size(out, field.size());
+  out.write(field.data(), field.size());
+}
+
+bool read_size(std::ifstream& in, std::uint64_t& size)
+{
+  return static_cast<bool>(in.read(reinterpret_cast<char*>(&size), sizeof(size)));
+}
+
+template <typename Container>
+bool read_field(std::ifstream& in, Container& field)
+{
+  std::uint64_t size{};
+  if (!read_size(in, size) || size > (std::uint64_t{1} << 32))
+  {
+    return false;
+  }
+  field.resize(size);
+  return static_cast<bool>(in.read(field.data(), size));
+}
+
+// The versions of the libraries which build the cubins, queried once
+const std::string& toolchain_version()
+{
+  static const std::string version = [] {
+    int nvrtc_major{};
+    int nvrtc_minor{};
+    check(nvrtcVersion(&nvrtc_major, &nvrtc_minor));
+
+    unsigned int nvjitlink_major{};
+    unsigned int nvjitlink_minor{};
+    check(nvJitLinkVersion(&nvjitlink_major, &nvjitlink_minor));
+
+    return std::format("nvrtc {}.{} nvJitLink {}.{}", nvrtc_major, nvrtc_minor, nvjitlink_major, nvjitlink_minor);
+  }();
+  return version;
+}
+
+} // namespace
+
+cubin_cache_key::cubin_cache_key()
+{
+  add(toolchain_version());
+}
+
+cubin_cache_key& cubin_cache_key::add(std::string_view field)
+{
+  return add(field.data(), field.size());
+}
+
+cubin_cache_key& cubin_cache_key::add(const char* data, std::size_t size)
+{
+  m_material += std::to_string(size);
+  m_material += ':';
+  m_material.append(data, size);
+  return *this;
+}
+
+cubin_cache_key& cubin_cache_key::add(const char** args, std::size_t num_args)
+{
+  add(static_cast<long long>(num_args));
+  for (std::size_t i = 0; i < num_args; ++i)
+  {
+    add(std::string_view{args[i]});
+  }
+  return *this;
+}
+
+cubin_cache_key& cubin_cache_key::add(long long value)
+{
+  return add(std::string_view{std::to_string(value)});
+}
+
+std::string cubin_cache_key::digest() const
+{
+  return std::format(
+    "{:016x}{:016x}", fnv1a(m_material, 0xcbf29ce484222325ull), fnv1a(m_material, 0x6c62272e07bb0142ull));
+}
+
+std::unique_ptr<char[]> cubin_cache_entry::copy_cubin() const
+{
+  std::unique_ptr<char[]> result{new char[cubin.size()]};
+  std::memcpy(result.get(), cubin.data(), cubin.size());
+  return result;
+}
+
+cubin_cache& cubin_cache::instance()
+{
+  static cubin_cache cache;
+  return cache;
+}
+
+cubin_cache::cubin_cache()
+    : m_capacity(128)
+    , m_stats{}
+{
+  if (const char* directory = std::getenv("CCCL_C_PARALLEL_CACHE_DIR"))
+  {
+    m_directory = directory;
+  }
+}
+
+std::shared_ptr<const cubin_cache_entry>
+cubin_cache::find_or_build(const cubin_cache_key& key, const std::function<cubin_cache_entry()>& build)
+{
+  const std::string digest = key.digest();
+
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (entry_ptr entry = find_in_memory(digest, key))
+    {
+      ++m_stats.memory_hits;
+      return entry;
+    }
+
+    directory = m_directory;
+  }
+
+  // the directory and the compiler are slow, don't hold the lock for them
+  if (!directory.empty())
+  {
+    if (entry_ptr entry = load(directory, digest, key))
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ++m_stats.disk_hits;
+      insert_in_memory(digest, key, entry);
+      return entry;
+    }
+  }
+
+  entry_ptr entry = std::make_shared<const cubin_cache_entry>(build());
+
+  if (!directory.empty())
+  {
+    store(directory, digest, key, *entry);
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_stats.misses;
+  insert_in_memory(digest, key, entry);
+  return entry;
+}
+
+void cubin_cache::set_directory(std::string path)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_directory = std::move(path);
+}
+
+void cubin_cache::set_capacity(std::size_t max_entries)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_capacity = max_entries;
+
+  while (m_lru.size() > m_capacity)
+  {
+    m_index.erase(m_lru.back().digest);
+    m_lru.pop_back();
+  }
+}
+
+cubin_cache_stats cubin_cache::stats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+void cubin_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_lru.clear();
+  m_index.clear();
+  m_stats = {};
+}
+
+cubin_cache::entry_ptr cubin_cache::find_in_memory(const std::string& digest, const cubin_cache_key& key)
+{
+  auto it = m_index.find(digest);
+  if (it == m_index.end() || it->second->material != key.material())
+  {
+    return nullptr;
+  }
+
+  // most recently used to the front
+  m_lru.splice(m_lru.begin(), m_lru, it->second);
+  return it->second->entry;
+}
+
+void cubin_cache::insert_in_memory(const std::string& digest, const cubin_cache_key& key, entry_ptr entry)
+{
+  if (m_capacity == 0)
+  {
+    return;
+  }
+
+  auto it = m_index.find(digest);
+  if (it != m_index.end())
+  {
+    m_lru.erase(it->second);
+    m_index.erase(it);
+  }
+
+  m_lru.push_front(node{digest, key.material(), std::move(entry)});
+  m_index[digest] = m_lru.begin();
+
+  if (m_lru.size() > m_capacity)
+  {
+    m_index.erase(m_lru.back().digest);
+    m_lru.pop_back();
+  }
+}
+
+cubin_cache::entry_ptr
+cubin_cache::load(const std::string& directory, const std::string& digest, const cubin_cache_key& key) const
+{
+  std::ifstream in(std::filesystem::path(directory) / (digest + ".cubin"), std::ios::binary);
+  if (!in)
+  {
+    return nullptr;
+  }
+
+  // anything that doesn't look like a complete entry for this very key is a miss
+  std::string magic;
+  std::string material;
+  if (!read_field(in, magic) || magic != cubin_cache_magic || !read_field(in, material) || material != key.material())
+  {
+    return nullptr;
+  }
+
+  cubin_cache_entry entry;
+
+  std::uint64_t num_names{};
+  if (!read_size(in, num_names) || num_names > 64)
+  {
+    return nullptr;
+  }
+  entry.lowered_names.resize(num_names);
+  for (std::string& name : entry.lowered_names)
+  {
+    if (!read_field(in, name))
+    {
+      return nullptr;
+    }
+  }
+
+  if (!read_field(in, entry.cubin))
+  {
+    return nullptr;
+  }
+
+  return std::make_shared<const cubin_cache_entry>(std::move(entry));
+}
+
+void cubin_cache::store(const std::string& directory,
+                        const std::string& digest,
+                        const cubin_cache_key& key,
+                        const cubin_cache_entry& entry) const
+{
+  namespace fs = std::filesystem;
+
+  // a cache that can't be written to only costs the next process a build
+  std::error_code ec;
+  fs::create_directories(directory, ec);
+
+  std::random_device rd;
+  const fs::path final_path = fs::path(directory) / (digest + ".cubin");
+  const fs::path temp_path  = fs::path(directory) / std::format("{}.{:08x}{:08x}.tmp", digest, rd(), rd());
+
+  {
+    std::ofstream out(temp_path, std::ios::binary);
+    if (!out)
+    {
+      return;
+    }
+
+    write_field(out, cubin_cache_magic);
+    write_field(out, key.material());
+    write_size(out, entry.lowered_names.size());
+    for (const std::string& name : entry.lowered_names)
+    {
+      write_field(out, name);
+    }
+    write_field(out, std::string_view{entry.cubin.data(), entry.cubin.size()});
+
+    out.close();
+    if (!out)
+    {
+      fs::remove(temp_path, ec);
+      return;
+    }
+  }
+
+  // rename replaces the target atomically, a concurrent writer of the same key writes the same content
+  fs::rename(temp_path, final_path, ec);
+  if (ec)
+  {
+    fs::remove(temp_path, ec);
+  }
+}
@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Everything that goes into a build: the generated source, the compile and link options, the LTO-IRs of the user
+// operations and iterators, the target architecture and the version of the CCCL headers. The fields are length
+// prefixed, so that no two different builds share the same material.
+class cubin_cache_key
+{
+public:
+  // Starts with the versions of NVRTC and nvJitLink, so that a cache directory outlives a toolkit upgrade
+  cubin_cache_key();
+
+  cubin_cache_key& add(std::string_view field);
+  cubin_cache_key& add(const char* data, std::size_t size);
+  cubin_cache_key& add(const char** args, std::size_t num_args);
+  cubin_cache_key& add(long long value);
+
+  const std::string& material() const
+  {
+    return m_material;
+  }
+
+  // 128 bit hash of the material in hex, used to address the entry
+  std::string digest() const;
+
+private:
+  std::string m_material;
+};
+
+// The result of a build: the linked cubin and the lowered names of the kernels, in the order they were requested
+struct cubin_cache_entry
+{
+  std::vector<char> cubin;
+  std::vector<std::string> lowered_names;
+
+  std::unique_ptr<char[]> copy_cubin() const;
+};
+
+struct cubin_cache_stats
+{
+  unsigned long long memory_hits;
+  unsigned long long disk_hits;
+  unsigned long long misses;
+};
+
+// A process wide cache of built cubins: an in-memory LRU in front of an optional directory that several processes
+// may share. Entries are written to a temporary file first and renamed into place, so that readers only ever see
+// complete entries. Concurrent misses on the same key may build it more than once, with identical results.
+class cubin_cache
+{
+public:
+  static cubin_cache& instance();
+
+  // Returns the entry for key, from memory, from the cache directory or from build(), in that order
+  std::shared_ptr<const cubin_cache_entry>
+  find_or_build(const cubin_cache_key& key, const std::function<cubin_cache_entry()>& build);
+
+  // An empty path disables the cache directory
+  void set_directory(std::string path);
+
+  // The number of entries kept in memory, 0 disables the in-memory cache
+  void set_capacity(std::size_t max_entries);
+
+  cubin_cache_stats stats() const;
+
+  // Drops the in-memory entries and resets the counters, the cache directory is left alone
+  void clear();
+
+private:
+  cubin_cache();
+
+  using entry_ptr = std::shared_ptr<const cubin_cache_entry>;
+
+  struct node
+  {
+    std::string digest;
+    std::string material;
+    entry_ptr entry;
+  };
+
+  entry_ptr find_in_memory(const std::string& digest, const cubin_cache_key& key);
+  void insert_in_memory(const std::string& digest, const cubin_cache_key& key, entry_ptr entry);
+
+  entry_ptr load(const std::string& directory, const std::string& digest, const cubin_cache_key& key) const;
+  void store(const std::string& directory,
+             const std::string& digest,
+             const cubin_cache_key& key,
+             const cubin_cache_entry& entry) const;
+
+  mutable std::mutex m_mutex;
+  std::string m_directory;
+  std::size_t m_capacity;
+  std::list<node> m_lru;
+  std::unordered_map<std::string, std::list<node>::iterator> m_index;
+  cubin_cache_stats m_stats;
+};
@@ -0,0 +1,113 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda_runtime.h>
+
+#include <cccl/c/cache.h>
+
+#include "test_util.h"
+
+static void build_reduce(cccl_iterator_t input, cccl_iterator_t output, cccl_op_t op, cccl_value_t init)
+{
+  cudaDeviceProp deviceProp;
+  cudaGetDeviceProperties(&deviceProp, 0);
+
+  const int cc_major = deviceProp.major;
+  const int cc_minor = deviceProp.minor;
+
+  const char* cub_path        = TEST_CUB_PATH;
+  const char* thrust_path     = TEST_THRUST_PATH;
+  const char* libcudacxx_path = TEST_LIBCUDACXX_PATH;
+  const char* ctk_path        = TEST_CTK_PATH;
+
+  cccl_device_reduce_build_result_t build;
+  REQUIRE(CUDA_SUCCESS
+          == cccl_device_reduce_build(
+            &build, input, output, op, init, cc_major, cc_minor, cub_path, thrust_path, libcudacxx_path, ctk_path));
+
+  const std::size_t num_items = 42;
+  size_t temp_storage_bytes   = 0;
+  REQUIRE(
+    CUDA_SUCCESS == cccl_device_reduce(build, nullptr, &temp_storage_bytes, input, output, num_items, op, init, 0));
+
+  pointer_t<uint8_t> temp_storage(temp_storage_bytes);
+
+  REQUIRE(CUDA_SUCCESS
+          == cccl_device_reduce(build, temp_storage.ptr, &temp_storage_bytes, input, output, num_items, op, init, 0));
+  REQUIRE(CUDA_SUCCESS == cccl_device_reduce_cleanup(&build));
+}
+
+static cccl_build_cache_stats_t get_stats()
+{
+  cccl_build_cache_stats_t stats{};
+  REQUIRE(CUDA_SUCCESS == cccl_build_cache_get_stats(&stats));
+  return stats;
+}
+
+TEST_CASE("Build cache reuses cubins of identical builds", "[cache]")
+{
+  operation_t op                   = make_operation("op", get_reduce_op(get_type_info<int32_t>().type));
+  const std::vector<int32_t> input = generate<int32_t>(42);
+  pointer_t<int32_t> input_ptr(input);
+  pointer_t<int32_t> output_ptr(1);
+  value_t<int32_t> init{int32_t{42}};
+
+  const int32_t expected = std::accumulate(input.begin(), input.end(), init.value);
+
+  REQUIRE(CUDA_SUCCESS == cccl_build_cache_set_directory(nullptr));
+  REQUIRE(CUDA_SUCCESS == cccl_build_cache_clear());
+
+  build_reduce(input_ptr, output_ptr, op, init);
+  REQUIRE(get_stats().misses == 1);
+  REQUIRE(output_ptr[0] == expected);
+
+  build_reduce(input_ptr, output_ptr, op, init);
+  REQUIRE(get_stats().misses == 1);
+  REQUIRE(get_stats().memory_hits == 1);
+  REQUIRE(output_ptr[0] == expected);
+
+  // a different operation is a different build
+  operation_t other_op = make_operation("other_op", get_reduce_op(get_type_info<int32_t>().type, "other_op"));
+  build_reduce(input_ptr, output_ptr, other_op, init);
+  REQUIRE(get_stats().misses == 2);
+  REQUIRE(output_ptr[0] == expected);
+}
+
+TEST_CASE("Build cache shares cubins through the cache directory", "[cache]")
+{
+  const std::filesystem::path directory =
+    std::filesystem::temp_directory_path() / ("cccl_c_parallel_cache_" + std::to_string(std::random_device{}()));
+
+  operation_t op                   = make_operation("op", get_reduce_op(get_type_info<int64_t>().type));
+  const std::vector<int64_t> input = generate<int64_t>(42);
+  pointer_t<int64_t> input_ptr(input);
+  pointer_t<int64_t> output_ptr(1);
+  value_t<int64_t> init{int64_t{42}};
+
+  const int64_t expected = std::accumulate(input.begin(), input.end(), init.value);
+
+  REQUIRE(CUDA_SUCCESS == cccl_build_cache_set_directory(directory.string().c_str()));
+  REQUIRE(CUDA_SUCCESS == cccl_build_cache_clear());
+
+  build_reduce(input_ptr, output_ptr, op, init);
+  REQUIRE(get_stats().misses == 1);
+  REQUIRE(output_ptr[0] == expected);
+
+  // a fresh process only has the directory
+  REQUIRE(CUDA_SUCCESS == cccl_build_cache_clear());
+
+  build_reduce(input_ptr, output_ptr, op, init);
+  REQUIRE(get_stats().misses == 0);
+  REQUIRE(get_stats().disk_hits == 1);
+  REQUIRE(output_ptr[0] == expected);
+
+  REQUIRE(CUDA_SUCCESS == cccl_build_cache_set_directory(nullptr));
+  std::filesystem::remove_all(directory);
+}
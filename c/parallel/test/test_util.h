@@ -156,20 +156,21 @@ cccl_type_info get_type_info()
   return info;
 }
 
-static std::string get_reduce_op(cccl_type_enum t)
+static std::string get_reduce_op(cccl_type_enum t, const std::string& name = "op")
 {
   switch (t)
   {
     case cccl_type_enum::INT8:
-      return "extern \"C\" __device__ char op(char a, char b) { return a + b; }";
+      return "extern \"C\" __device__ char " + name + "(char a, char b) { return a + b; }";
     case cccl_type_enum::INT32:
-      return "extern \"C\" __device__ int op(int a, int b) { return a + b; }";
+      return "extern \"C\" __device__ int " + name + "(int a, int b) { return a + b; }";
     case cccl_type_enum::UINT32:
-      return "extern \"C\" __device__ unsigned int op(unsigned int a, unsigned int b) { return a + b; }";
+      return "extern \"C\" __device__ unsigned int " + name + "(unsigned int a, unsigned int b) { return a + b; }";
     case cccl_type_enum::INT64:
-      return "extern \"C\" __device__ long long op(long long a, long long b) { return a + b; }";
+      return "extern \"C\" __device__ long long " + name + "(long long a, long long b) { return a + b; }";
     case cccl_type_enum::UINT64:
-      return "extern \"C\" __device__ unsigned long long op(unsigned long long a, unsigned long long b) { "
+      return "extern \"C\" __device__ unsigned long long " + name
+           + "(unsigned long long a, unsigned long long b) { "
              " return a + b; "
              "}";
     default:
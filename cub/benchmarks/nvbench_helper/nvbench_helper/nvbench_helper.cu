@@ -1,5 +1,3 @@
-#include <cub/device/device_copy.cuh>
-
 #include <thrust/binary_search.h>
 #include <thrust/count.h>
 #include <thrust/detail/raw_pointer_cast.h>
@@ -15,14 +13,22 @@
 #include <thrust/scan.h>
 #include <thrust/tabulate.h>
 
+#include <cuda/std/bit>
+
 #include <cstdint>
+#include <optional>
 #include <random>
 #include <type_traits>
 
 #include "thrust/device_vector.h"
-#include <curand.h>
 #include <nvbench_helper.cuh>
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#  include <cub/device/device_copy.cuh>
+
+#  include <curand.h>
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+
 namespace
 {
 
@@ -89,6 +95,7 @@ const double* host_generator_t::new_constant(std::size_t num_items, double val)
   return h_distribution;
 }
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 class device_generator_t
 {
 public:
@@ -113,6 +120,10 @@ private:
   curandGenerator_t m_gen;
   thrust::device_vector<double> m_distribution;
 };
+#else // THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+// without a CUDA device, device memory is host memory and the host generator fills it
+using device_generator_t = host_generator_t;
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 
 template <typename T>
 struct random_to_item_t
@@ -138,6 +149,7 @@ struct random_to_item_t
   }
 };
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 const double* device_generator_t::new_uniform_distribution(seed_t seed, std::size_t num_items)
 {
   m_distribution.resize(num_items);
@@ -167,6 +179,7 @@ const double* device_generator_t::new_constant(std::size_t num_items, double val
   thrust::fill_n(thrust::device, d_distribution, num_items, val);
   return d_distribution;
 }
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 
 struct and_t
 {
@@ -178,32 +191,32 @@ struct and_t
 
   __host__ __device__ float operator()(float a, float b) const
   {
-    const std::uint32_t result = reinterpret_cast<std::uint32_t&>(a) & reinterpret_cast<std::uint32_t&>(b);
-    return reinterpret_cast<const float&>(result);
+    const std::uint32_t result = ::cuda::std::bit_cast<std::uint32_t>(a) & ::cuda::std::bit_cast<std::uint32_t>(b);
+    return ::cuda::std::bit_cast<float>(result);
   }
 
   __host__ __device__ double operator()(double a, double b) const
   {
-    const std::uint64_t result = reinterpret_cast<std::uint64_t&>(a) & reinterpret_cast<std::uint64_t&>(b);
-    return reinterpret_cast<const double&>(result);
+    const std::uint64_t result = ::cuda::std::bit_cast<std::uint64_t>(a) & ::cuda::std::bit_cast<std::uint64_t>(b);
+    return ::cuda::std::bit_cast<double>(result);
   }
 
   __host__ __device__ complex operator()(complex a, complex b) const
   {
-    double a_real = a.real();
-    double a_imag = a.imag();
+    const double a_real = a.real();
+    const double a_imag = a.imag();
 
-    double b_real = b.real();
-    double b_imag = b.imag();
+    const double b_real = b.real();
+    const double b_imag = b.imag();
 
     const std::uint64_t result_real =
-      reinterpret_cast<std::uint64_t&>(a_real) & reinterpret_cast<std::uint64_t&>(b_real);
+      ::cuda::std::bit_cast<std::uint64_t>(a_real) & ::cuda::std::bit_cast<std::uint64_t>(b_real);
 
     const std::uint64_t result_imag =
-      reinterpret_cast<std::uint64_t&>(a_imag) & reinterpret_cast<std::uint64_t&>(b_imag);
+      ::cuda::std::bit_cast<std::uint64_t>(a_imag) & ::cuda::std::bit_cast<std::uint64_t>(b_imag);
 
-    return {static_cast<float>(reinterpret_cast<const double&>(result_real)),
-            static_cast<float>(reinterpret_cast<const double&>(result_imag))};
+    return {static_cast<float>(::cuda::std::bit_cast<double>(result_real)),
+            static_cast<float>(::cuda::std::bit_cast<double>(result_imag))};
   }
 };
 
@@ -489,7 +502,8 @@ void generator_t::power_law_segment_offsets(
   const std::size_t total_segments   = device_segment_offsets.size() - 1;
   const double* uniform_distribution = dist.new_lognormal_distribution(seed, total_segments);
 
-  if (thrust::count(exec, uniform_distribution, uniform_distribution + total_segments, 0.0) == total_segments)
+  if (static_cast<std::size_t>(thrust::count(exec, uniform_distribution, uniform_distribution + total_segments, 0.0))
+      == total_segments)
   {
     uniform_distribution = dist.new_constant(total_segments, 1.0);
   }
@@ -576,7 +590,8 @@ struct offset_to_size_t
 };
 
 template <typename T>
-void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda::std::span<std::size_t> segment_offsets)
+void gen_key_segments(
+  executor exec, seed_t /* seed */, cuda::std::span<T> keys, cuda::std::span<std::size_t> segment_offsets)
 {
   thrust::counting_iterator<int> iota(0);
   offset_to_iterator_t<T> dst_transform_op{keys.data()};
@@ -587,6 +602,7 @@ void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda:
   auto d_range_dsts  = thrust::make_transform_iterator(segment_offsets.data(), dst_transform_op);
   auto d_range_sizes = thrust::make_transform_iterator(iota, offset_to_size_t{segment_offsets.data()});
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
   if (exec == executor::device)
   {
     std::uint8_t* d_temp_storage   = nullptr;
@@ -602,6 +618,9 @@ void gen_key_segments(executor exec, seed_t seed, cuda::std::span<T> keys, cuda:
     cudaDeviceSynchronize();
   }
   else
+#else // THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+  (void) exec;
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
   {
     for (std::size_t sid = 0; sid < total_segments; sid++)
     {
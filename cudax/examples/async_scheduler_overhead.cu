@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the cost per task of the host schedulers of the cudax sender/receiver stack:
+//
+//  - task throughput: every task of a binary tree forks its two children onto the scheduler it runs on, the cost is
+//    the wall time until the scheduler drained divided by the number of tasks,
+//  - fork-join: sync_wait on a when_all of eight tasks moved onto the scheduler, the cost is the wall time of one
+//    round trip.
+//
+// thread_context runs everything on a single thread behind a mutex, static_thread_pool spreads the tasks over all
+// cores with per-worker deques and work stealing.
+
+#include <cuda/experimental/__async/async.cuh>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace cudax_async = cuda::experimental::__async;
+
+using steady_clock = std::chrono::steady_clock;
+
+template <class Scheduler>
+struct fork_tree
+{
+  Scheduler sched;
+  std::atomic<long>* tasks;
+  int depth;
+
+  void operator()() const
+  {
+    tasks->fetch_add(1, std::memory_order_relaxed);
+    if (depth == 0)
+    {
+      return;
+    }
+    for (int i = 0; i < 2; ++i)
+    {
+      cudax_async::start_detached(cudax_async::start_on(sched, cudax_async::just()) //
+                                  | cudax_async::then(fork_tree{sched, tasks, depth - 1}));
+    }
+  }
+};
+
+// the context is joined once the tree is done, so every measurement gets a fresh one
+template <class Context>
+double task_throughput_ns(Context& ctx, int depth)
+{
+  std::atomic<long> tasks{0};
+  auto sched = ctx.get_scheduler();
+
+  const steady_clock::time_point start = steady_clock::now();
+  cudax_async::start_detached(cudax_async::start_on(sched, cudax_async::just()) //
+                              | cudax_async::then(fork_tree<decltype(sched)>{sched, &tasks, depth}));
+  ctx.join();
+  const double elapsed = std::chrono::duration<double, std::nano>(steady_clock::now() - start).count();
+
+  return elapsed / static_cast<double>(tasks.load());
+}
+
+template <class Context>
+double fork_join_us(Context& ctx, int rounds)
+{
+  auto sched = ctx.get_scheduler();
+  auto task  = [](int i) {
+    return i + 1;
+  };
+
+  const steady_clock::time_point start = steady_clock::now();
+  for (int r = 0; r < rounds; ++r)
+  {
+    auto snd = cudax_async::when_all(cudax_async::just(0) | cudax_async::continue_on(sched) | cudax_async::then(task),
+                                     cudax_async::just(1) | cudax_async::continue_on(sched) | cudax_async::then(task),
+                                     cudax_async::just(2) | cudax_async::continue_on(sched) | cudax_async::then(task),
+                                     cudax_async::just(3) | cudax_async::continue_on(sched) | cudax_async::then(task),
+                                     cudax_async::just(4) | cudax_async::continue_on(sched) | cudax_async::then(task),
+                                     cudax_async::just(5) | cudax_async::continue_on(sched) | cudax_async::then(task),
+                                     cudax_async::just(6) | cudax_async::continue_on(sched) | cudax_async::then(task),
+                                     cudax_async::just(7) | cudax_async::continue_on(sched) | cudax_async::then(task));
+    cudax_async::sync_wait(std::move(snd));
+  }
+  const double elapsed = std::chrono::duration<double, std::micro>(steady_clock::now() - start).count();
+
+  return elapsed / rounds;
+}
+
+int main()
+{
+  const int depth  = 16;
+  const int rounds = 2000;
+
+  std::printf("%-20s %8s %20s %16s\n", "scheduler", "threads", "throughput(ns/task)", "fork-join(us)");
+
+  {
+    cudax_async::thread_context throughput_ctx;
+    const double throughput = task_throughput_ns(throughput_ctx, depth);
+    cudax_async::thread_context fork_join_ctx;
+    const double fork_join = fork_join_us(fork_join_ctx, rounds);
+    std::printf("%-20s %8u %20.1f %16.2f\n", "thread_context", 1u, throughput, fork_join);
+  }
+
+  {
+    cudax_async::static_thread_pool throughput_pool;
+    const double throughput = task_throughput_ns(throughput_pool, depth);
+    cudax_async::static_thread_pool fork_join_pool;
+    const double fork_join = fork_join_us(fork_join_pool, rounds);
+    std::printf("%-20s %8u %20.1f %16.2f\n",
+                "static_thread_pool",
+                fork_join_pool.available_parallelism(),
+                throughput,
+                fork_join);
+  }
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the bandwidth of cudax::host_copy between mdspans of different layouts, against an element loop in the
+// order of the source indices as user code would write it. The bandwidth counts one read and one write per element.
+//
+// Layout pairs which agree on the fastest dimension are copied in contiguous runs, the others are tiled. The shapes
+// include tall and wide ones, which make the element loop walk one side across a page or more per element.
+
+#include <cuda/experimental/__algorithm/host_copy.cuh>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace cudax = cuda::experimental;
+
+using steady_clock = std::chrono::steady_clock;
+using extents_2d   = cuda::std::dextents<size_t, 2>;
+using extents_3d   = cuda::std::dextents<size_t, 3>;
+
+template <class Src, class Dst>
+void element_loop(Src src, Dst dst)
+{
+  if constexpr (Src::rank() == 2)
+  {
+    for (size_t i = 0; i < src.extent(0); ++i)
+    {
+      for (size_t j = 0; j < src.extent(1); ++j)
+      {
+        dst(i, j) = src(i, j);
+      }
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < src.extent(0); ++i)
+    {
+      for (size_t j = 0; j < src.extent(1); ++j)
+      {
+        for (size_t k = 0; k < src.extent(2); ++k)
+        {
+          dst(i, j, k) = src(i, j, k);
+        }
+      }
+    }
+  }
+}
+
+// the best of a few runs, in GB/s
+template <class Fn>
+double bandwidth(Fn fn, size_t bytes)
+{
+  double best = 0;
+  for (int run = 0; run < 5; ++run)
+  {
+    const steady_clock::time_point start = steady_clock::now();
+    fn();
+    const double elapsed = std::chrono::duration<double>(steady_clock::now() - start).count();
+    best                 = std::max(best, 2.0 * static_cast<double>(bytes) / elapsed / 1e9);
+  }
+  return best;
+}
+
+template <class Extents>
+std::string shape_of(Extents extents)
+{
+  std::string shape;
+  for (size_t r = 0; r < Extents::rank(); ++r)
+  {
+    shape += (r == 0 ? "" : "x") + std::to_string(extents.extent(r));
+  }
+  return shape;
+}
+
+template <class SrcLayout, class DstLayout, class Extents>
+void measure(const char* name, Extents extents, typename SrcLayout::template mapping<Extents> src_mapping)
+{
+  const typename DstLayout::template mapping<Extents> dst_mapping(extents);
+
+  std::vector<float> src_storage(src_mapping.required_span_size(), 1.f);
+  std::vector<float> dst_storage(dst_mapping.required_span_size());
+  cuda::std::mdspan<const float, Extents, SrcLayout> src(src_storage.data(), src_mapping);
+  cuda::std::mdspan<float, Extents, DstLayout> dst(dst_storage.data(), dst_mapping);
+
+  size_t size = 1;
+  for (size_t r = 0; r < Extents::rank(); ++r)
+  {
+    size *= extents.extent(r);
+  }
+
+  const double loop = bandwidth(
+    [&] {
+      element_loop(src, dst);
+    },
+    size * sizeof(float));
+  const double tiled = bandwidth(
+    [&] {
+      cudax::host_copy(src, dst);
+    },
+    size * sizeof(float));
+
+  std::printf("%-16s %-22s %14.2f %14.2f\n", name, shape_of(extents).c_str(), loop, tiled);
+}
+
+template <class Extents>
+void measure_layouts(Extents extents)
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  using cuda::std::layout_stride;
+
+  measure<layout_right, layout_right>("right -> right", extents, layout_right::mapping<Extents>(extents));
+  measure<layout_right, layout_left>("right -> left", extents, layout_right::mapping<Extents>(extents));
+  measure<layout_left, layout_right>("left -> right", extents, layout_left::mapping<Extents>(extents));
+
+  // every other element of the innermost dimension of a layout_right array
+  cuda::std::array<size_t, Extents::rank()> strides{};
+  size_t stride = 2;
+  for (size_t r = Extents::rank(); r > 0; --r)
+  {
+    strides[r - 1] = stride;
+    stride *= extents.extent(r - 1);
+  }
+  measure<layout_stride, layout_right>("strided -> right", extents, layout_stride::mapping<Extents>(extents, strides));
+}
+
+int main()
+{
+  std::printf("%-16s %-22s %14s %14s\n", "layouts", "shape", "loop(GB/s)", "host_copy(GB/s)");
+
+  measure_layouts(extents_2d(4096, 4096));
+  measure_layouts(extents_2d(64, 262144));
+  measure_layouts(extents_2d(262144, 64));
+  measure_layouts(extents_2d(1000, 999));
+  measure_layouts(extents_3d(256, 256, 256));
+  measure_layouts(extents_3d(8, 2048, 1024));
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDASTF in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ * @file
+ *
+ * @brief Convert a trace recorded with CUDASTF_TRACE_FILE into a DOT file and/or a Chrome trace
+ *
+ * Usage: trace_analyzer [trace] [--dot out.dot] [--chrome out.json] [--keep-redundant]
+ *
+ * The trace defaults to the value of CUDASTF_TRACE_FILE, and the DOT file is written to the standard output when no
+ * output is given.
+ */
+
+#include <cuda/experimental/__stf/internal/trace_analyzer.cuh>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace cuda::experimental::stf;
+
+static int usage(const char* prog)
+{
+  fprintf(stderr, "Usage: %s [trace] [--dot out.dot] [--chrome out.json] [--keep-redundant]\n", prog);
+  return 1;
+}
+
+int main(int argc, char** argv)
+{
+  const char* trace_file  = getenv("CUDASTF_TRACE_FILE");
+  const char* dot_file    = nullptr;
+  const char* chrome_file = nullptr;
+  bool keep_redundant     = false;
+
+  for (int i = 1; i < argc; i++)
+  {
+    const bool has_value = i + 1 < argc;
+    if (strcmp(argv[i], "--dot") == 0)
+    {
+      if (!has_value)
+      {
+        return usage(argv[0]);
+      }
+      dot_file = argv[++i];
+    }
+    else if (strcmp(argv[i], "--chrome") == 0)
+    {
+      if (!has_value)
+      {
+        return usage(argv[0]);
+      }
+      chrome_file = argv[++i];
+    }
+    else if (strcmp(argv[i], "--keep-redundant") == 0)
+    {
+      keep_redundant = true;
+    }
+    else if (strncmp(argv[i], "--", 2) == 0)
+    {
+      fprintf(stderr, "Unknown option %s\n", argv[i]);
+      return usage(argv[0]);
+    }
+    else
+    {
+      trace_file = argv[i];
+    }
+  }
+
+  if (!trace_file)
+  {
+    return usage(argv[0]);
+  }
+
+  try
+  {
+    reserved::trace_graph g(trace_file);
+
+    const size_t edge_cnt = g.edge_count();
+    const size_t removed  = keep_redundant ? 0 : g.remove_redundant_edges();
+    fprintf(stderr,
+            "%zu vertices, %zu edges (%zu redundant), T1 = %f ms, Tinf = %f ms\n",
+            g.vertex_count(),
+            edge_cnt,
+            removed,
+            g.total_work(),
+            g.critical_path_length());
+
+    if (dot_file)
+    {
+      ::std::ofstream out(dot_file);
+      g.print_dot(out);
+    }
+
+    if (chrome_file)
+    {
+      ::std::ofstream out(chrome_file);
+      g.print_chrome_trace(out);
+    }
+
+    if (!dot_file && !chrome_file)
+    {
+      g.print_dot(::std::cout);
+    }
+  }
+  catch (const ::std::exception& e)
+  {
+    fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+}
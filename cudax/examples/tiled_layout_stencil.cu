@@ -0,0 +1,139 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures a 5-point stencil on the host over square arrays stored in different layouts, sweeping the interior row by
+// row and column by column. Every point reads its neighbours along both dimensions, so layout_right and layout_left
+// are each fast in one sweep only, while the tiled layouts keep both sweeps within a few tiles.
+
+#include <cuda/experimental/mdspan.cuh>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace cudax = cuda::experimental;
+
+using steady_clock = std::chrono::steady_clock;
+using extents_2d   = cuda::std::dextents<size_t, 2>;
+
+template <class In, class Out>
+void stencil_point(In in, Out out, size_t i, size_t j)
+{
+  out(i, j) = 0.2f * (in(i, j) + in(i - 1, j) + in(i + 1, j) + in(i, j - 1) + in(i, j + 1));
+}
+
+template <class In, class Out>
+void row_sweep(In in, Out out)
+{
+  for (size_t i = 1; i + 1 < in.extent(0); ++i)
+  {
+    for (size_t j = 1; j + 1 < in.extent(1); ++j)
+    {
+      stencil_point(in, out, i, j);
+    }
+  }
+}
+
+template <class In, class Out>
+void column_sweep(In in, Out out)
+{
+  for (size_t j = 1; j + 1 < in.extent(1); ++j)
+  {
+    for (size_t i = 1; i + 1 < in.extent(0); ++i)
+    {
+      stencil_point(in, out, i, j);
+    }
+  }
+}
+
+// visits the interior in square blocks of 64 x 64 points, row by row within a block, as a cache blocked stencil would
+template <class In, class Out>
+void block_sweep(In in, Out out)
+{
+  const size_t block = 64;
+
+  for (size_t i0 = 1; i0 + 1 < in.extent(0); i0 += block)
+  {
+    for (size_t j0 = 1; j0 + 1 < in.extent(1); j0 += block)
+    {
+      for (size_t i = i0; i < std::min(i0 + block, in.extent(0) - 1); ++i)
+      {
+        for (size_t j = j0; j < std::min(j0 + block, in.extent(1) - 1); ++j)
+        {
+          stencil_point(in, out, i, j);
+        }
+      }
+    }
+  }
+}
+
+// the best of a few sweeps, in millions of points per second
+template <class Fn>
+double points_per_second(Fn fn, size_t points)
+{
+  double best = 0;
+  for (int run = 0; run < 3; ++run)
+  {
+    const steady_clock::time_point start = steady_clock::now();
+    fn();
+    const double elapsed = std::chrono::duration<double>(steady_clock::now() - start).count();
+    best                 = std::max(best, static_cast<double>(points) / elapsed / 1e6);
+  }
+  return best;
+}
+
+template <class Layout>
+void measure(const char* name, size_t n)
+{
+  const typename Layout::template mapping<extents_2d> mapping(extents_2d(n, n));
+
+  std::vector<float> in_storage(mapping.required_span_size(), 1.f);
+  std::vector<float> out_storage(mapping.required_span_size());
+  cuda::std::mdspan<const float, extents_2d, Layout> in(in_storage.data(), mapping);
+  cuda::std::mdspan<float, extents_2d, Layout> out(out_storage.data(), mapping);
+
+  const size_t points = (n - 2) * (n - 2);
+
+  const double rows = points_per_second(
+    [&] {
+      row_sweep(in, out);
+    },
+    points);
+  const double columns = points_per_second(
+    [&] {
+      column_sweep(in, out);
+    },
+    points);
+  const double blocks = points_per_second(
+    [&] {
+      block_sweep(in, out);
+    },
+    points);
+
+  std::printf("%-28s %8zu %16.1f %16.1f %16.1f\n", name, n, rows, columns, blocks);
+}
+
+int main()
+{
+  std::printf("%-28s %8s %16s %16s %16s\n", "layout", "n", "rows(Mpts/s)", "columns(Mpts/s)", "blocks(Mpts/s)");
+
+  for (size_t n : {1024, 4096, 8192})
+  {
+    measure<cuda::std::layout_right>("layout_right", n);
+    measure<cuda::std::layout_left>("layout_left", n);
+    measure<cudax::layout_tiled<16, 16>>("layout_tiled<16, 16>", n);
+    measure<cudax::layout_tiled<64, 64>>("layout_tiled<64, 64>", n);
+    measure<cudax::layout_tiled_morton<16, 16>>("layout_tiled_morton<16, 16>", n);
+    measure<cudax::layout_tiled_morton<64, 64>>("layout_tiled_morton<64, 64>", n);
+  }
+
+  return 0;
+}
@@ -0,0 +1,398 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ALGORITHM_HOST_COPY
+#define __CUDAX_ALGORITHM_HOST_COPY
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include <cuda/experimental/__algorithm/copy.cuh>
+
+namespace cuda::experimental
+{
+
+// Edge of the square tiles a transposing copy is blocked into, chosen so that a source and a destination tile
+// together take up about half of a 64 KiB L1 data cache
+template <typename _SrcElem, typename _DstElem>
+inline constexpr _CUDA_VSTD::size_t __host_copy_tile = [] {
+  constexpr _CUDA_VSTD::size_t __elem_size = sizeof(_SrcElem) > sizeof(_DstElem) ? sizeof(_SrcElem) : sizeof(_DstElem);
+  _CUDA_VSTD::size_t __tile                = 8;
+  while ((2 * __tile) * (2 * __tile) <= 16384 / __elem_size)
+  {
+    __tile *= 2;
+  }
+  return __tile;
+}();
+
+// Number of tiles along either edge of the blocks the tiles are visited in, so that the cache lines a block touches
+// fit into L2 and every line is fetched from memory once
+inline constexpr _CUDA_VSTD::size_t __host_copy_tiles_per_block = 4;
+
+struct __host_copy_dim
+{
+  _CUDA_VSTD::size_t __extent;
+  _CUDA_VSTD::size_t __src_stride;
+  _CUDA_VSTD::size_t __dst_stride;
+};
+
+// Copies the __n elements of a run, the unit stride case is split off so that it vectorizes
+template <typename _Src, typename _Dst>
+void __host_copy_run(
+  const _Src& __src,
+  _CUDA_VSTD::size_t __src_offset,
+  _CUDA_VSTD::size_t __src_stride,
+  const _Dst& __dst,
+  _CUDA_VSTD::size_t __dst_offset,
+  _CUDA_VSTD::size_t __dst_stride,
+  _CUDA_VSTD::size_t __n)
+{
+  const auto& __src_acc = __src.accessor();
+  const auto& __dst_acc = __dst.accessor();
+
+  if (__src_stride == 1 && __dst_stride == 1)
+  {
+    for (_CUDA_VSTD::size_t __i = 0; __i < __n; ++__i)
+    {
+      __dst_acc.access(__dst.data_handle(), __dst_offset + __i) =
+        __src_acc.access(__src.data_handle(), __src_offset + __i);
+    }
+  }
+  else
+  {
+    for (_CUDA_VSTD::size_t __i = 0; __i < __n; ++__i)
+    {
+      __dst_acc.access(__dst.data_handle(), __dst_offset + __i * __dst_stride) =
+        __src_acc.access(__src.data_handle(), __src_offset + __i * __src_stride);
+    }
+  }
+}
+
+// Copies the __a.__extent x __b.__extent block of a source whose fastest dimension is __b into a destination whose
+// fastest dimension is __a, one L1 sized tile at a time
+template <typename _Src, typename _Dst>
+void __host_copy_tiled(
+  const _Src& __src,
+  _CUDA_VSTD::size_t __src_offset,
+  const _Dst& __dst,
+  _CUDA_VSTD::size_t __dst_offset,
+  const __host_copy_dim& __a,
+  const __host_copy_dim& __b)
+{
+  constexpr _CUDA_VSTD::size_t __tile  = __host_copy_tile<typename _Src::element_type, typename _Dst::element_type>;
+  constexpr _CUDA_VSTD::size_t __block = __tile * __host_copy_tiles_per_block;
+
+  for (_CUDA_VSTD::size_t __b_block = 0; __b_block < __b.__extent; __b_block += __block)
+  {
+    const _CUDA_VSTD::size_t __b_block_end = _CUDA_VSTD::min(__b_block + __block, __b.__extent);
+
+    for (_CUDA_VSTD::size_t __a_block = 0; __a_block < __a.__extent; __a_block += __block)
+    {
+      const _CUDA_VSTD::size_t __a_block_end = _CUDA_VSTD::min(__a_block + __block, __a.__extent);
+
+      for (_CUDA_VSTD::size_t __b_tile = __b_block; __b_tile < __b_block_end; __b_tile += __tile)
+      {
+        const _CUDA_VSTD::size_t __b_tile_end = _CUDA_VSTD::min(__b_tile + __tile, __b_block_end);
+
+        for (_CUDA_VSTD::size_t __a_tile = __a_block; __a_tile < __a_block_end; __a_tile += __tile)
+        {
+          const _CUDA_VSTD::size_t __a_tile_end = _CUDA_VSTD::min(__a_tile + __tile, __a_block_end);
+
+          // writes are contiguous, reads walk the __tile source lines of the tile which stay in L1
+          for (_CUDA_VSTD::size_t __j = __b_tile; __j < __b_tile_end; ++__j)
+          {
+            __host_copy_run(
+              __src,
+              __src_offset + __a_tile * __a.__src_stride + __j * __b.__src_stride,
+              __a.__src_stride,
+              __dst,
+              __dst_offset + __a_tile * __a.__dst_stride + __j * __b.__dst_stride,
+              __a.__dst_stride,
+              __a_tile_end - __a_tile);
+          }
+        }
+      }
+    }
+  }
+}
+
+// Calls __f with the offsets of every combination of indices of the dimensions [__first, __last), the first one
+// fastest
+template <typename _Fn, _CUDA_VSTD::size_t _Rank>
+void __host_copy_for_each_outer(
+  const _CUDA_VSTD::array<__host_copy_dim, _Rank>& __dims,
+  _CUDA_VSTD::size_t __first,
+  _CUDA_VSTD::size_t __last,
+  _Fn& __f)
+{
+  _CUDA_VSTD::array<_CUDA_VSTD::size_t, _Rank> __idx{};
+  _CUDA_VSTD::size_t __src_offset = 0;
+  _CUDA_VSTD::size_t __dst_offset = 0;
+
+  while (true)
+  {
+    __f(__src_offset, __dst_offset);
+
+    _CUDA_VSTD::size_t __r = __first;
+    for (; __r < __last; ++__r)
+    {
+      if (++__idx[__r] < __dims[__r].__extent)
+      {
+        __src_offset += __dims[__r].__src_stride;
+        __dst_offset += __dims[__r].__dst_stride;
+        break;
+      }
+      __src_offset -= (__idx[__r] - 1) * __dims[__r].__src_stride;
+      __dst_offset -= (__idx[__r] - 1) * __dims[__r].__dst_stride;
+      __idx[__r] = 0;
+    }
+    if (__r == __last)
+    {
+      return;
+    }
+  }
+}
+
+template <typename _Src, typename _Dst>
+void __host_copy_strided(const _Src& __src, const _Dst& __dst)
+{
+  constexpr _CUDA_VSTD::size_t __rank = _Src::rank();
+
+  // dimensions of extent 1 don't contribute to the offsets
+  _CUDA_VSTD::array<__host_copy_dim, __rank> __dims{};
+  _CUDA_VSTD::size_t __num_dims = 0;
+  for (_CUDA_VSTD::size_t __r = 0; __r < __rank; ++__r)
+  {
+    const auto __extent = static_cast<_CUDA_VSTD::size_t>(__src.extent(__r));
+    if (__extent == 0)
+    {
+      return;
+    }
+    if (__extent > 1)
+    {
+      __dims[__num_dims++] = {__extent,
+                              static_cast<_CUDA_VSTD::size_t>(__src.stride(__r)),
+                              static_cast<_CUDA_VSTD::size_t>(__dst.stride(__r))};
+    }
+  }
+
+  // order the dimensions by the destination strides, fastest first
+  for (_CUDA_VSTD::size_t __i = 1; __i < __num_dims; ++__i)
+  {
+    for (_CUDA_VSTD::size_t __j = __i; __j > 0 && __dims[__j].__dst_stride < __dims[__j - 1].__dst_stride; --__j)
+    {
+      _CUDA_VSTD::swap(__dims[__j], __dims[__j - 1]);
+    }
+  }
+
+  // fold neighbours which are contiguous in both source and destination, so that a contiguous copy is a single run
+  _CUDA_VSTD::size_t __num_folded = 0;
+  for (_CUDA_VSTD::size_t __i = 0; __i < __num_dims; ++__i)
+  {
+    if (__num_folded > 0)
+    {
+      __host_copy_dim& __inner = __dims[__num_folded - 1];
+      if (__dims[__i].__src_stride == __inner.__src_stride * __inner.__extent
+          && __dims[__i].__dst_stride == __inner.__dst_stride * __inner.__extent)
+      {
+        __inner.__extent *= __dims[__i].__extent;
+        continue;
+      }
+    }
+    __dims[__num_folded++] = __dims[__i];
+  }
+  __num_dims = __num_folded;
+
+  if (__num_dims == 0)
+  {
+    __host_copy_run(__src, 0, 1, __dst, 0, 1, 1);
+    return;
+  }
+
+  // the source dimension with the smallest stride
+  _CUDA_VSTD::size_t __src_fastest = 0;
+  for (_CUDA_VSTD::size_t __i = 1; __i < __num_dims; ++__i)
+  {
+    if (__dims[__i].__src_stride < __dims[__src_fastest].__src_stride)
+    {
+      __src_fastest = __i;
+    }
+  }
+
+  if (__src_fastest == 0)
+  {
+    // both sides agree on the fastest dimension, copy it in runs
+    auto __copy_run = [&](_CUDA_VSTD::size_t __src_offset, _CUDA_VSTD::size_t __dst_offset) {
+      __host_copy_run(
+        __src, __src_offset, __dims[0].__src_stride, __dst, __dst_offset, __dims[0].__dst_stride, __dims[0].__extent);
+    };
+    __host_copy_for_each_outer(__dims, 1, __num_dims, __copy_run);
+  }
+  else
+  {
+    // tile the fastest dimensions of both sides, the remaining ones keep their order
+    const __host_copy_dim __a = __dims[0];
+    const __host_copy_dim __b = __dims[__src_fastest];
+    for (_CUDA_VSTD::size_t __i = __src_fastest; __i + 1 < __num_dims; ++__i)
+    {
+      __dims[__i] = __dims[__i + 1];
+    }
+
+    auto __copy_tiles = [&](_CUDA_VSTD::size_t __src_offset, _CUDA_VSTD::size_t __dst_offset) {
+      __host_copy_tiled(__src, __src_offset, __dst, __dst_offset, __a, __b);
+    };
+    __host_copy_for_each_outer(__dims, 1, __num_dims - 1, __copy_tiles);
+  }
+}
+
+template <typename _Src, typename _Dst, _CUDA_VSTD::size_t... _Rs>
+void __host_copy_unstrided(const _Src& __src, const _Dst& __dst, _CUDA_VSTD::index_sequence<_Rs...>)
+{
+  using __index_type = typename _Src::index_type;
+
+  _CUDA_VSTD::array<__index_type, _Src::rank()> __idx{};
+  for (_CUDA_VSTD::size_t __r = 0; __r < _Src::rank(); ++__r)
+  {
+    if (__src.extent(__r) == 0)
+    {
+      return;
+    }
+  }
+
+  // visits the indices in layout_right order
+  while (true)
+  {
+    __dst.accessor().access(__dst.data_handle(), __dst.mapping()(__idx[_Rs]...)) =
+      __src.accessor().access(__src.data_handle(), __src.mapping()(__idx[_Rs]...));
+
+    _CUDA_VSTD::size_t __r = _Src::rank();
+    while (__r > 0 && ++__idx[__r - 1] == __src.extent(__r - 1))
+    {
+      __idx[--__r] = 0;
+    }
+    if (__r == 0)
+    {
+      return;
+    }
+  }
+}
+
+//! @brief Copies every element of a `cuda::std::mdspan` to the element with the same indices of another one.
+//!
+//! Source and destination may have different layouts and element types, their extents have to match. The copy runs
+//! on the calling host thread, so both have to be accessible from the host. They must not overlap.
+//!
+//! When both mappings are strided the dimensions are ordered and merged by their strides. If source and destination
+//! agree on the fastest dimension it is copied in runs, which are plain loops the compiler vectorizes when both
+//! strides are 1. Otherwise the fastest dimensions of both sides are copied in tiles sized for L1, visited in blocks
+//! sized for L2, so that neither side is walked across the cache lines of the other. Layouts whose mappings aren't
+//! strided are copied element by element.
+//!
+//! @param __src Source to copy from
+//! @param __dst Destination to copy into
+//!
+//! @throws std::invalid_argument if the extents of source and destination differ
+template <typename _SrcElem,
+          typename _SrcExtents,
+          typename _SrcLayout,
+          typename _SrcAccessor,
+          typename _DstElem,
+          typename _DstExtents,
+          typename _DstLayout,
+          typename _DstAccessor>
+void host_copy(_CUDA_VSTD::mdspan<_SrcElem, _SrcExtents, _SrcLayout, _SrcAccessor> __src,
+               _CUDA_VSTD::mdspan<_DstElem, _DstExtents, _DstLayout, _DstAccessor> __dst)
+{
+  static_assert(__copy_bytes_compatible_extents<_SrcExtents, _DstExtents>,
+                "Multidimensional copy requires both source and destination extents to be compatible");
+  static_assert(!_CUDA_VSTD::is_const_v<_DstElem>, "Copy destination can't be const");
+
+  for (_CUDA_VSTD::size_t __r = 0; __r < _SrcExtents::rank(); ++__r)
+  {
+    if (static_cast<_CUDA_VSTD::size_t>(__src.extent(__r)) != static_cast<_CUDA_VSTD::size_t>(__dst.extent(__r)))
+    {
+      _CUDA_VSTD::__throw_invalid_argument("Copy destination size differs from the source");
+    }
+  }
+
+  if constexpr (_SrcExtents::rank() == 0)
+  {
+    __dst() = __src();
+  }
+  else if constexpr (_SrcLayout::template mapping<_SrcExtents>::is_always_strided()
+                     && _DstLayout::template mapping<_DstExtents>::is_always_strided())
+  {
+    __host_copy_strided(__src, __dst);
+  }
+  else
+  {
+    __host_copy_unstrided(__src, __dst, _CUDA_VSTD::make_index_sequence<_SrcExtents::rank()>{});
+  }
+}
+
+//! @brief Transposes a two dimensional `cuda::std::mdspan` into another one, so that `dst(j, i) == src(i, j)`.
+//!
+//! This is a `host_copy` into a view of the destination with its extents and strides swapped, which makes it a
+//! tiled copy whenever the swapped layouts disagree on the fastest dimension, e.g. between two layout_right arrays.
+//!
+//! @param __src Source to transpose
+//! @param __dst Destination to transpose into, its mapping has to be strided
+//!
+//! @throws std::invalid_argument if the extents of the destination aren't those of the source swapped
+template <typename _SrcElem,
+          typename _SrcExtents,
+          typename _SrcLayout,
+          typename _SrcAccessor,
+          typename _DstElem,
+          typename _DstExtents,
+          typename _DstLayout,
+          typename _DstAccessor>
+void host_transpose(_CUDA_VSTD::mdspan<_SrcElem, _SrcExtents, _SrcLayout, _SrcAccessor> __src,
+                    _CUDA_VSTD::mdspan<_DstElem, _DstExtents, _DstLayout, _DstAccessor> __dst)
+{
+  static_assert(_SrcExtents::rank() == 2 && _DstExtents::rank() == 2, "Transpose requires two dimensional mdspans");
+  static_assert(_DstLayout::template mapping<_DstExtents>::is_always_strided(),
+                "Transpose requires a strided destination layout");
+
+  using __index_type      = typename _DstExtents::index_type;
+  using __swapped_extents = _CUDA_VSTD::dextents<__index_type, 2>;
+  using __swapped_mapping = typename _CUDA_VSTD::layout_stride::template mapping<__swapped_extents>;
+
+  if (static_cast<_CUDA_VSTD::size_t>(__src.extent(0)) != static_cast<_CUDA_VSTD::size_t>(__dst.extent(1))
+      || static_cast<_CUDA_VSTD::size_t>(__src.extent(1)) != static_cast<_CUDA_VSTD::size_t>(__dst.extent(0)))
+  {
+    _CUDA_VSTD::__throw_invalid_argument("Transpose destination extents aren't the swapped source extents");
+  }
+
+  const __swapped_mapping __mapping(
+    __swapped_extents(__dst.extent(1), __dst.extent(0)),
+    _CUDA_VSTD::array<__index_type, 2>{__dst.stride(1), __dst.stride(0)});
+
+  host_copy(__src,
+            _CUDA_VSTD::mdspan<_DstElem, __swapped_extents, _CUDA_VSTD::layout_stride, _DstAccessor>(
+              __dst.data_handle(), __mapping, __dst.accessor()));
+}
+
+} // namespace cuda::experimental
+#endif // __CUDAX_ALGORITHM_HOST_COPY
@@ -42,6 +42,7 @@
 #include <cuda/experimental/__async/sync_wait.cuh>
 #include <cuda/experimental/__async/then.cuh>
 #include <cuda/experimental/__async/thread_context.cuh>
+#include <cuda/experimental/__async/thread_pool.cuh>
 #include <cuda/experimental/__async/when_all.cuh>
 #include <cuda/experimental/__async/write_env.cuh>
 
@@ -0,0 +1,478 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ASYNC_DETAIL_THREAD_POOL
+#define __CUDAX_ASYNC_DETAIL_THREAD_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__detail/config.cuh>
+
+// libcu++ does not have <cuda/std/mutex> or <cuda/std/condition_variable>
+#if !defined(__CUDA_ARCH__)
+
+#  include <cuda/experimental/__async/completion_signatures.cuh>
+#  include <cuda/experimental/__async/env.cuh>
+#  include <cuda/experimental/__async/exception.cuh>
+#  include <cuda/experimental/__async/queries.cuh>
+#  include <cuda/experimental/__async/run_loop.cuh>
+#  include <cuda/experimental/__async/utility.cuh>
+
+#  include <algorithm>
+#  include <atomic>
+#  include <condition_variable>
+#  include <cstdint>
+#  include <memory>
+#  include <mutex>
+#  include <thread>
+
+#  include <cuda/experimental/__async/prologue.cuh>
+
+namespace cuda::experimental::__async
+{
+class static_thread_pool;
+
+//! A fixed capacity Chase-Lev deque of tasks. The owning worker pushes and pops at the bottom, the other workers
+//! steal from the top.
+class __task_deque
+{
+public:
+  static constexpr ::std::int64_t __capacity = 1024;
+
+  //! Owner only. Returns false if the deque is full.
+  _CUDAX_HOST_API bool __push(__task* __tsk) noexcept
+  {
+    const ::std::int64_t __bottom = __bottom_.load(::std::memory_order_relaxed);
+    const ::std::int64_t __top    = __top_.load(::std::memory_order_acquire);
+    if (__bottom - __top >= __capacity)
+    {
+      return false;
+    }
+    __tasks_[__bottom & (__capacity - 1)].store(__tsk, ::std::memory_order_relaxed);
+    __bottom_.store(__bottom + 1, ::std::memory_order_release);
+    return true;
+  }
+
+  //! Owner only. Pops the most recently pushed task, or returns null if the deque is empty.
+  _CUDAX_HOST_API auto __pop() noexcept -> __task*
+  {
+    const ::std::int64_t __bottom = __bottom_.load(::std::memory_order_relaxed) - 1;
+    __bottom_.store(__bottom, ::std::memory_order_seq_cst);
+    ::std::int64_t __top = __top_.load(::std::memory_order_seq_cst);
+
+    if (__top > __bottom)
+    {
+      __bottom_.store(__bottom + 1, ::std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    __task* __tsk = __tasks_[__bottom & (__capacity - 1)].load(::std::memory_order_relaxed);
+    if (__top == __bottom)
+    {
+      // the last task, race the thieves for it
+      if (!__top_.compare_exchange_strong(__top, __top + 1, ::std::memory_order_seq_cst, ::std::memory_order_relaxed))
+      {
+        __tsk = nullptr;
+      }
+      __bottom_.store(__bottom + 1, ::std::memory_order_relaxed);
+    }
+    return __tsk;
+  }
+
+  //! Any thread. Takes the oldest task, or returns null if the deque is empty or another thief won the race.
+  _CUDAX_HOST_API auto __steal() noexcept -> __task*
+  {
+    ::std::int64_t __top          = __top_.load(::std::memory_order_seq_cst);
+    const ::std::int64_t __bottom = __bottom_.load(::std::memory_order_seq_cst);
+    if (__top >= __bottom)
+    {
+      return nullptr;
+    }
+
+    __task* __tsk = __tasks_[__top & (__capacity - 1)].load(::std::memory_order_relaxed);
+    if (!__top_.compare_exchange_strong(__top, __top + 1, ::std::memory_order_seq_cst, ::std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+    return __tsk;
+  }
+
+private:
+  alignas(64) ::std::atomic<::std::int64_t> __top_{0};
+  alignas(64) ::std::atomic<::std::int64_t> __bottom_{0};
+  alignas(64) ::std::atomic<__task*> __tasks_[__capacity]{};
+};
+
+template <class _Rcvr>
+struct __pool_operation : __task
+{
+  static_thread_pool* __pool_;
+  _CCCL_NO_UNIQUE_ADDRESS _Rcvr __rcvr_;
+
+  using completion_signatures = //
+    __async::completion_signatures<set_value_t(), set_error_t(::std::exception_ptr), set_stopped_t()>;
+
+  _CUDAX_API static void __execute_impl(__task* __p) noexcept
+  {
+    auto& __rcvr = static_cast<__pool_operation*>(__p)->__rcvr_;
+    _CUDAX_TRY( //
+      ({ //
+        if (get_stop_token(get_env(__rcvr)).stop_requested())
+        {
+          set_stopped(static_cast<_Rcvr&&>(__rcvr));
+        }
+        else
+        {
+          set_value(static_cast<_Rcvr&&>(__rcvr));
+        }
+      }),
+      _CUDAX_CATCH(...)( //
+        { //
+          set_error(static_cast<_Rcvr&&>(__rcvr), ::std::current_exception());
+        }))
+  }
+
+  _CUDAX_API __pool_operation(static_thread_pool* __pool, _Rcvr __rcvr)
+      : __task{nullptr, &__execute_impl}
+      , __pool_{__pool}
+      , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+  {}
+
+  _CUDAX_API void start() & noexcept;
+};
+
+//! A fixed number of worker threads that execute the tasks scheduled on them.
+//!
+//! Every worker owns a deque of tasks. Tasks scheduled from a worker go to the bottom of its own deque and are run
+//! last in, first out, which keeps the data of a fork-join graph hot in that worker's cache. Tasks scheduled from
+//! other threads go to a shared queue. An idle worker takes from its own deque, then from the shared queue, then
+//! steals the oldest task of another worker, and only parks once all of them came up empty.
+class static_thread_pool
+{
+  template <class>
+  friend struct __pool_operation;
+
+public:
+  explicit static_thread_pool(::std::uint32_t __num_threads = (::std::max)(1u, ::std::thread::hardware_concurrency()))
+      : __num_workers_{(::std::max)(1u, __num_threads)}
+      , __workers_{new __worker[__num_workers_]}
+  {
+    for (::std::uint32_t __i = 0; __i < __num_workers_; ++__i)
+    {
+      __workers_[__i].__pool_ = this;
+      __workers_[__i].__rng_  = __i + 1;
+    }
+    for (::std::uint32_t __i = 0; __i < __num_workers_; ++__i)
+    {
+      __workers_[__i].__thrd_ = ::std::thread{[this, __i] {
+        __run(__workers_[__i]);
+      }};
+    }
+  }
+
+  static_thread_pool(static_thread_pool&&) = delete;
+
+  ~static_thread_pool() noexcept
+  {
+    join();
+  }
+
+  //! Waits for the scheduled work to finish and stops the workers. No work may be scheduled afterwards.
+  void join() noexcept
+  {
+    __stop_.store(true, ::std::memory_order_seq_cst);
+    __wake(true);
+    for (::std::uint32_t __i = 0; __i < __num_workers_; ++__i)
+    {
+      if (__workers_[__i].__thrd_.joinable())
+      {
+        __workers_[__i].__thrd_.join();
+      }
+    }
+  }
+
+  _CUDAX_HOST_API auto available_parallelism() const noexcept -> ::std::uint32_t
+  {
+    return __num_workers_;
+  }
+
+  class __scheduler
+  {
+    struct __schedule_task
+    {
+      using __t            = __schedule_task;
+      using __id           = __schedule_task;
+      using sender_concept = sender_t;
+
+      struct __env
+      {
+        static_thread_pool* __pool_;
+
+        template <class _Tag>
+        _CUDAX_API auto query(get_completion_scheduler_t<_Tag>) const noexcept -> __scheduler
+        {
+          return __pool_->get_scheduler();
+        }
+      };
+
+      template <class _Rcvr>
+      _CUDAX_API auto connect(_Rcvr __rcvr) const noexcept -> __pool_operation<_Rcvr>
+      {
+        return {__pool_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      _CUDAX_API auto get_env() const noexcept -> __env
+      {
+        return __env{__pool_};
+      }
+
+    private:
+      friend __scheduler;
+
+      _CUDAX_API explicit __schedule_task(static_thread_pool* __pool) noexcept
+          : __pool_(__pool)
+      {}
+
+      static_thread_pool* const __pool_;
+    };
+
+    friend static_thread_pool;
+
+    _CUDAX_API explicit __scheduler(static_thread_pool* __pool) noexcept
+        : __pool_(__pool)
+    {}
+
+    _CUDAX_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    static_thread_pool* __pool_;
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    [[nodiscard]] _CUDAX_API auto schedule() const noexcept -> __schedule_task
+    {
+      return __schedule_task{__pool_};
+    }
+
+    _CUDAX_API friend bool operator==(const __scheduler& __a, const __scheduler& __b) noexcept
+    {
+      return __a.__pool_ == __b.__pool_;
+    }
+
+    _CUDAX_API friend bool operator!=(const __scheduler& __a, const __scheduler& __b) noexcept
+    {
+      return __a.__pool_ != __b.__pool_;
+    }
+  };
+
+  _CUDAX_API auto get_scheduler() noexcept -> __scheduler
+  {
+    return __scheduler{this};
+  }
+
+private:
+  struct alignas(64) __worker
+  {
+    __task_deque __deque_{};
+    static_thread_pool* __pool_ = nullptr;
+    ::std::uint32_t __rng_      = 0;
+    ::std::thread __thrd_{};
+  };
+
+  // number of rounds an idle worker keeps looking for work before it parks
+  static constexpr int __spin_rounds = 64;
+
+  _CUDAX_HOST_API static auto __current_worker() noexcept -> __worker*&
+  {
+    static thread_local __worker* __current = nullptr;
+    return __current;
+  }
+
+  _CUDAX_HOST_API void __push(__task* __tsk)
+  {
+    __worker* __self = __current_worker();
+    if (__self == nullptr || __self->__pool_ != this || !__self->__deque_.__push(__tsk))
+    {
+      ::std::unique_lock __lock{__mutex_};
+      __tsk->__next_ = nullptr;
+      if (__shared_tail_ != nullptr)
+      {
+        __shared_tail_->__next_ = __tsk;
+      }
+      else
+      {
+        __shared_head_ = __tsk;
+      }
+      __shared_tail_ = __tsk;
+      __shared_size_.store(__shared_size_.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+    }
+    __wake(false);
+  }
+
+  _CUDAX_HOST_API auto __pop_shared() -> __task*
+  {
+    if (__shared_size_.load(::std::memory_order_relaxed) == 0)
+    {
+      return nullptr;
+    }
+
+    ::std::unique_lock __lock{__mutex_};
+    __task* __tsk = __shared_head_;
+    if (__tsk != nullptr)
+    {
+      __shared_head_ = __tsk->__next_;
+      if (__shared_head_ == nullptr)
+      {
+        __shared_tail_ = nullptr;
+      }
+      __shared_size_.store(__shared_size_.load(::std::memory_order_relaxed) - 1, ::std::memory_order_relaxed);
+    }
+    return __tsk;
+  }
+
+  _CUDAX_HOST_API auto __steal(__worker& __self) noexcept -> __task*
+  {
+    // xorshift, to spread the thieves over the victims
+    __self.__rng_ ^= __self.__rng_ << 13;
+    __self.__rng_ ^= __self.__rng_ >> 17;
+    __self.__rng_ ^= __self.__rng_ << 5;
+
+    const ::std::uint32_t __start = __self.__rng_ % __num_workers_;
+    for (::std::uint32_t __i = 0; __i < __num_workers_; ++__i)
+    {
+      __worker& __victim = __workers_[(__start + __i) % __num_workers_];
+      if (&__victim != &__self)
+      {
+        if (__task* __tsk = __victim.__deque_.__steal())
+        {
+          return __tsk;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  _CUDAX_HOST_API auto __find_task(__worker& __self) -> __task*
+  {
+    if (__task* __tsk = __self.__deque_.__pop())
+    {
+      return __tsk;
+    }
+    if (__task* __tsk = __pop_shared())
+    {
+      return __tsk;
+    }
+    return __steal(__self);
+  }
+
+  // Every push bumps the epoch before it looks for parked workers, and a worker registers as parked before it reads
+  // the epoch it waits on. Either the pusher sees the parked worker and notifies it, or the worker sees the new
+  // epoch and does not park.
+  _CUDAX_HOST_API void __wake(bool __all) noexcept
+  {
+    __epoch_.fetch_add(1, ::std::memory_order_seq_cst);
+    if (__all || __num_parked_.load(::std::memory_order_seq_cst) != 0)
+    {
+      ::std::unique_lock __lock{__mutex_};
+      if (__all)
+      {
+        __cv_.notify_all();
+      }
+      else
+      {
+        __cv_.notify_one();
+      }
+    }
+  }
+
+  _CUDAX_HOST_API void __run(__worker& __self)
+  {
+    __current_worker() = &__self;
+
+    int __idle_rounds = 0;
+    while (true)
+    {
+      const ::std::uint64_t __epoch = __epoch_.load(::std::memory_order_seq_cst);
+
+      if (__task* __tsk = __find_task(__self))
+      {
+        __idle_rounds = 0;
+        __tsk->__execute();
+        continue;
+      }
+
+      // Tasks scheduled by a task go to the deque of its worker, which drains it before it leaves. Once stop was
+      // requested, a worker that found nothing anywhere has nothing left to do.
+      if (__stop_.load(::std::memory_order_seq_cst))
+      {
+        break;
+      }
+
+      if (++__idle_rounds < __spin_rounds)
+      {
+        ::std::this_thread::yield();
+        continue;
+      }
+
+      ::std::unique_lock __lock{__mutex_};
+      __num_parked_.fetch_add(1, ::std::memory_order_seq_cst);
+      __cv_.wait(__lock, [&] {
+        return __epoch_.load(::std::memory_order_seq_cst) != __epoch;
+      });
+      __num_parked_.fetch_sub(1, ::std::memory_order_seq_cst);
+      __idle_rounds = 0;
+    }
+
+    __current_worker() = nullptr;
+  }
+
+  const ::std::uint32_t __num_workers_;
+  ::std::unique_ptr<__worker[]> __workers_;
+
+  ::std::mutex __mutex_{};
+  ::std::condition_variable __cv_{};
+  __task* __shared_head_ = nullptr;
+  __task* __shared_tail_ = nullptr;
+  ::std::atomic<::std::size_t> __shared_size_{0};
+
+  ::std::atomic<::std::uint64_t> __epoch_{0};
+  ::std::atomic<::std::uint32_t> __num_parked_{0};
+  ::std::atomic<bool> __stop_{false};
+};
+
+template <class _Rcvr>
+_CUDAX_API inline void __pool_operation<_Rcvr>::start() & noexcept {
+  _CUDAX_TRY( //
+    ({ //
+      __pool_->__push(this); //
+    }), //
+    _CUDAX_CATCH(...)( //
+      { //
+        set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception()); //
+      })) //
+}
+} // namespace cuda::experimental::__async
+
+#  include <cuda/experimental/__async/epilogue.cuh>
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
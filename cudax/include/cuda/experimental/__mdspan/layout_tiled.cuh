@@ -0,0 +1,395 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_MDSPAN_LAYOUT_TILED
+#define __CUDAX_MDSPAN_LAYOUT_TILED
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__type_traits/is_constant_evaluated.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/mdspan>
+#include <cuda/std/tuple>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#if defined(__BMI2__)
+#  include <immintrin.h>
+#endif // __BMI2__
+
+namespace cuda::experimental
+{
+
+// Places the tiles of a grid one row of tiles after the other
+struct __tile_order_row_major
+{
+  _CUDA_VSTD::size_t __tiles_per_row = 0;
+
+  _CCCL_HOST_DEVICE static constexpr __tile_order_row_major
+  __for_grid(_CUDA_VSTD::size_t, _CUDA_VSTD::size_t __grid_cols) noexcept
+  {
+    return __tile_order_row_major{__grid_cols};
+  }
+
+  _CCCL_HOST_DEVICE constexpr _CUDA_VSTD::size_t
+  __index(_CUDA_VSTD::size_t __tile_row, _CUDA_VSTD::size_t __tile_col) const noexcept
+  {
+    return __tile_row * __tiles_per_row + __tile_col;
+  }
+
+  _CCCL_HOST_DEVICE friend constexpr bool
+  operator==(const __tile_order_row_major& __lhs, const __tile_order_row_major& __rhs) noexcept
+  {
+    return __lhs.__tiles_per_row == __rhs.__tiles_per_row;
+  }
+};
+
+// Places the tiles of a grid along a Z-order curve. The curve covers square blocks of 2^__log2_block tiles along
+// either edge, the smallest ones that cover the short edge of the grid, which follow each other along its long edge.
+// Tiles of the blocks which lie outside of the grid are padding.
+struct __tile_order_morton
+{
+  unsigned __log2_block    = 0;
+  bool __blocks_along_rows = false;
+
+  _CCCL_HOST_DEVICE static constexpr __tile_order_morton
+  __for_grid(_CUDA_VSTD::size_t __grid_rows, _CUDA_VSTD::size_t __grid_cols) noexcept
+  {
+    const _CUDA_VSTD::size_t __short_edge = __grid_rows < __grid_cols ? __grid_rows : __grid_cols;
+
+    unsigned __log2_block = 0;
+    while ((_CUDA_VSTD::size_t{1} << __log2_block) < __short_edge)
+    {
+      ++__log2_block;
+    }
+
+    return __tile_order_morton{__log2_block, __grid_rows > __grid_cols};
+  }
+
+  // spreads the low 32 bits of __x to the even bits of the result
+  _CCCL_HOST_DEVICE static constexpr _CUDA_VSTD::uint64_t __spread(_CUDA_VSTD::uint64_t __x) noexcept
+  {
+#if defined(__BMI2__)
+    // a single instruction instead of a chain of ten, which makes the curve about as cheap as row major tiles
+    if (!_CUDA_VSTD::__cccl_default_is_constant_evaluated())
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return _pdep_u64(__x, 0x5555555555555555ull);))
+    }
+#endif // __BMI2__
+    __x &= 0x00000000ffffffffull;
+    __x = (__x | (__x << 16)) & 0x0000ffff0000ffffull;
+    __x = (__x | (__x << 8)) & 0x00ff00ff00ff00ffull;
+    __x = (__x | (__x << 4)) & 0x0f0f0f0f0f0f0f0full;
+    __x = (__x | (__x << 2)) & 0x3333333333333333ull;
+    __x = (__x | (__x << 1)) & 0x5555555555555555ull;
+    return __x;
+  }
+
+  _CCCL_HOST_DEVICE constexpr _CUDA_VSTD::size_t
+  __index(_CUDA_VSTD::size_t __tile_row, _CUDA_VSTD::size_t __tile_col) const noexcept
+  {
+    const _CUDA_VSTD::size_t __mask = (_CUDA_VSTD::size_t{1} << __log2_block) - 1;
+
+    const _CUDA_VSTD::size_t __block = (__blocks_along_rows ? __tile_row : __tile_col) >> __log2_block;
+    const _CUDA_VSTD::size_t __z =
+      static_cast<_CUDA_VSTD::size_t>(__spread(__tile_col & __mask) | (__spread(__tile_row & __mask) << 1));
+
+    return (__block << (2 * __log2_block)) + __z;
+  }
+
+  _CCCL_HOST_DEVICE friend constexpr bool
+  operator==(const __tile_order_morton& __lhs, const __tile_order_morton& __rhs) noexcept
+  {
+    return __lhs.__log2_block == __rhs.__log2_block && __lhs.__blocks_along_rows == __rhs.__blocks_along_rows;
+  }
+};
+
+// The mapping of layout_tiled and layout_tiled_morton.
+//
+// A mapping created from extents covers an array of its own. The mapping of a submdspan keeps the tile grid and tile
+// order of the array it was taken from and adds the origin of the slice to the indices. Offsets are increasing in
+// either index, so the offset of the origin is the smallest one and the offset of the last element the largest one.
+template <typename _Layout,
+          typename _Extents,
+          _CUDA_VSTD::size_t _TileRows,
+          _CUDA_VSTD::size_t _TileCols,
+          typename _Order>
+class __tiled_mapping
+{
+  static_assert(_Extents::rank() == 2, "Tiled layouts are two dimensional");
+  static_assert(_TileRows > 0 && _TileCols > 0, "Tiles can't be empty");
+
+public:
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = _Layout;
+
+  static constexpr _CUDA_VSTD::size_t tile_rows = _TileRows;
+  static constexpr _CUDA_VSTD::size_t tile_cols = _TileCols;
+
+  _CCCL_HOST_DEVICE constexpr __tiled_mapping() noexcept
+      : __tiled_mapping(extents_type{})
+  {}
+
+  _CCCL_HOST_DEVICE constexpr __tiled_mapping(const extents_type& __extents) noexcept
+      : __extents_(__extents)
+      , __order_(
+          _Order::__for_grid(__ceil_div(__extents.extent(0), _TileRows), __ceil_div(__extents.extent(1), _TileCols)))
+  {}
+
+  _CCCL_TEMPLATE(typename _OtherExtents)
+  _CCCL_REQUIRES(_CUDA_VSTD::is_convertible_v<_OtherExtents, extents_type>)
+  _CCCL_HOST_DEVICE constexpr __tiled_mapping(
+    const __tiled_mapping<_Layout, _OtherExtents, _TileRows, _TileCols, _Order>& __other) noexcept
+      : __tiled_mapping(__other, 0, 0, extents_type(__other.extents()))
+  {}
+
+  _CCCL_TEMPLATE(typename _OtherExtents)
+  _CCCL_REQUIRES(_CUDA_VSTD::is_constructible_v<extents_type, _OtherExtents> _CCCL_AND(
+    !_CUDA_VSTD::is_convertible_v<_OtherExtents, extents_type>))
+  _CCCL_HOST_DEVICE constexpr explicit __tiled_mapping(
+    const __tiled_mapping<_Layout, _OtherExtents, _TileRows, _TileCols, _Order>& __other) noexcept
+      : __tiled_mapping(__other, 0, 0, extents_type(__other.extents()))
+  {}
+
+  // the mapping of the slice of __parent with the given extents whose first element is (__row, __col) in __parent
+  template <typename _ParentExtents>
+  _CCCL_HOST_DEVICE constexpr __tiled_mapping(
+    const __tiled_mapping<_Layout, _ParentExtents, _TileRows, _TileCols, _Order>& __parent,
+    _CUDA_VSTD::size_t __row,
+    _CUDA_VSTD::size_t __col,
+    const extents_type& __extents) noexcept
+      : __extents_(__extents)
+      , __order_(__parent.__order_)
+      , __origin_row_(__parent.__origin_row_ + __row)
+      , __origin_col_(__parent.__origin_col_ + __col)
+      , __origin_offset_(__parent.__offset(__origin_row_, __origin_col_))
+  {}
+
+  _CCCL_HOST_DEVICE constexpr const extents_type& extents() const noexcept
+  {
+    return __extents_;
+  }
+
+  _CCCL_HOST_DEVICE constexpr index_type required_span_size() const noexcept
+  {
+    if (__extents_.extent(0) == 0 || __extents_.extent(1) == 0)
+    {
+      return 0;
+    }
+    return static_cast<index_type>(
+      __offset(__origin_row_ + __extents_.extent(0) - 1, __origin_col_ + __extents_.extent(1) - 1) - __origin_offset_
+      + 1);
+  }
+
+  template <typename _Index0, typename _Index1>
+  _CCCL_HOST_DEVICE constexpr index_type operator()(_Index0 __i, _Index1 __j) const noexcept
+  {
+    const _CUDA_VSTD::size_t __row = __origin_row_ + static_cast<_CUDA_VSTD::size_t>(__i);
+    const _CUDA_VSTD::size_t __col = __origin_col_ + static_cast<_CUDA_VSTD::size_t>(__j);
+    return static_cast<index_type>(__offset(__row, __col) - __origin_offset_);
+  }
+
+  _CCCL_HOST_DEVICE static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+  _CCCL_HOST_DEVICE static constexpr bool is_always_exhaustive() noexcept
+  {
+    return false;
+  }
+  _CCCL_HOST_DEVICE static constexpr bool is_always_strided() noexcept
+  {
+    return false;
+  }
+
+  _CCCL_HOST_DEVICE static constexpr bool is_unique() noexcept
+  {
+    return true;
+  }
+  // true if no tile is padded and no other element lies between the first and the last one
+  _CCCL_HOST_DEVICE constexpr bool is_exhaustive() const noexcept
+  {
+    const _CUDA_VSTD::size_t __size =
+      static_cast<_CUDA_VSTD::size_t>(__extents_.extent(0)) * static_cast<_CUDA_VSTD::size_t>(__extents_.extent(1));
+    return static_cast<_CUDA_VSTD::size_t>(required_span_size()) == __size;
+  }
+  // only promises strides where they exist for every extent, which is never
+  _CCCL_HOST_DEVICE static constexpr bool is_strided() noexcept
+  {
+    return false;
+  }
+
+  template <typename _OtherExtents>
+  _CCCL_HOST_DEVICE friend constexpr bool
+  operator==(const __tiled_mapping& __lhs,
+             const __tiled_mapping<_Layout, _OtherExtents, _TileRows, _TileCols, _Order>& __rhs) noexcept
+  {
+    return __lhs.__equal(__rhs);
+  }
+
+private:
+  template <typename, typename, _CUDA_VSTD::size_t, _CUDA_VSTD::size_t, typename>
+  friend class __tiled_mapping;
+
+  template <typename _OtherExtents>
+  _CCCL_HOST_DEVICE constexpr bool
+  __equal(const __tiled_mapping<_Layout, _OtherExtents, _TileRows, _TileCols, _Order>& __other) const noexcept
+  {
+    return __extents_ == __other.__extents_ && __order_ == __other.__order_ && __origin_row_ == __other.__origin_row_
+        && __origin_col_ == __other.__origin_col_;
+  }
+
+  _CCCL_HOST_DEVICE static constexpr _CUDA_VSTD::size_t
+  __ceil_div(_CUDA_VSTD::size_t __n, _CUDA_VSTD::size_t __d) noexcept
+  {
+    return (__n + __d - 1) / __d;
+  }
+
+  // the offset of (__row, __col) in the whole array, tile sizes are compile time constants so the divisions are cheap
+  _CCCL_HOST_DEVICE constexpr _CUDA_VSTD::size_t
+  __offset(_CUDA_VSTD::size_t __row, _CUDA_VSTD::size_t __col) const noexcept
+  {
+    const _CUDA_VSTD::size_t __tile = __order_.__index(__row / _TileRows, __col / _TileCols);
+    return __tile * (_TileRows * _TileCols) + (__row % _TileRows) * _TileCols + __col % _TileCols;
+  }
+
+  extents_type __extents_;
+  _Order __order_;
+  _CUDA_VSTD::size_t __origin_row_    = 0;
+  _CUDA_VSTD::size_t __origin_col_    = 0;
+  _CUDA_VSTD::size_t __origin_offset_ = 0;
+};
+
+//! @brief Layout policy of two dimensional arrays stored in tiles of `_TileRows` x `_TileCols` elements.
+//!
+//! The elements of a tile are stored row by row and the tiles of the array one row of tiles after the other, so that
+//! the neighbours of an element along either dimension are mostly in the same tile. The tiles at the bottom and right
+//! edges are padded to full tiles, `required_span_size` includes the padding up to the last element.
+//!
+//! Tile extents which are powers of two turn the divisions of the mapping into shifts.
+template <_CUDA_VSTD::size_t _TileRows, _CUDA_VSTD::size_t _TileCols>
+struct layout_tiled
+{
+  template <typename _Extents>
+  using mapping = __tiled_mapping<layout_tiled, _Extents, _TileRows, _TileCols, __tile_order_row_major>;
+};
+
+//! @brief Layout policy like `layout_tiled` with the tiles placed along a Z-order (Morton) curve.
+//!
+//! Tiles which are close in either dimension are close in memory, at any distance, which keeps sweeps across
+//! neighbouring tiles within L2 and the TLB reach. The curve covers square blocks of tiles, so the short edge of a
+//! rectangular array is padded to a power of two number of tiles.
+template <_CUDA_VSTD::size_t _TileRows, _CUDA_VSTD::size_t _TileCols>
+struct layout_tiled_morton
+{
+  template <typename _Extents>
+  using mapping = __tiled_mapping<layout_tiled_morton, _Extents, _TileRows, _TileCols, __tile_order_morton>;
+};
+
+template <typename _Layout>
+inline constexpr bool __is_tiled_layout = false;
+
+template <_CUDA_VSTD::size_t _TileRows, _CUDA_VSTD::size_t _TileCols>
+inline constexpr bool __is_tiled_layout<layout_tiled<_TileRows, _TileCols>> = true;
+
+template <_CUDA_VSTD::size_t _TileRows, _CUDA_VSTD::size_t _TileCols>
+inline constexpr bool __is_tiled_layout<layout_tiled_morton<_TileRows, _TileCols>> = true;
+
+template <typename _Slice>
+inline constexpr bool __is_tiled_slice =
+  _CUDA_VSTD::is_convertible_v<_Slice, _CUDA_VSTD::full_extent_t>
+  || _CUDA_VSTD::is_convertible_v<_Slice, _CUDA_VSTD::tuple<_CUDA_VSTD::size_t, _CUDA_VSTD::size_t>>;
+
+// the first and one past the last index of a slice of a dimension of the given extent
+template <typename _Slice>
+_CCCL_HOST_DEVICE constexpr _CUDA_VSTD::pair<_CUDA_VSTD::size_t, _CUDA_VSTD::size_t>
+__tiled_slice_bounds(const _Slice& __slice, _CUDA_VSTD::size_t __extent) noexcept
+{
+  if constexpr (_CUDA_VSTD::is_convertible_v<_Slice, _CUDA_VSTD::full_extent_t>)
+  {
+    return {0, __extent};
+  }
+  else
+  {
+    const _CUDA_VSTD::tuple<_CUDA_VSTD::size_t, _CUDA_VSTD::size_t> __range = __slice;
+    return {_CUDA_VSTD::get<0>(__range), _CUDA_VSTD::get<1>(__range)};
+  }
+}
+
+template <typename _ElementType,
+          typename _Extents,
+          typename _Layout,
+          typename _Accessor,
+          typename _RowSlice,
+          typename _ColSlice>
+_CCCL_HOST_DEVICE constexpr auto __tiled_submdspan(
+  const _CUDA_VSTD::mdspan<_ElementType, _Extents, _Layout, _Accessor>& __src, _RowSlice __rows, _ColSlice __cols)
+{
+  static_assert(__is_tiled_slice<_RowSlice> && __is_tiled_slice<_ColSlice>,
+                "Slices of a tiled mdspan are cuda::std::full_extent or ranges of indices");
+
+  using __index_type  = typename _Extents::index_type;
+  using __sub_extents = _CUDA_VSTD::dextents<__index_type, 2>;
+  using __sub_mapping = typename _Layout::template mapping<__sub_extents>;
+  using __sub_accessor = typename _Accessor::offset_policy;
+
+  const auto __row_bounds = __tiled_slice_bounds(__rows, static_cast<_CUDA_VSTD::size_t>(__src.extent(0)));
+  const auto __col_bounds = __tiled_slice_bounds(__cols, static_cast<_CUDA_VSTD::size_t>(__src.extent(1)));
+
+  const __sub_mapping __mapping(
+    __src.mapping(),
+    __row_bounds.first,
+    __col_bounds.first,
+    __sub_extents(static_cast<__index_type>(__row_bounds.second - __row_bounds.first),
+                  static_cast<__index_type>(__col_bounds.second - __col_bounds.first)));
+
+  // an empty slice may start one past the last element, whose offset doesn't point into the array
+  const bool __empty = __row_bounds.first == __row_bounds.second || __col_bounds.first == __col_bounds.second;
+  const _CUDA_VSTD::size_t __offset =
+    __empty ? 0 : static_cast<_CUDA_VSTD::size_t>(__src.mapping()(__row_bounds.first, __col_bounds.first));
+
+  return _CUDA_VSTD::mdspan<_ElementType, __sub_extents, _Layout, __sub_accessor>(
+    __src.accessor().offset(__src.data_handle(), __offset), __mapping, __sub_accessor(__src.accessor()));
+}
+
+//! @brief `cuda::std::submdspan` extended to `layout_tiled` and `layout_tiled_morton`.
+//!
+//! Other layouts are forwarded to `cuda::std::submdspan`. A slice of a tiled mdspan keeps its layout, so both slices
+//! have to be `cuda::std::full_extent` or a range of indices convertible to `cuda::std::tuple<size_t, size_t>`. Single
+//! indices aren't supported, a row or column of a tiled array has no tiled layout of its own.
+template <typename _ElementType, typename _Extents, typename _Layout, typename _Accessor, typename... _Slices>
+_CCCL_HOST_DEVICE constexpr auto
+submdspan(const _CUDA_VSTD::mdspan<_ElementType, _Extents, _Layout, _Accessor>& __src, _Slices... __slices)
+{
+  if constexpr (__is_tiled_layout<_Layout>)
+  {
+    static_assert(sizeof...(_Slices) == 2, "A tiled mdspan is sliced along both dimensions");
+    return __tiled_submdspan(__src, __slices...);
+  }
+  else
+  {
+    return _CUDA_VSTD::submdspan(__src, __slices...);
+  }
+}
+
+} // namespace cuda::experimental
+#endif // __CUDAX_MDSPAN_LAYOUT_TILED
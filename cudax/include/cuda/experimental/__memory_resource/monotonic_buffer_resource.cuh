@@ -0,0 +1,237 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX__MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_CUH
+#define _CUDAX__MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_CUH
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// If the memory resource header was included without the experimental flag,
+// tell the user to define the experimental flag.
+#if defined(_CUDA_MEMORY_RESOURCE) && !defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE)
+#  error "To use the experimental memory resource, define LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE"
+#endif
+
+// cuda::mr is unavable on MSVC 2017
+#if _CCCL_COMPILER(MSVC2017)
+#  error "The monotonic_buffer_resource header is not supported on MSVC 2017"
+#endif
+
+#if !defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE)
+#  define LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE
+#endif
+
+#include <cuda/__memory_resource/get_property.h>
+#include <cuda/__memory_resource/properties.h>
+#include <cuda/__memory_resource/resource.h>
+#include <cuda/std/__bit/has_single_bit.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__new_>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/detail/libcxx/include/stdexcept>
+
+#include <cuda/experimental/__memory_resource/properties.cuh>
+
+//! @file
+//! The \c monotonic_buffer_resource class provides an arena that bump-allocates from memory of an upstream resource.
+namespace cuda::experimental
+{
+
+//! @rst
+//! .. _cudax-memory-resource-monotonic-buffer-resource:
+//!
+//! Arena resource with bump allocation
+//! -----------------------------------
+//!
+//! ``monotonic_buffer_resource`` hands out memory by advancing a pointer through chunks obtained from an upstream
+//! resource. ``deallocate`` is a no-op, and all memory is returned to the upstream resource at once by ``release`` or
+//! upon destruction. This makes it well suited for short-lived temporaries, which then cost no calls to the upstream
+//! resource beyond the occasional new chunk. Chunks grow geometrically, and an optional initial buffer owned by the
+//! caller is used before any upstream memory.
+//!
+//! ``monotonic_buffer_resource`` is neither copyable nor movable and compares equal only to itself. It can be passed
+//! around through a ``resource_ref``, or wrapped into a :ref:`shared_resource <cudax-memory-resource-shared-resource>`
+//! to be stored within an :ref:`any_resource <cudax-memory-resource-any-resource>`. It is not thread safe.
+//!
+//! @tparam _Upstream The resource to obtain chunks from. It must satisfy ``cuda::mr::resource`` and provide
+//! ``host_accessible``. Its stateless properties, e.g. ``device_accessible``, are forwarded.
+//! @endrst
+template <class _Upstream>
+class monotonic_buffer_resource
+{
+  static_assert(_CUDA_VMR::resource_with<_Upstream, host_accessible>,
+                "The upstream of monotonic_buffer_resource must be a host accessible resource");
+
+public:
+  //! @brief The size of the first chunk when no initial size is given.
+  static constexpr size_t default_initial_size = 1024;
+
+  //! @brief Constructs a \c monotonic_buffer_resource without an initial buffer.
+  //! @param __upstream The resource to obtain chunks from.
+  //! @param __initial_size The size in bytes of the first chunk obtained from \p __upstream.
+  explicit monotonic_buffer_resource(_Upstream __upstream, const size_t __initial_size = default_initial_size)
+      : __upstream_(_CUDA_VSTD::move(__upstream))
+      , __next_chunk_size_(__initial_size != 0 ? __initial_size : default_initial_size)
+  {}
+
+  //! @brief Constructs a \c monotonic_buffer_resource that allocates from \p __buffer first.
+  //! @param __buffer A buffer owned by the caller that outlives the \c monotonic_buffer_resource.
+  //! @param __buffer_size The size in bytes of \p __buffer.
+  //! @param __upstream The resource to obtain chunks from once \p __buffer is exhausted.
+  monotonic_buffer_resource(void* __buffer, const size_t __buffer_size, _Upstream __upstream)
+      : __upstream_(_CUDA_VSTD::move(__upstream))
+      , __initial_buffer_(static_cast<char*>(__buffer))
+      , __initial_buffer_size_(__buffer_size)
+      , __current_(static_cast<char*>(__buffer))
+      , __end_(static_cast<char*>(__buffer) + __buffer_size)
+      , __next_chunk_size_(__buffer_size != 0 ? 2 * __buffer_size : default_initial_size)
+  {}
+
+  monotonic_buffer_resource(monotonic_buffer_resource const&)            = delete;
+  monotonic_buffer_resource(monotonic_buffer_resource&&)                 = delete;
+  monotonic_buffer_resource& operator=(monotonic_buffer_resource const&) = delete;
+  monotonic_buffer_resource& operator=(monotonic_buffer_resource&&)      = delete;
+
+  //! @brief Returns all chunks to the upstream resource.
+  ~monotonic_buffer_resource()
+  {
+    release();
+  }
+
+  //! @brief Allocate memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation.
+  //! @throw std::invalid_argument in case of an alignment that is not a power of two.
+  //! @return Pointer to the newly allocated memory
+  _CCCL_NODISCARD void* allocate(const size_t __bytes, const size_t __alignment = alignof(_CUDA_VSTD::max_align_t))
+  {
+    if (!_CUDA_VSTD::has_single_bit(__alignment))
+    {
+      _CUDA_VSTD_NOVERSION::__throw_invalid_argument(
+        "Invalid alignment passed to monotonic_buffer_resource::allocate.");
+    }
+
+    if (void* __ptr = __try_allocate(__bytes, __alignment))
+    {
+      return __ptr;
+    }
+
+    __allocate_chunk(__bytes, __alignment);
+    return __try_allocate(__bytes, __alignment);
+  }
+
+  //! @brief Deallocation is a no-op, memory is only reclaimed by \c release.
+  void deallocate(void*, const size_t, const size_t = alignof(_CUDA_VSTD::max_align_t)) noexcept {}
+
+  //! @brief Returns all chunks to the upstream resource. Subsequent allocations start over from the initial buffer.
+  //! @note Any memory allocated from this resource must not be used anymore.
+  void release() noexcept
+  {
+    while (__chunks_ != nullptr)
+    {
+      _Chunk_header* const __prev = __chunks_->__prev_;
+      __upstream_.deallocate(__chunks_, __chunks_->__size_, alignof(_CUDA_VSTD::max_align_t));
+      __chunks_ = __prev;
+    }
+
+    __current_ = __initial_buffer_;
+    __end_     = __initial_buffer_ + __initial_buffer_size_;
+  }
+
+  //! @brief Returns the upstream resource.
+  _CCCL_NODISCARD const _Upstream& upstream_resource() const noexcept
+  {
+    return __upstream_;
+  }
+
+  //! @brief Equality comparison with another \c monotonic_buffer_resource.
+  //! @return Whether both are the same object, as memory can only be reclaimed by its own resource.
+  _CCCL_NODISCARD_FRIEND bool
+  operator==(monotonic_buffer_resource const& __lhs, monotonic_buffer_resource const& __rhs) noexcept
+  {
+    return &__lhs == &__rhs;
+  }
+
+  //! @brief Inequality comparison with another \c monotonic_buffer_resource.
+  _CCCL_NODISCARD_FRIEND bool
+  operator!=(monotonic_buffer_resource const& __lhs, monotonic_buffer_resource const& __rhs) noexcept
+  {
+    return &__lhs != &__rhs;
+  }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+  //! @brief Forwards the stateless properties of the upstream resource
+  _CCCL_TEMPLATE(class _Property)
+  _CCCL_REQUIRES((!property_with_value<_Property>) _CCCL_AND(has_property<_Upstream, _Property>))
+  friend constexpr void get_property(monotonic_buffer_resource const&, _Property) noexcept {}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+  //! Chunks obtained from the upstream resource form a list through a header at their start
+  struct _Chunk_header
+  {
+    _Chunk_header* __prev_;
+    size_t __size_;
+  };
+
+  _CCCL_NODISCARD void* __try_allocate(const size_t __bytes, const size_t __alignment) noexcept
+  {
+    if (__current_ == nullptr)
+    {
+      return nullptr;
+    }
+
+    const auto __ptr = (reinterpret_cast<_CUDA_VSTD::uintptr_t>(__current_) + (__alignment - 1))
+                     & ~static_cast<_CUDA_VSTD::uintptr_t>(__alignment - 1);
+    if (__ptr > reinterpret_cast<_CUDA_VSTD::uintptr_t>(__end_)
+        || __bytes > reinterpret_cast<_CUDA_VSTD::uintptr_t>(__end_) - __ptr)
+    {
+      return nullptr;
+    }
+
+    __current_ = reinterpret_cast<char*>(__ptr + __bytes);
+    return reinterpret_cast<void*>(__ptr);
+  }
+
+  void __allocate_chunk(const size_t __bytes, const size_t __alignment)
+  {
+    // The allocation starts after the chunk header, so reserve room to align it
+    const size_t __required = sizeof(_Chunk_header) + (__alignment - 1) + __bytes;
+    const size_t __size     = __required > __next_chunk_size_ ? __required : __next_chunk_size_;
+
+    void* const __chunk = __upstream_.allocate(__size, alignof(_CUDA_VSTD::max_align_t));
+    __chunks_           = ::new (__chunk) _Chunk_header{__chunks_, __size};
+    __current_          = static_cast<char*>(__chunk) + sizeof(_Chunk_header);
+    __end_              = static_cast<char*>(__chunk) + __size;
+    __next_chunk_size_  = 2 * __size;
+  }
+
+  _Upstream __upstream_;
+  char* __initial_buffer_       = nullptr;
+  size_t __initial_buffer_size_ = 0;
+  char* __current_              = nullptr;
+  char* __end_                  = nullptr;
+  size_t __next_chunk_size_;
+  _Chunk_header* __chunks_ = nullptr;
+};
+
+} // namespace cuda::experimental
+
+#endif // _CUDAX__MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_CUH
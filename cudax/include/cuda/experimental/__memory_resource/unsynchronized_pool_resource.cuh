@@ -0,0 +1,307 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX__MEMORY_RESOURCE_UNSYNCHRONIZED_POOL_RESOURCE_CUH
+#define _CUDAX__MEMORY_RESOURCE_UNSYNCHRONIZED_POOL_RESOURCE_CUH
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// If the memory resource header was included without the experimental flag,
+// tell the user to define the experimental flag.
+#if defined(_CUDA_MEMORY_RESOURCE) && !defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE)
+#  error "To use the experimental memory resource, define LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE"
+#endif
+
+// cuda::mr is unavable on MSVC 2017
+#if _CCCL_COMPILER(MSVC2017)
+#  error "The unsynchronized_pool_resource header is not supported on MSVC 2017"
+#endif
+
+#if !defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE)
+#  define LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE
+#endif
+
+#include <cuda/__memory_resource/get_property.h>
+#include <cuda/__memory_resource/properties.h>
+#include <cuda/__memory_resource/resource.h>
+#include <cuda/std/__bit/has_single_bit.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__new_>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/detail/libcxx/include/stdexcept>
+
+#include <cuda/experimental/__memory_resource/properties.cuh>
+
+//! @file
+//! The \c unsynchronized_pool_resource class provides a pool of blocks in power of two size classes.
+namespace cuda::experimental
+{
+
+//! @rst
+//! .. _cudax-memory-resource-unsynchronized-pool-resource:
+//!
+//! Pool resource with size classes
+//! -------------------------------
+//!
+//! ``unsynchronized_pool_resource`` serves allocations up to a configurable size from a set of pools, one per power of
+//! two size class. Each pool carves blocks out of chunks obtained from an upstream resource and keeps deallocated
+//! blocks in an intrusive free list, so both allocation and deallocation take constant time and do not call the
+//! upstream resource in the steady state. Chunks grow geometrically up to a maximal number of blocks per chunk.
+//! Larger allocations are forwarded to the upstream resource directly.
+//!
+//! All chunks are returned to the upstream resource by ``release`` or upon destruction. Allocations forwarded to the
+//! upstream resource are not tracked and must be deallocated individually.
+//!
+//! ``unsynchronized_pool_resource`` is neither copyable nor movable and compares equal only to itself. It can be
+//! passed around through a ``resource_ref``, or wrapped into a
+//! :ref:`shared_resource <cudax-memory-resource-shared-resource>` to be stored within an
+//! :ref:`any_resource <cudax-memory-resource-any-resource>`. As its name suggests, it is not thread safe.
+//!
+//! @tparam _Upstream The resource to obtain chunks from. It must satisfy ``cuda::mr::resource`` and provide
+//! ``host_accessible``. Its stateless properties, e.g. ``device_accessible``, are forwarded.
+//! @endrst
+template <class _Upstream>
+class unsynchronized_pool_resource
+{
+  static_assert(_CUDA_VMR::resource_with<_Upstream, host_accessible>,
+                "The upstream of unsynchronized_pool_resource must be a host accessible resource");
+
+  //! The smallest size class holds blocks large enough to store the free list link
+  static constexpr int __min_block_shift = 3;
+  static constexpr int __max_block_shift = 20;
+  static constexpr int __max_pool_count  = __max_block_shift - __min_block_shift + 1;
+
+  //! The number of blocks in the first chunk of each pool
+  static constexpr size_t __initial_blocks_per_chunk = 16;
+
+public:
+  //! @brief The default upper bound of the sizes served from the pools.
+  static constexpr size_t default_largest_required_pool_block = 4096;
+  //! @brief The default upper bound of the number of blocks in a chunk.
+  static constexpr size_t default_max_blocks_per_chunk = 1024;
+
+  //! @brief Constructs an \c unsynchronized_pool_resource.
+  //! @param __upstream The resource to obtain chunks from.
+  //! @param __largest_required_pool_block The largest allocation served from the pools. It is rounded up to a power
+  //! of two and clamped to [8, 1 MiB].
+  //! @param __max_blocks_per_chunk The largest number of blocks obtained from \p __upstream at once.
+  explicit unsynchronized_pool_resource(
+    _Upstream __upstream,
+    const size_t __largest_required_pool_block = default_largest_required_pool_block,
+    const size_t __max_blocks_per_chunk        = default_max_blocks_per_chunk)
+      : __upstream_(_CUDA_VSTD::move(__upstream))
+      , __pool_count_(__size_class(__largest_required_pool_block < (size_t{1} << __max_block_shift)
+                                     ? __largest_required_pool_block
+                                     : (size_t{1} << __max_block_shift))
+                      + 1)
+      , __max_blocks_per_chunk_(__max_blocks_per_chunk != 0 ? __max_blocks_per_chunk : 1)
+  {
+    for (_Pool& __pool : __pools_)
+    {
+      __pool.__blocks_per_chunk_ =
+        __initial_blocks_per_chunk < __max_blocks_per_chunk_ ? __initial_blocks_per_chunk : __max_blocks_per_chunk_;
+    }
+  }
+
+  unsynchronized_pool_resource(unsynchronized_pool_resource const&)            = delete;
+  unsynchronized_pool_resource(unsynchronized_pool_resource&&)                 = delete;
+  unsynchronized_pool_resource& operator=(unsynchronized_pool_resource const&) = delete;
+  unsynchronized_pool_resource& operator=(unsynchronized_pool_resource&&)      = delete;
+
+  //! @brief Returns all chunks to the upstream resource.
+  ~unsynchronized_pool_resource()
+  {
+    release();
+  }
+
+  //! @brief Allocate memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation.
+  //! @throw std::invalid_argument in case of an alignment that is not a power of two.
+  //! @return Pointer to the newly allocated memory
+  _CCCL_NODISCARD void* allocate(const size_t __bytes, const size_t __alignment = alignof(_CUDA_VSTD::max_align_t))
+  {
+    if (!_CUDA_VSTD::has_single_bit(__alignment))
+    {
+      _CUDA_VSTD_NOVERSION::__throw_invalid_argument(
+        "Invalid alignment passed to unsynchronized_pool_resource::allocate.");
+    }
+
+    const size_t __block_size = __bytes > __alignment ? __bytes : __alignment;
+    if (__block_size > largest_required_pool_block())
+    {
+      return __upstream_.allocate(__bytes, __alignment);
+    }
+
+    const int __index = __size_class(__block_size);
+    _Pool& __pool     = __pools_[__index];
+    if (__pool.__free_ != nullptr)
+    {
+      return _CUDA_VSTD::exchange(__pool.__free_, __pool.__free_->__next_);
+    }
+
+    if (__pool.__next_ == __pool.__end_)
+    {
+      __allocate_chunk(__pool, size_t{1} << (__index + __min_block_shift));
+    }
+
+    void* const __ptr = __pool.__next_;
+    __pool.__next_ += size_t{1} << (__index + __min_block_shift);
+    return __ptr;
+  }
+
+  //! @brief Deallocate memory pointed to by \p __ptr.
+  //! @param __ptr Pointer to be deallocated. Must have been allocated through a call to `allocate`.
+  //! @param __bytes The number of bytes that was passed to the `allocate` call that returned \p __ptr.
+  //! @param __alignment The alignment that was passed to the `allocate` call that returned \p __ptr.
+  void deallocate(
+    void* __ptr, const size_t __bytes, const size_t __alignment = alignof(_CUDA_VSTD::max_align_t)) noexcept
+  {
+    _CCCL_ASSERT(_CUDA_VSTD::has_single_bit(__alignment),
+                 "Invalid alignment passed to unsynchronized_pool_resource::deallocate.");
+    const size_t __block_size = __bytes > __alignment ? __bytes : __alignment;
+    if (__block_size > largest_required_pool_block())
+    {
+      __upstream_.deallocate(__ptr, __bytes, __alignment);
+      return;
+    }
+
+    _Pool& __pool  = __pools_[__size_class(__block_size)];
+    __pool.__free_ = ::new (__ptr) _Free_block{__pool.__free_};
+  }
+
+  //! @brief Returns all chunks to the upstream resource and empties the pools.
+  //! @note Any memory allocated from the pools must not be used anymore.
+  void release() noexcept
+  {
+    while (__chunks_ != nullptr)
+    {
+      _Chunk_header* const __prev = __chunks_->__prev_;
+      __upstream_.deallocate(__chunks_, __chunks_->__size_, alignof(_CUDA_VSTD::max_align_t));
+      __chunks_ = __prev;
+    }
+
+    for (_Pool& __pool : __pools_)
+    {
+      __pool.__free_ = nullptr;
+      __pool.__next_ = nullptr;
+      __pool.__end_  = nullptr;
+    }
+  }
+
+  //! @brief Returns the largest allocation size that is served from the pools.
+  _CCCL_NODISCARD size_t largest_required_pool_block() const noexcept
+  {
+    return size_t{1} << (__pool_count_ - 1 + __min_block_shift);
+  }
+
+  //! @brief Returns the upstream resource.
+  _CCCL_NODISCARD const _Upstream& upstream_resource() const noexcept
+  {
+    return __upstream_;
+  }
+
+  //! @brief Equality comparison with another \c unsynchronized_pool_resource.
+  //! @return Whether both are the same object, as blocks can only be returned to their own pools.
+  _CCCL_NODISCARD_FRIEND bool
+  operator==(unsynchronized_pool_resource const& __lhs, unsynchronized_pool_resource const& __rhs) noexcept
+  {
+    return &__lhs == &__rhs;
+  }
+
+  //! @brief Inequality comparison with another \c unsynchronized_pool_resource.
+  _CCCL_NODISCARD_FRIEND bool
+  operator!=(unsynchronized_pool_resource const& __lhs, unsynchronized_pool_resource const& __rhs) noexcept
+  {
+    return &__lhs != &__rhs;
+  }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+  //! @brief Forwards the stateless properties of the upstream resource
+  _CCCL_TEMPLATE(class _Property)
+  _CCCL_REQUIRES((!property_with_value<_Property>) _CCCL_AND(has_property<_Upstream, _Property>))
+  friend constexpr void get_property(unsynchronized_pool_resource const&, _Property) noexcept {}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+  //! Chunks obtained from the upstream resource form a list through a header at their start
+  struct _Chunk_header
+  {
+    _Chunk_header* __prev_;
+    size_t __size_;
+  };
+
+  //! Deallocated blocks form a list through their first bytes
+  struct _Free_block
+  {
+    _Free_block* __next_;
+  };
+
+  struct _Pool
+  {
+    _Free_block* __free_ = nullptr;
+    char* __next_        = nullptr;
+    char* __end_         = nullptr;
+    size_t __blocks_per_chunk_;
+  };
+
+  //! @brief Returns the index of the smallest size class that holds \p __bytes.
+  _CCCL_NODISCARD static int __size_class(const size_t __bytes) noexcept
+  {
+    if (__bytes <= (size_t{1} << __min_block_shift))
+    {
+      return 0;
+    }
+    return _CUDA_VSTD::bit_width(__bytes - 1) - __min_block_shift;
+  }
+
+  void __allocate_chunk(_Pool& __pool, const size_t __block_size)
+  {
+    // Blocks are aligned to their size, which covers any alignment that maps to their size class
+    const size_t __size = sizeof(_Chunk_header) + (__block_size - 1) + __pool.__blocks_per_chunk_ * __block_size;
+
+    void* const __chunk = __upstream_.allocate(__size, alignof(_CUDA_VSTD::max_align_t));
+    __chunks_           = ::new (__chunk) _Chunk_header{__chunks_, __size};
+
+    const auto __first = (reinterpret_cast<_CUDA_VSTD::uintptr_t>(__chunks_ + 1) + (__block_size - 1))
+                       & ~static_cast<_CUDA_VSTD::uintptr_t>(__block_size - 1);
+    __pool.__next_ = reinterpret_cast<char*>(__first);
+    __pool.__end_  = __pool.__next_ + __pool.__blocks_per_chunk_ * __block_size;
+
+    if (__pool.__blocks_per_chunk_ < __max_blocks_per_chunk_)
+    {
+      __pool.__blocks_per_chunk_ = 2 * __pool.__blocks_per_chunk_ < __max_blocks_per_chunk_
+                                   ? 2 * __pool.__blocks_per_chunk_
+                                   : __max_blocks_per_chunk_;
+    }
+  }
+
+  _Upstream __upstream_;
+  int __pool_count_;
+  size_t __max_blocks_per_chunk_;
+  _Pool __pools_[__max_pool_count];
+  _Chunk_header* __chunks_ = nullptr;
+};
+
+} // namespace cuda::experimental
+
+#endif // _CUDAX__MEMORY_RESOURCE_UNSYNCHRONIZED_POOL_RESOURCE_CUH
@@ -25,11 +25,15 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/bit>
+
 #include <cuda/experimental/__stf/allocators/block_allocator.cuh>
 #include <cuda/experimental/__stf/internal/async_prereq.cuh>
 #include <cuda/experimental/__stf/internal/backend_ctx.cuh>
 #include <cuda/experimental/__stf/utility/pretty_print.cuh>
 
+#include <unordered_map>
+
 namespace cuda::experimental::stf
 {
 
@@ -42,6 +46,10 @@ namespace reserved
  * It does not manipulate memory at all, but returns offsets within some memory space of size "size"
  *
  * We (currently) assume that the size is a power of 2
+ *
+ * Free blocks are kept in one list per level, each indexed by the offset of its blocks so that the buddy of a
+ * deallocated block is found in constant time. A bitmap of the non-empty levels locates the smallest free block that
+ * can hold an allocation with a single bit scan. Allocating and deallocating thus cost O(log(size)).
  */
 class buddy_allocator_metadata
 {
@@ -61,6 +69,75 @@ private:
     event_list prereqs; // dependencies to use that block
   };
 
+  /**
+   * @brief The available blocks of one level, indexed by their location
+   */
+  class free_list
+  {
+  public:
+    bool empty() const
+    {
+      return blocks.empty();
+    }
+
+    const ::std::vector<avail_block>& get_blocks() const
+    {
+      return blocks;
+    }
+
+    ::std::vector<avail_block>& get_blocks()
+    {
+      return blocks;
+    }
+
+    void push(size_t index, event_list prereqs)
+    {
+      assert(positions.count(index) == 0);
+      positions.emplace(index, blocks.size());
+      blocks.emplace_back(index, mv(prereqs));
+    }
+
+    /// Removes the most recently freed block
+    avail_block pop()
+    {
+      assert(!blocks.empty());
+      avail_block result = mv(blocks.back());
+      blocks.pop_back();
+      positions.erase(result.index);
+      return result;
+    }
+
+    /// Removes the block at `index` if it is available, and adds its dependencies to `prereqs`
+    bool extract(size_t index, event_list& prereqs)
+    {
+      auto it = positions.find(index);
+      if (it == positions.end())
+      {
+        return false;
+      }
+
+      const size_t position = it->second;
+      positions.erase(it);
+
+      prereqs.merge(mv(blocks[position].prereqs));
+
+      // Fill the hole with the last block
+      if (position + 1 != blocks.size())
+      {
+        blocks[position]                  = mv(blocks.back());
+        positions[blocks[position].index] = position;
+      }
+      blocks.pop_back();
+
+      return true;
+    }
+
+  private:
+    ::std::vector<avail_block> blocks;
+    // location of a block -> position in blocks
+    ::std::unordered_map<size_t, size_t> positions;
+  };
+
 public:
   buddy_allocator_metadata(size_t size, event_list init_prereqs)
   {
@@ -68,11 +145,12 @@ public:
     assert(total_size_ == size);
 
     max_level_ = int_log2(total_size_);
+    assert(max_level_ < 64);
 
     free_lists_.resize(max_level_ + 1);
 
     // Initially, the whole memory is free, but depends on init_prereqs
-    free_lists_[max_level_].emplace_back(0, init_prereqs);
+    push_block(max_level_, 0, mv(init_prereqs));
   }
 
   ::std::ptrdiff_t allocate(size_t size, event_list& prereqs)
@@ -108,32 +186,29 @@ public:
     while (level < max_level_)
     {
       size_t buddy_index = get_buddy_index(index, level);
-      auto& buddy_list   = free_lists_[level];
-      auto it = ::std::find_if(buddy_list.begin(), buddy_list.end(), [buddy_index](const avail_block& block) {
-        return block.index == buddy_index;
-      });
-
-      if (it == buddy_list.end())
+      if (!free_lists_[level].extract(buddy_index, block_prereqs))
       {
         // No buddy available to merge, stop here
         break;
       }
-      // Merge with buddy
-      block_prereqs.merge(it->prereqs);
 
-      buddy_list.erase(it);
+      if (free_lists_[level].empty())
+      {
+        nonempty_levels_ &= ~(uint64_t(1) << level);
+      }
+
       index = ::std::min(index, ::std::ptrdiff_t(buddy_index));
       level++;
     }
 
-    free_lists_[level].emplace_back(index, prereqs);
+    push_block(level, index, mv(block_prereqs));
   }
 
   void deinit(event_list& prereqs)
   {
     for (auto& level : free_lists_)
     {
-      for (auto& block : level)
+      for (auto& block : level.get_blocks())
       {
         prereqs.merge(block.prereqs);
         block.prereqs.clear();
@@ -149,7 +224,7 @@ public:
       if (!free_lists_[i].empty())
       {
         fprintf(stderr, "Level %zu : %s bytes : ", i, pretty_print_bytes(power).c_str());
-        for (const auto& b : free_lists_[i])
+        for (const auto& b : free_lists_[i].get_blocks())
         {
           fprintf(stderr, "[%zu, %zu[ ", b.index, b.index + power);
         }
@@ -185,34 +260,40 @@ private:
     return log;
   }
 
+  void push_block(size_t level, size_t index, event_list prereqs)
+  {
+    free_lists_[level].push(index, mv(prereqs));
+    nonempty_levels_ |= uint64_t(1) << level;
+  }
+
   ::std::ptrdiff_t find_free_block(size_t level, event_list& prereqs)
   {
-    for (size_t current_level : each(level, max_level_ + 1))
+    // Smallest level at or above the requested one which has an available block
+    const uint64_t candidates = nonempty_levels_ >> level;
+    if (candidates == 0)
     {
-      if (free_lists_[current_level].empty())
-      {
-        continue;
-      }
-      auto& b              = free_lists_[current_level].back();
-      size_t block_index   = b.index;
-      event_list b_prereqs = mv(b.prereqs);
-      free_lists_[current_level].pop_back();
-
-      // Dependencies to reuse that block
-      prereqs.merge(b_prereqs);
+      return -1; // No block available
+    }
+    size_t current_level = level + ::cuda::std::countr_zero(candidates);
 
-      // If we are not at the requested level, split blocks
-      while (current_level > level)
-      {
-        current_level--;
-        size_t buddy_index = block_index + (1ull << current_level);
-        // split blocks depend on the previous dependencies of the whole unsplit block
-        free_lists_[current_level].emplace_back(buddy_index, b_prereqs);
-      }
-      return block_index;
+    avail_block b = free_lists_[current_level].pop();
+    if (free_lists_[current_level].empty())
+    {
+      nonempty_levels_ &= ~(uint64_t(1) << current_level);
     }
 
-    return -1; // No block available
+    // Dependencies to reuse that block
+    prereqs.merge(b.prereqs);
+
+    // If we are not at the requested level, split blocks
+    while (current_level > level)
+    {
+      current_level--;
+      size_t buddy_index = b.index + (1ull << current_level);
+      // split blocks depend on the previous dependencies of the whole unsplit block
+      push_block(current_level, buddy_index, b.prereqs);
+    }
+    return b.index;
   }
 
   size_t get_buddy_index(size_t index, size_t level)
@@ -221,9 +302,11 @@ private:
     return index ^ (1ull << level); // XOR to find the buddy block
   }
 
-  ::std::vector<::std::vector<avail_block>> free_lists_;
-  size_t total_size_ = 0;
-  size_t max_level_  = 0;
+  ::std::vector<free_list> free_lists_;
+  // Bit i is set if free_lists_[i] is not empty
+  uint64_t nonempty_levels_ = 0;
+  size_t total_size_        = 0;
+  size_t max_level_         = 0;
 };
 
 } // end namespace reserved
@@ -361,6 +444,66 @@ UNITTEST("buddy allocator meta data")
   // allocator.debug_print();
 };
 
+UNITTEST("buddy allocator meta data coalesces blocks")
+{
+  event_list prereqs; // starts empty
+
+  reserved::buddy_allocator_metadata allocator(1024, prereqs);
+
+  event_list dummy;
+
+  ::std::vector<::std::ptrdiff_t> offsets;
+  for (size_t i = 0; i < 1024 / 16; i++)
+  {
+    offsets.push_back(allocator.allocate(16, dummy));
+  }
+
+  // The blocks tile the whole buffer
+  ::std::sort(offsets.begin(), offsets.end());
+  for (size_t i = 0; i < offsets.size(); i++)
+  {
+    EXPECT(offsets[i] == ::std::ptrdiff_t(16 * i));
+  }
+
+  // Free every other block first, so that no buddies can be merged until the second pass
+  for (size_t i = 0; i < offsets.size(); i += 2)
+  {
+    allocator.deallocate(offsets[i], 16, dummy);
+  }
+  for (size_t i = 1; i < offsets.size(); i += 2)
+  {
+    allocator.deallocate(offsets[i], 16, dummy);
+  }
+
+  // The whole buffer is available again
+  EXPECT(allocator.allocate(1024, dummy) == 0);
+};
+
+namespace reserved
+{
+class buddy_allocator_test_event : public event_impl
+{};
+} // end namespace reserved
+
+UNITTEST("buddy allocator meta data merges prerequisites")
+{
+  reserved::buddy_allocator_metadata allocator(1024, event_list());
+
+  event_list dummy;
+  ::std::ptrdiff_t ptr1 = allocator.allocate(512, dummy);
+  ::std::ptrdiff_t ptr2 = allocator.allocate(512, dummy);
+
+  event_list prereqs1(event(::std::make_shared<reserved::buddy_allocator_test_event>()));
+  event_list prereqs2(event(::std::make_shared<reserved::buddy_allocator_test_event>()));
+  allocator.deallocate(ptr1, 512, prereqs1);
+  allocator.deallocate(ptr2, 512, prereqs2);
+
+  // The coalesced block can only be reused after both deallocations
+  event_list reuse_prereqs;
+  EXPECT(allocator.allocate(1024, reuse_prereqs) == 0);
+  EXPECT(reuse_prereqs.size() == 2);
+};
+
 #endif // UNITTESTED_FILE
 
 } // end namespace cuda::experimental::stf
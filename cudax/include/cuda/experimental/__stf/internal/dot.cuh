@@ -18,6 +18,8 @@
  * CUDASTF_DOT_COLOR_BY_DEVICE
  * CUDASTF_DOT_REMOVE_DATA_DEPS
  * CUDASTF_DOT_TIMING
+ *
+ * When CUDASTF_TRACE_FILE is set, the same information is also recorded in a binary trace (see trace.cuh).
  */
 
 #pragma once
@@ -33,6 +35,7 @@
 #endif // no system header
 
 #include <cuda/experimental/__stf/internal/constants.cuh>
+#include <cuda/experimental/__stf/internal/trace.cuh>
 #include <cuda/experimental/__stf/utility/cuda_safe_call.cuh>
 #include <cuda/experimental/__stf/utility/hash.cuh>
 #include <cuda/experimental/__stf/utility/threads.cuh>
@@ -71,7 +74,14 @@ public:
       : _is_tracing(_is_tracing)
       , _is_tracing_prereqs(_is_tracing_prereqs)
       , _is_timing(_is_timing)
-  {}
+  {
+    auto& trace = trace_recorder::instance();
+    if (trace.is_tracing())
+    {
+      trace_ctx_id = trace.new_context_id();
+      trace.record(new_trace_record(trace_record_kind::context));
+    }
+  }
   ~per_ctx_dot() = default;
 
   void finish()
@@ -86,11 +96,29 @@ public:
 
   void set_ctx_symbol(::std::string s)
   {
+    if (is_trace_recording())
+    {
+      trace_recorder::instance().record(new_trace_record(trace_record_kind::context), s);
+    }
     ctx_symbol = mv(s);
   }
 
   void add_fence_vertex(int unique_id)
   {
+    if (is_trace_recording())
+    {
+      auto& trace = trace_recorder::instance();
+      if (!trace.no_fence)
+      {
+        trace.record(new_trace_record(trace_record_kind::fence, unique_id));
+      }
+
+      if (!_is_tracing)
+      {
+        return;
+      }
+    }
+
     if (getenv("CUDASTF_DOT_NO_FENCE"))
     {
       return;
@@ -111,6 +139,15 @@ public:
       return;
     }
 
+    if (is_trace_recording())
+    {
+      trace_recorder::instance().record(new_trace_record(trace_record_kind::prereq, prereq_unique_id), symbol);
+      if (!_is_tracing)
+      {
+        return;
+      }
+    }
+
     ::std::lock_guard<::std::mutex> guard(mtx);
 
     vertices.push_back(prereq_unique_id);
@@ -136,6 +173,24 @@ public:
       return;
     }
 
+    if (is_trace_recording())
+    {
+      // Edges of discarded vertices are filtered out by the analyzer
+      auto& trace = trace_recorder::instance();
+      if (style != 1 || !trace.no_fence)
+      {
+        auto r  = new_trace_record(trace_record_kind::edge, id_from);
+        r.mode  = static_cast<uint8_t>(style);
+        r.id_to = id_to;
+        trace.record(r);
+      }
+
+      if (!_is_tracing)
+      {
+        return;
+      }
+    }
+
     ::std::lock_guard<::std::mutex> guard(mtx);
 
     if (is_discarded(id_from, guard) || is_discarded(id_to, guard))
@@ -158,6 +213,15 @@ public:
   template <typename task_type, typename data_type>
   void add_vertex(task_type t)
   {
+    if (is_trace_recording())
+    {
+      record_vertex<task_type, data_type>(t);
+      if (!_is_tracing)
+      {
+        return;
+      }
+    }
+
     // Do this work outside the critical section
     const auto remove_deps = getenv("CUDASTF_DOT_REMOVE_DATA_DEPS");
 
@@ -204,6 +268,22 @@ public:
   template <typename task_type>
   void add_vertex_timing(task_type t, float time_ms, int device = -1)
   {
+    if (is_trace_recording())
+    {
+      if (tracing_enabled)
+      {
+        auto r    = new_trace_record(trace_record_kind::timing, t.get_unique_id());
+        r.device  = static_cast<int16_t>(device);
+        r.time_ms = time_ms;
+        trace_recorder::instance().record(r);
+      }
+
+      if (!_is_tracing)
+      {
+        return;
+      }
+    }
+
     ::std::lock_guard<::std::mutex> guard(mtx);
 
     if (!tracing_enabled)
@@ -225,8 +305,8 @@ public:
     {
       int dev;
       cuda_safe_call(cudaGetDevice(&dev));
-      EXPECT(dev < sizeof(colors) / sizeof(*colors));
-      current_color = colors[dev];
+      EXPECT(dev < sizeof(device_colors) / sizeof(*device_colors));
+      current_color = device_colors[dev];
     }
   }
 
@@ -273,6 +353,12 @@ public:
 
   static void set_parent_ctx(::std::shared_ptr<per_ctx_dot> parent_dot, ::std::shared_ptr<per_ctx_dot> child_dot)
   {
+    if (parent_dot->is_trace_recording() && child_dot->is_trace_recording())
+    {
+      trace_recorder::instance().record(
+        child_dot->new_trace_record(trace_record_kind::context_parent, parent_dot->trace_ctx_id));
+    }
+
     parent_dot->children.push_back(child_dot);
     child_dot->parent = mv(parent_dot);
   }
@@ -286,6 +372,51 @@ public:
   }
 
 private:
+  trace_record new_trace_record(trace_record_kind kind, int id = -1) const
+  {
+    trace_record r{};
+    r.kind = kind;
+    r.ctx  = trace_ctx_id;
+    r.id   = id;
+    return r;
+  }
+
+  // Record a task in the binary trace, which only keeps raw values that are formatted by the analyzer
+  template <typename task_type, typename data_type>
+  void record_vertex(task_type& t)
+  {
+    auto& trace  = trace_recorder::instance();
+    const int id = t.get_unique_id();
+
+    if (!tracing_enabled)
+    {
+      trace.record(new_trace_record(trace_record_kind::discard, id));
+      return;
+    }
+
+    int dev = -1;
+    if (trace.color_by_device)
+    {
+      cuda_safe_call(cudaGetDevice(&dev));
+    }
+
+    auto r   = new_trace_record(trace_record_kind::task, id);
+    r.device = static_cast<int16_t>(dev);
+    trace.record(r, t.get_symbol());
+
+    if (!trace.remove_data_deps)
+    {
+      for (auto& e : t.get_task_deps())
+      {
+        data_type d = e.get_data();
+        auto dep    = new_trace_record(trace_record_kind::task_dep, id);
+        dep.mode    = static_cast<uint8_t>(e.get_access_mode());
+        dep.size    = d.get_data_interface().data_footprint();
+        trace.record(dep, d.get_symbol());
+      }
+    }
+  }
+
   mutable ::std::string ctx_symbol;
 
   mutable ::std::mutex mtx;
@@ -298,11 +429,18 @@ public:
   // Keep track of existing edges, to make the output possibly look better
   IntPairSet existing_edges;
 
+  // Whether tasks must be reported, either for the DOT file or for the binary trace
   bool is_tracing() const
   {
-    return _is_tracing;
+    return _is_tracing || is_trace_recording();
   }
   bool _is_tracing;
+  bool is_trace_recording() const
+  {
+    return trace_ctx_id >= 0;
+  }
+  // Identifier of this context in the binary trace, -1 if there is no trace
+  int trace_ctx_id = -1;
   bool is_tracing_prereqs() const
   {
     return _is_tracing_prereqs;
@@ -318,9 +456,6 @@ public:
   // We may temporarily discard some tasks
   bool tracing_enabled = true;
 
-  // A palette of colors
-  const char* const colors[8] = {"#ff5500", "#66ccff", "#9933cc", "#00cc66", "#ffcc00", "#00b3e6", "#cc0066", "#009933"};
-
   const char* current_color = "white";
 
 public: // XXX protected, friend : dot
@@ -337,12 +472,15 @@ protected:
   dot()
   {
     const char* filename = getenv("CUDASTF_DOT_FILE");
-    if (!filename)
+    if (filename)
+    {
+      dot_filename = filename;
+    }
+    else if (!trace_recorder::instance().is_tracing())
     {
       return;
     }
 
-    dot_filename = filename;
     //::std::cout << "Creating a DOT file in " << filename << ::std::endl;
 
     const char* ignore_prereqs_str = getenv("CUDASTF_DOT_IGNORE_PREREQS");
@@ -447,7 +585,7 @@ public:
           if (p.second.timing.has_value())
           {
             float ms       = p.second.timing.value();
-            p.second.color = get_color_for_duration(ms, avg);
+            p.second.color = color_for_duration(ms, avg);
             p.second.label += "\ntiming: " + ::std::to_string(ms) + " ms\n";
           }
         }
@@ -546,38 +684,6 @@ public:
   ::std::vector<::std::shared_ptr<per_ctx_dot>> per_ctx;
 
 private:
-  // Function to get a color based on task duration relative to the average
-  ::std::string get_color_for_duration(double duration, double avg_duration)
-  {
-    // Define thresholds relative to the average duration
-    const double very_short_threshold = 0.5 * avg_duration; // < 50% of avg
-    const double short_threshold      = 0.8 * avg_duration; // < 80% of avg
-    const double long_threshold       = 1.5 * avg_duration; // > 150% of avg
-    const double very_long_threshold  = 2.0 * avg_duration; // > 200% of avg
-
-    // Return color based on duration thresholds
-    if (duration < very_short_threshold)
-    {
-      return "#b6e3b6"; // Light Green for Very Short tasks
-    }
-    else if (duration < short_threshold)
-    {
-      return "#69b369"; // Green for Short tasks
-    }
-    else if (duration <= long_threshold)
-    {
-      return "#ffd966"; // Yellow for Around Average tasks
-    }
-    else if (duration <= very_long_threshold)
-    {
-      return "#ffb84d"; // Orange for Long tasks
-    }
-    else
-    {
-      return "#ff6666"; // Red for Very Long tasks
-    }
-  }
-
   bool reachable(int from, int to, ::std::unordered_set<int>& visited)
   {
     visited.insert(to);
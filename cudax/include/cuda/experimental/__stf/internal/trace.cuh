@@ -0,0 +1,323 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDASTF in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ * @file
+ *
+ * @brief Records the task graph in a compact binary trace which is analyzed offline
+ *
+ * Generating a DOT file directly formats every vertex under a lock while the application runs, and keeps all the
+ * text in memory. With CUDASTF_TRACE_FILE, every thread instead appends fixed-size records to its own buffer, and
+ * the buffers are written as-is when the program exits. The trace is then turned into a DOT file or into a Chrome
+ * trace by the analyzer defined in trace_analyzer.cuh.
+ *
+ * CUDASTF_TRACE_FILE
+ */
+
+#pragma once
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__stf/internal/constants.cuh>
+#include <cuda/experimental/__stf/utility/traits.cuh>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace cuda::experimental::stf::reserved
+{
+
+/**
+ * @brief The different kinds of entries of a trace
+ */
+enum class trace_record_kind : uint8_t
+{
+  context, // a new context `ctx`, with an optional symbol
+  context_parent, // context `ctx` is nested in context `id`
+  task, // a task vertex `id` named after `label`, executed on `device`
+  task_dep, // task `id` accesses the logical data `label` of `size` bytes with access mode `mode`
+  prereq, // an asynchronous operation vertex `id` named after `label`
+  fence, // a task fence vertex `id`
+  edge, // a dependency from `id` to `id_to`, `mode` is the style of the edge
+  timing, // task `id` took `time_ms` milliseconds on `device`
+  discard, // vertex `id` and its edges must be ignored
+};
+
+/**
+ * @brief A fixed-size entry of a trace
+ *
+ * Strings are not stored in the record, but in the string pool of the buffer that contains it.
+ */
+struct trace_record
+{
+  trace_record_kind kind;
+  // Access mode of a task_dep, or style of an edge (0 = plain, 1 = dashed)
+  uint8_t mode   = 0;
+  int16_t device = -1;
+  int32_t ctx    = -1;
+  int32_t id     = -1;
+  int32_t id_to  = -1;
+  // Offset of a NUL-terminated string in the string pool, or `no_label`
+  uint32_t label = no_label;
+  float time_ms  = 0.0f;
+  uint64_t size  = 0;
+
+  static constexpr uint32_t no_label = ~uint32_t(0);
+};
+
+static_assert(sizeof(trace_record) == 32, "trace records are written as-is in trace files");
+static_assert(::std::is_trivially_copyable_v<trace_record>);
+
+/**
+ * @brief Layout of the trace files
+ *
+ * A header made of `magic`, `version` and the number of buffers (all `uint32_t` but the magic) is followed by every
+ * buffer, each starting with its number of records and the size of its string pool (both `uint64_t`), followed by
+ * the records and the string pool. Trace files use the byte order of the machine which produced them.
+ */
+struct trace_file_format
+{
+  static constexpr char magic[8]    = {'S', 'T', 'F', 'T', 'R', 'A', 'C', 'E'};
+  static constexpr uint32_t version = 1;
+};
+
+/**
+ * @brief A sequence of trace records and the strings they refer to
+ *
+ * Strings are interned, so that the symbol of a logical data or a task which is used over and over only takes up
+ * the string pool once.
+ */
+class trace_buffer
+{
+public:
+  void push(trace_record r)
+  {
+    records.push_back(r);
+  }
+
+  void push(trace_record r, ::std::string_view label)
+  {
+    r.label = add_string(label);
+    records.push_back(r);
+  }
+
+  uint32_t add_string(::std::string_view s)
+  {
+    const auto [it, inserted] = string_offsets.try_emplace(::std::string(s), static_cast<uint32_t>(strings.size()));
+    if (inserted)
+    {
+      strings.append(s);
+      strings.push_back('\0');
+    }
+    return it->second;
+  }
+
+  void write(::std::ostream& os) const
+  {
+    const uint64_t record_cnt  = records.size();
+    const uint64_t strings_len = strings.size();
+    os.write(reinterpret_cast<const char*>(&record_cnt), sizeof(record_cnt));
+    os.write(reinterpret_cast<const char*>(&strings_len), sizeof(strings_len));
+    os.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(trace_record));
+    os.write(strings.data(), strings.size());
+  }
+
+  void clear()
+  {
+    records.clear();
+    strings.clear();
+    string_offsets.clear();
+  }
+
+  ::std::vector<trace_record> records;
+  ::std::string strings;
+
+private:
+  // Offset of every string of the pool
+  ::std::unordered_map<::std::string, uint32_t> string_offsets;
+};
+
+inline void write_trace_header(::std::ostream& os, uint32_t buffer_cnt)
+{
+  os.write(trace_file_format::magic, sizeof(trace_file_format::magic));
+  os.write(reinterpret_cast<const char*>(&trace_file_format::version), sizeof(uint32_t));
+  os.write(reinterpret_cast<const char*>(&buffer_cnt), sizeof(buffer_cnt));
+}
+
+/**
+ * @brief Collects the trace of all contexts when CUDASTF_TRACE_FILE is set
+ *
+ * Each thread appends to a buffer of its own, so that recording does not take any lock once a thread has registered
+ * its buffer. The buffers are written to the trace file when the program exits, or when `finish` is called.
+ */
+class trace_recorder : public reserved::meyers_singleton<trace_recorder>
+{
+protected:
+  trace_recorder()
+  {
+    const char* filename = getenv("CUDASTF_TRACE_FILE");
+    if (!filename)
+    {
+      return;
+    }
+
+    trace_filename = filename;
+
+    // These are looked up once here rather than for every vertex
+    no_fence         = getenv("CUDASTF_DOT_NO_FENCE") != nullptr;
+    remove_data_deps = getenv("CUDASTF_DOT_REMOVE_DATA_DEPS") != nullptr;
+    color_by_device  = getenv("CUDASTF_DOT_COLOR_BY_DEVICE") != nullptr;
+  }
+
+  ~trace_recorder()
+  {
+    finish();
+  }
+
+public:
+  bool is_tracing() const
+  {
+    return !trace_filename.empty();
+  }
+
+  // Returns a new identifier, used to find which context recorded a vertex
+  int new_context_id()
+  {
+    return ctx_cnt++;
+  }
+
+  void record(const trace_record& r)
+  {
+    local_buffer().push(r);
+  }
+
+  void record(const trace_record& r, ::std::string_view label)
+  {
+    local_buffer().push(r, label);
+  }
+
+  // Write the trace file. This should not need to be called explicitly, unless we are doing some automatic tests
+  // for example, in which case no thread may be recording at the same time.
+  void finish()
+  {
+    ::std::lock_guard<::std::mutex> guard(mtx);
+
+    if (trace_filename.empty())
+    {
+      return;
+    }
+
+    ::std::ofstream out(trace_filename, ::std::ios::binary);
+    if (out.is_open())
+    {
+      write_trace_header(out, static_cast<uint32_t>(buffers.size()));
+      for (const auto& b : buffers)
+      {
+        b->write(out);
+      }
+    }
+    else
+    {
+      ::std::cerr << "Unable to open file: " << trace_filename << ::std::endl;
+    }
+
+    for (auto& b : buffers)
+    {
+      b->clear();
+    }
+
+    trace_filename.clear();
+  }
+
+  bool no_fence         = false;
+  bool remove_data_deps = false;
+  bool color_by_device  = false;
+
+private:
+  trace_buffer& local_buffer()
+  {
+    // Buffers are owned by the recorder, so that the records of threads which are already gone are still written
+    thread_local trace_buffer* buffer = nullptr;
+    if (!buffer)
+    {
+      ::std::lock_guard<::std::mutex> guard(mtx);
+      buffer = buffers.emplace_back(::std::make_unique<trace_buffer>()).get();
+    }
+    return *buffer;
+  }
+
+  ::std::vector<::std::unique_ptr<trace_buffer>> buffers;
+
+  ::std::atomic<int> ctx_cnt = 0;
+
+  ::std::mutex mtx;
+
+  ::std::string trace_filename;
+};
+
+/**
+ * @brief A palette of colors used to distinguish devices in the generated graphs
+ */
+inline constexpr const char* device_colors[8] = {
+  "#ff5500", "#66ccff", "#9933cc", "#00cc66", "#ffcc00", "#00b3e6", "#cc0066", "#009933"};
+
+/**
+ * @brief Get a color based on task duration relative to the average
+ */
+inline const char* color_for_duration(double duration, double avg_duration)
+{
+  // Define thresholds relative to the average duration
+  const double very_short_threshold = 0.5 * avg_duration; // < 50% of avg
+  const double short_threshold      = 0.8 * avg_duration; // < 80% of avg
+  const double long_threshold       = 1.5 * avg_duration; // > 150% of avg
+  const double very_long_threshold  = 2.0 * avg_duration; // > 200% of avg
+
+  // Return color based on duration thresholds
+  if (duration < very_short_threshold)
+  {
+    return "#b6e3b6"; // Light Green for Very Short tasks
+  }
+  else if (duration < short_threshold)
+  {
+    return "#69b369"; // Green for Short tasks
+  }
+  else if (duration <= long_threshold)
+  {
+    return "#ffd966"; // Yellow for Around Average tasks
+  }
+  else if (duration <= very_long_threshold)
+  {
+    return "#ffb84d"; // Orange for Long tasks
+  }
+  else
+  {
+    return "#ff6666"; // Red for Very Long tasks
+  }
+}
+
+} // namespace cuda::experimental::stf::reserved
@@ -0,0 +1,1013 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDASTF in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ * @file
+ *
+ * @brief Offline analysis of the binary traces written when CUDASTF_TRACE_FILE is set
+ *
+ * The trace is turned into a compact graph where vertices are numbered densely and edges are stored as sorted
+ * predecessor lists. Redundant edges are removed in topological order, the critical path is computed with a single
+ * pass over that order, and the result is written as a DOT file or as a Chrome trace (chrome://tracing, Perfetto).
+ */
+
+#pragma once
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__stf/internal/constants.cuh>
+#include <cuda/experimental/__stf/internal/trace.cuh>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace cuda::experimental::stf::reserved
+{
+
+/**
+ * @brief The task graph described by one or more trace buffers
+ *
+ * Records are added with `add` (or read from a file), then `build` indexes the graph. All the analyses are linear in
+ * the size of the graph, except `remove_redundant_edges` which only explores, for every vertex, the vertices that lie
+ * between its oldest predecessor and itself in topological order. As tasks mostly depend on recently submitted ones,
+ * this is close to linear in practice.
+ */
+class trace_graph
+{
+public:
+  trace_graph() = default;
+
+  /**
+   * @brief Read and index a trace file
+   *
+   * @throws ::std::runtime_error if the file cannot be read or is not a valid trace
+   */
+  explicit trace_graph(const ::std::string& filename)
+  {
+    ::std::ifstream in(filename, ::std::ios::binary);
+    if (!in)
+    {
+      throw ::std::runtime_error("Unable to open trace file: " + filename);
+    }
+    read(in);
+    build();
+  }
+
+  // Read all the buffers of a trace
+  void read(::std::istream& in)
+  {
+    char magic[sizeof(trace_file_format::magic)];
+    uint32_t version    = 0;
+    uint32_t buffer_cnt = 0;
+    in.read(magic, sizeof(magic));
+    read_value(in, version);
+    read_value(in, buffer_cnt);
+    if (!in || ::std::memcmp(magic, trace_file_format::magic, sizeof(magic)) != 0)
+    {
+      throw ::std::runtime_error("Not a CUDASTF trace");
+    }
+    if (version != trace_file_format::version)
+    {
+      throw ::std::runtime_error("Unsupported CUDASTF trace version " + ::std::to_string(version));
+    }
+
+    ::std::vector<trace_record> records;
+    ::std::string strings;
+    for (uint32_t b = 0; b < buffer_cnt; b++)
+    {
+      uint64_t record_cnt  = 0;
+      uint64_t strings_len = 0;
+      read_value(in, record_cnt);
+      read_value(in, strings_len);
+      if (!in)
+      {
+        throw ::std::runtime_error("Truncated CUDASTF trace");
+      }
+
+      records.resize(record_cnt);
+      strings.resize(strings_len);
+      in.read(reinterpret_cast<char*>(records.data()), record_cnt * sizeof(trace_record));
+      in.read(strings.data(), strings_len);
+      if (!in)
+      {
+        throw ::std::runtime_error("Truncated CUDASTF trace");
+      }
+
+      add(records.data(), records.size(), strings);
+    }
+  }
+
+  // Add the records of a buffer, their labels are offsets in `strings`
+  void add(const trace_record* records, size_t cnt, const ::std::string& strings)
+  {
+    for (size_t i = 0; i < cnt; i++)
+    {
+      const trace_record& r = records[i];
+
+      ::std::string label;
+      if (r.label != trace_record::no_label)
+      {
+        if (r.label >= strings.size())
+        {
+          throw ::std::runtime_error("Invalid label in CUDASTF trace");
+        }
+        label = strings.c_str() + r.label;
+      }
+
+      switch (r.kind)
+      {
+        case trace_record_kind::context:
+          if (!label.empty())
+          {
+            context_at(r.ctx).symbol = mv(label);
+          }
+          else
+          {
+            context_at(r.ctx);
+          }
+          break;
+        case trace_record_kind::context_parent:
+          context_at(r.id);
+          context_at(r.ctx).parent = r.id;
+          break;
+        case trace_record_kind::task: {
+          auto& v  = vertex_at(r.id);
+          v.kind   = vertex_kind::task;
+          v.ctx    = r.ctx;
+          v.label  = mv(label);
+          v.device = r.device >= 0 ? r.device : v.device;
+          break;
+        }
+        case trace_record_kind::task_dep:
+          if (r.mode > static_cast<uint8_t>(access_mode::relaxed))
+          {
+            throw ::std::runtime_error("Invalid access mode in CUDASTF trace");
+          }
+          vertex_at(r.id).deps += "\\n" + label + "(" + access_mode_string(access_mode(r.mode)) + ")("
+                                + ::std::to_string(r.size) + ") ";
+          break;
+        case trace_record_kind::prereq: {
+          auto& v = vertex_at(r.id);
+          v.kind  = vertex_kind::prereq;
+          v.ctx   = r.ctx;
+          v.label = mv(label);
+          break;
+        }
+        case trace_record_kind::fence: {
+          auto& v = vertex_at(r.id);
+          v.kind  = vertex_kind::fence;
+          v.ctx   = r.ctx;
+          break;
+        }
+        case trace_record_kind::edge:
+          edges.emplace_back(vertex_index(r.id), vertex_index(r.id_to));
+          break;
+        case trace_record_kind::timing: {
+          auto& v  = vertex_at(r.id);
+          v.timing = r.time_ms;
+          v.device = r.device >= 0 ? r.device : v.device;
+          break;
+        }
+        case trace_record_kind::discard:
+          vertex_at(r.id).discarded = true;
+          break;
+        default:
+          throw ::std::runtime_error("Invalid record in CUDASTF trace");
+      }
+    }
+  }
+
+  /**
+   * @brief Index the graph once all records were added
+   *
+   * Duplicate edges and edges of discarded vertices are dropped, then vertices are sorted topologically and the
+   * critical path is computed.
+   */
+  void build()
+  {
+    const size_t n = vertices.size();
+
+    edges.erase(::std::remove_if(edges.begin(),
+                                 edges.end(),
+                                 [&](const auto& e) {
+                                   return e.first == e.second || vertices[e.first].discarded
+                                       || vertices[e.second].discarded;
+                                 }),
+                edges.end());
+
+    // Sort by destination so that the predecessors of a vertex are contiguous
+    ::std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) {
+      return ::std::tie(a.second, a.first) < ::std::tie(b.second, b.first);
+    });
+    edges.erase(::std::unique(edges.begin(), edges.end()), edges.end());
+
+    pred_offsets.assign(n + 1, 0);
+    preds.resize(edges.size());
+    for (size_t i = 0; i < edges.size(); i++)
+    {
+      pred_offsets[edges[i].second + 1]++;
+      preds[i] = edges[i].first;
+    }
+    for (size_t v = 0; v < n; v++)
+    {
+      pred_offsets[v + 1] += pred_offsets[v];
+    }
+    edges.clear();
+
+    sort_topologically();
+    compute_critical_path();
+  }
+
+  /**
+   * @brief Remove the edges implied by other paths (transitive reduction)
+   *
+   * Vertices are visited in topological order. The predecessors of a vertex are considered from the most recent to
+   * the oldest one: a predecessor which was already reached from a more recent predecessor is redundant, otherwise
+   * its edge is kept and its ancestors are marked, without going past the oldest predecessor.
+   *
+   * @return The number of edges removed
+   */
+  size_t remove_redundant_edges()
+  {
+    const size_t n = vertices.size();
+    if (order.size() != n)
+    {
+      // There is a cycle, so there is no transitive reduction
+      return 0;
+    }
+
+    // Edges kept for vertex v are in [pred_offsets[v], pred_ends[v])
+    ::std::vector<size_t> pred_ends(pred_offsets.begin() + 1, pred_offsets.end());
+    ::std::vector<size_t> mark(n, ::std::numeric_limits<size_t>::max());
+    ::std::vector<size_t> stack;
+
+    for (size_t v : order)
+    {
+      const auto begin = preds.begin() + pred_offsets[v];
+      const auto end   = preds.begin() + pred_offsets[v + 1];
+      if (end - begin < 2)
+      {
+        continue;
+      }
+
+      ::std::sort(begin, end, [&](size_t a, size_t b) {
+        return position[a] > position[b];
+      });
+      const size_t oldest = position[*(end - 1)];
+
+      auto kept = begin;
+      for (auto it = begin; it != end; ++it)
+      {
+        const size_t p = *it;
+        if (mark[p] == v)
+        {
+          continue;
+        }
+
+        // Kept predecessors are only overwritten once they have been read
+        *kept++ = p;
+
+        mark[p] = v;
+        stack.push_back(p);
+        while (!stack.empty())
+        {
+          const size_t u = stack.back();
+          stack.pop_back();
+          for (size_t k = pred_offsets[u]; k < pred_ends[u]; k++)
+          {
+            const size_t q = preds[k];
+            if (position[q] >= oldest && mark[q] != v)
+            {
+              mark[q] = v;
+              stack.push_back(q);
+            }
+          }
+        }
+      }
+      pred_ends[v] = kept - preds.begin();
+    }
+
+    // Compact the predecessor lists
+    size_t cnt = 0;
+    for (size_t v = 0; v < n; v++)
+    {
+      const size_t begin = pred_offsets[v];
+      pred_offsets[v]    = cnt;
+      for (size_t k = begin; k < pred_ends[v]; k++)
+      {
+        preds[cnt++] = preds[k];
+      }
+    }
+    pred_offsets[n] = cnt;
+
+    const size_t removed = preds.size() - cnt;
+    preds.resize(cnt);
+    return removed;
+  }
+
+  // Number of vertices which were not discarded
+  size_t vertex_count() const
+  {
+    return ::std::count_if(vertices.begin(), vertices.end(), [](const auto& v) {
+      return !v.discarded;
+    });
+  }
+
+  size_t edge_count() const
+  {
+    return preds.size();
+  }
+
+  bool has_edge(int from, int to) const
+  {
+    const auto f = index.find(from);
+    const auto t = index.find(to);
+    if (f == index.end() || t == index.end())
+    {
+      return false;
+    }
+    return ::std::find(preds.begin() + pred_offsets[t->second], preds.begin() + pred_offsets[t->second + 1], f->second)
+        != preds.begin() + pred_offsets[t->second + 1];
+  }
+
+  // Total work (T1 in Cilk terminology), the sum of the durations of all tasks
+  float total_work() const
+  {
+    return t1;
+  }
+
+  // Length of the critical path (Tinf in Cilk terminology)
+  float critical_path_length() const
+  {
+    return tinf;
+  }
+
+  // Identifiers of the vertices of the critical path, from the first to the last one
+  ::std::vector<int> critical_path() const
+  {
+    ::std::vector<int> result;
+    for (size_t v = critical_end; v != npos; v = critical_pred[v])
+    {
+      result.push_back(vertices[v].id);
+    }
+    ::std::reverse(result.begin(), result.end());
+    return result;
+  }
+
+  /**
+   * @brief Write the graph in the DOT format, similar to what is generated by CUDASTF_DOT_FILE
+   */
+  void print_dot(::std::ostream& os) const
+  {
+    os << "digraph {\n";
+
+    // Colors of timed tasks depend on their duration relative to the average
+    size_t timed_cnt = 0;
+    for (const auto& v : vertices)
+    {
+      timed_cnt += !v.discarded && v.timing.has_value();
+    }
+    const float avg_duration = timed_cnt > 0 ? t1 / timed_cnt : 0.0f;
+
+    // Vertices are grouped by context, nested contexts are displayed within their parent
+    ::std::vector<::std::vector<size_t>> per_ctx(contexts.size());
+    for (size_t v = 0; v < vertices.size(); v++)
+    {
+      const auto& vertex = vertices[v];
+      if (vertex.discarded)
+      {
+        continue;
+      }
+      if (vertex.ctx >= 0 && size_t(vertex.ctx) < contexts.size())
+      {
+        per_ctx[vertex.ctx].push_back(v);
+      }
+      else
+      {
+        print_vertex(os, v, avg_duration);
+      }
+    }
+
+    const bool display_clusters = contexts.size() > 1;
+    ::std::vector<::std::vector<size_t>> children(contexts.size());
+    for (size_t c = 0; c < contexts.size(); c++)
+    {
+      const int parent = contexts[c].parent;
+      if (parent >= 0 && size_t(parent) < contexts.size())
+      {
+        children[parent].push_back(c);
+      }
+    }
+
+    ::std::function<void(size_t)> print_context = [&](size_t c) {
+      if (display_clusters)
+      {
+        os << "subgraph cluster_" << c << " {\n";
+      }
+      for (size_t v : per_ctx[c])
+      {
+        print_vertex(os, v, avg_duration);
+      }
+      for (size_t child : children[c])
+      {
+        print_context(child);
+      }
+      if (display_clusters)
+      {
+        if (contexts[c].symbol.empty())
+        {
+          os << "label=\"cluster_" << c << "\"\n";
+        }
+        else
+        {
+          os << "label=\"" << contexts[c].symbol << "\"\n";
+        }
+        os << "} // end subgraph cluster_" << c << "\n";
+      }
+    };
+
+    for (size_t c = 0; c < contexts.size(); c++)
+    {
+      const int parent = contexts[c].parent;
+      if (parent < 0 || size_t(parent) >= contexts.size())
+      {
+        print_context(c);
+      }
+    }
+
+    for (size_t v = 0; v < vertices.size(); v++)
+    {
+      for (size_t k = pred_offsets[v]; k < pred_offsets[v + 1]; k++)
+      {
+        os << "\"NODE_" << vertices[preds[k]].id << "\" -> \"NODE_" << vertices[v].id << "\"\n";
+      }
+    }
+
+    if (has_timing)
+    {
+      for (int id : critical_path())
+      {
+        os << "\"NODE_" << id << "\" [color=red, penwidth=10]\n";
+      }
+      os << "// T1 = " << t1 << "\n";
+      os << "// Tinf = " << tinf << "\n";
+    }
+
+    os << "}\n";
+  }
+
+  /**
+   * @brief Write the timed tasks in the Chrome trace event format
+   *
+   * Traces only contain durations, so every task is displayed at the earliest time it could start given the
+   * durations of the tasks it depends on. Tasks are grouped by device, and tasks which would overlap on the same
+   * device are spread over several rows.
+   */
+  void print_chrome_trace(::std::ostream& os) const
+  {
+    ::std::vector<size_t> timed;
+    for (size_t v = 0; v < vertices.size(); v++)
+    {
+      if (!vertices[v].discarded && vertices[v].timing.has_value())
+      {
+        timed.push_back(v);
+      }
+    }
+    ::std::sort(timed.begin(), timed.end(), [&](size_t a, size_t b) {
+      return earliest_start[a] < earliest_start[b];
+    });
+
+    ::std::vector<bool> critical(vertices.size(), false);
+    for (size_t v = critical_end; v != npos; v = critical_pred[v])
+    {
+      critical[v] = true;
+    }
+
+    // End of the last task of each row, per device (devices are shifted by one so that -1 is "unknown")
+    ::std::vector<::std::vector<float>> rows;
+
+    // Print timestamps without exponent, and restore the state of the stream in the end
+    const auto flags     = os.flags();
+    const auto precision = os.precision();
+    os << ::std::fixed << ::std::setprecision(3);
+
+    os << "{\"traceEvents\":[";
+    const char* sep = "\n";
+    for (size_t v : timed)
+    {
+      const auto& vertex = vertices[v];
+      const size_t pid   = vertex.device + 1;
+      if (pid >= rows.size())
+      {
+        rows.resize(pid + 1);
+      }
+
+      const float start = earliest_start[v];
+      const float dur   = *vertex.timing;
+      auto& device_rows = rows[pid];
+      size_t tid        = 0;
+      while (tid < device_rows.size() && device_rows[tid] > start)
+      {
+        tid++;
+      }
+      if (tid == device_rows.size())
+      {
+        device_rows.push_back(0.0f);
+      }
+      device_rows[tid] = start + dur;
+
+      // Timestamps are in microseconds
+      os << sep << "{\"name\":\"" << json_escape(vertex.label) << "\",\"cat\":\"task\",\"ph\":\"X\",\"ts\":"
+         << start * 1000.0 << ",\"dur\":" << dur * 1000.0 << ",\"pid\":" << pid << ",\"tid\":" << tid
+         << ",\"args\":{\"id\":" << vertex.id << ",\"critical\":" << (critical[v] ? "true" : "false") << "}}";
+      sep = ",\n";
+    }
+
+    for (size_t pid = 0; pid < rows.size(); pid++)
+    {
+      if (!rows[pid].empty())
+      {
+        os << sep << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"args\":{\"name\":\""
+           << (pid == 0 ? ::std::string("unknown device") : "device " + ::std::to_string(pid - 1)) << "\"}}";
+        sep = ",\n";
+      }
+    }
+
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+private:
+  enum class vertex_kind
+  {
+    unknown, // only seen in edges
+    task,
+    prereq,
+    fence,
+  };
+
+  struct vertex_info
+  {
+    int id           = -1;
+    vertex_kind kind = vertex_kind::unknown;
+    int ctx          = -1;
+    int device       = -1;
+    bool discarded   = false;
+    ::std::string label;
+    ::std::string deps;
+    ::std::optional<float> timing;
+  };
+
+  struct context_info
+  {
+    ::std::string symbol;
+    int parent = -1;
+  };
+
+  static constexpr size_t npos = ::std::numeric_limits<size_t>::max();
+
+  template <typename T>
+  static void read_value(::std::istream& in, T& value)
+  {
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  size_t vertex_index(int id)
+  {
+    auto [it, inserted] = index.emplace(id, vertices.size());
+    if (inserted)
+    {
+      vertices.emplace_back().id = id;
+    }
+    return it->second;
+  }
+
+  vertex_info& vertex_at(int id)
+  {
+    return vertices[vertex_index(id)];
+  }
+
+  context_info& context_at(int ctx)
+  {
+    if (ctx < 0)
+    {
+      throw ::std::runtime_error("Invalid context in CUDASTF trace");
+    }
+    if (size_t(ctx) >= contexts.size())
+    {
+      contexts.resize(ctx + 1);
+    }
+    return contexts[ctx];
+  }
+
+  // Kahn's algorithm, where ready vertices are taken by increasing identifier so that the order remains close to
+  // the order of submission. Vertices in a cycle, if any, are left out of `order`.
+  void sort_topologically()
+  {
+    const size_t n = vertices.size();
+
+    ::std::vector<size_t> succ_offsets(n + 1, 0);
+    for (size_t p : preds)
+    {
+      succ_offsets[p + 1]++;
+    }
+    for (size_t v = 0; v < n; v++)
+    {
+      succ_offsets[v + 1] += succ_offsets[v];
+    }
+    ::std::vector<size_t> succs(preds.size());
+    ::std::vector<size_t> fill(succ_offsets.begin(), succ_offsets.end() - 1);
+    ::std::vector<size_t> indegree(n);
+    for (size_t v = 0; v < n; v++)
+    {
+      indegree[v] = pred_offsets[v + 1] - pred_offsets[v];
+      for (size_t k = pred_offsets[v]; k < pred_offsets[v + 1]; k++)
+      {
+        succs[fill[preds[k]]++] = v;
+      }
+    }
+
+    using entry = ::std::pair<int, size_t>;
+    ::std::priority_queue<entry, ::std::vector<entry>, ::std::greater<entry>> ready;
+    for (size_t v = 0; v < n; v++)
+    {
+      if (indegree[v] == 0)
+      {
+        ready.emplace(vertices[v].id, v);
+      }
+    }
+
+    order.clear();
+    order.reserve(n);
+    position.assign(n, npos);
+    while (!ready.empty())
+    {
+      const size_t u = ready.top().second;
+      ready.pop();
+      position[u] = order.size();
+      order.push_back(u);
+      for (size_t k = succ_offsets[u]; k < succ_offsets[u + 1]; k++)
+      {
+        const size_t v = succs[k];
+        if (--indegree[v] == 0)
+        {
+          ready.emplace(vertices[v].id, v);
+        }
+      }
+    }
+  }
+
+  // Longest path in the graph, where each vertex weighs its measured duration (if any)
+  void compute_critical_path()
+  {
+    const size_t n = vertices.size();
+
+    t1         = 0.0f;
+    has_timing = false;
+    for (const auto& v : vertices)
+    {
+      if (!v.discarded && v.timing.has_value())
+      {
+        t1 += *v.timing;
+        has_timing = true;
+      }
+    }
+
+    ::std::vector<float> dist(n, 0.0f);
+    earliest_start.assign(n, 0.0f);
+    critical_pred.assign(n, npos);
+    critical_end = npos;
+    tinf         = 0.0f;
+
+    for (size_t v : order)
+    {
+      float start = 0.0f;
+      for (size_t k = pred_offsets[v]; k < pred_offsets[v + 1]; k++)
+      {
+        const size_t p = preds[k];
+        if (dist[p] > start)
+        {
+          start            = dist[p];
+          critical_pred[v] = p;
+        }
+      }
+      earliest_start[v] = start;
+      dist[v]           = start + vertices[v].timing.value_or(0.0f);
+
+      if (dist[v] > tinf)
+      {
+        tinf         = dist[v];
+        critical_end = v;
+      }
+    }
+  }
+
+  void print_vertex(::std::ostream& os, size_t v, float avg_duration) const
+  {
+    const auto& vertex = vertices[v];
+    os << "\"NODE_" << vertex.id << "\"";
+    switch (vertex.kind)
+    {
+      case vertex_kind::task: {
+        const char* color = "white";
+        if (has_timing && vertex.timing.has_value())
+        {
+          color = color_for_duration(*vertex.timing, avg_duration);
+        }
+        else if (vertex.device >= 0 && size_t(vertex.device) < sizeof(device_colors) / sizeof(*device_colors))
+        {
+          color = device_colors[vertex.device];
+        }
+        os << " [style=\"filled\" fillcolor=\"" << color << "\" label=\"" << vertex.label << vertex.deps;
+        if (vertex.timing.has_value())
+        {
+          os << "\\ntiming: " << *vertex.timing << " ms";
+        }
+        os << "\"]";
+        break;
+      }
+      case vertex_kind::prereq:
+        os << " [label=\"" << vertex.label << "\", style=dashed]";
+        break;
+      case vertex_kind::fence:
+        os << " [style=\"filled\" fillcolor=\"red\" label=\"task fence\"]";
+        break;
+      default:
+        break;
+    }
+    os << "\n";
+  }
+
+  static ::std::string json_escape(const ::std::string& s)
+  {
+    ::std::string result;
+    for (char c : s)
+    {
+      switch (c)
+      {
+        case '"':
+          result += "\\\"";
+          break;
+        case '\\':
+          result += "\\\\";
+          break;
+        case '\n':
+          result += "\\n";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20)
+          {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            result += buf;
+          }
+          else
+          {
+            result += c;
+          }
+      }
+    }
+    return result;
+  }
+
+  ::std::vector<vertex_info> vertices;
+  ::std::unordered_map<int, size_t> index;
+  ::std::vector<context_info> contexts;
+
+  // Raw edges, until the graph is built
+  ::std::vector<::std::pair<size_t, size_t>> edges;
+
+  // Predecessors of vertex v are preds[pred_offsets[v]] ... preds[pred_offsets[v + 1] - 1]
+  ::std::vector<size_t> pred_offsets = {0};
+  ::std::vector<size_t> preds;
+
+  // Topological order, and position of every vertex in that order
+  ::std::vector<size_t> order;
+  ::std::vector<size_t> position;
+
+  bool has_timing = false;
+  float t1        = 0.0f;
+  float tinf      = 0.0f;
+  ::std::vector<float> earliest_start;
+  ::std::vector<size_t> critical_pred;
+  size_t critical_end = npos;
+};
+
+#ifdef UNITTESTED_FILE
+namespace reserved_trace_unittest
+{
+inline trace_record make_record(trace_record_kind kind, int id, int id_to = -1)
+{
+  trace_record r{};
+  r.kind  = kind;
+  r.ctx   = 0;
+  r.id    = id;
+  r.id_to = id_to;
+  return r;
+}
+
+// A graph of `n` tasks, with the given edges, and a timing of `timings[i]` ms for task `i` if provided
+inline trace_graph
+make_graph(int n, const ::std::vector<::std::pair<int, int>>& edges, const ::std::vector<float>& timings = {})
+{
+  trace_buffer buffer;
+  buffer.push(make_record(trace_record_kind::context, -1));
+  for (int i = 0; i < n; i++)
+  {
+    buffer.push(make_record(trace_record_kind::task, i), "task_" + ::std::to_string(i));
+    if (size_t(i) < timings.size())
+    {
+      auto r    = make_record(trace_record_kind::timing, i);
+      r.time_ms = timings[i];
+      buffer.push(r);
+    }
+  }
+  for (const auto& [from, to] : edges)
+  {
+    buffer.push(make_record(trace_record_kind::edge, from, to));
+  }
+
+  trace_graph g;
+  g.add(buffer.records.data(), buffer.records.size(), buffer.strings);
+  g.build();
+  return g;
+}
+} // namespace reserved_trace_unittest
+
+UNITTEST("trace_graph transitive reduction")
+{
+  using namespace reserved_trace_unittest;
+  // 0 -> 1 -> 2 -> 3 with shortcuts, and a duplicate edge
+  auto g = make_graph(4, {{0, 1}, {1, 2}, {0, 2}, {2, 3}, {0, 3}, {1, 3}, {0, 1}});
+  EXPECT(g.vertex_count() == 4);
+  EXPECT(g.edge_count() == 6);
+  EXPECT(g.remove_redundant_edges() == 3);
+  EXPECT(g.edge_count() == 3);
+  EXPECT(g.has_edge(0, 1));
+  EXPECT(g.has_edge(1, 2));
+  EXPECT(g.has_edge(2, 3));
+  EXPECT(!g.has_edge(0, 2));
+  EXPECT(!g.has_edge(0, 3));
+};
+
+UNITTEST("trace_graph transitive reduction keeps independent paths")
+{
+  using namespace reserved_trace_unittest;
+  // Two branches 0 -> 1 -> 3 and 0 -> 2 -> 3, with identifiers not in topological order
+  auto g = make_graph(5, {{4, 0}, {0, 1}, {0, 2}, {1, 3}, {2, 3}, {4, 3}});
+  EXPECT(g.remove_redundant_edges() == 1);
+  EXPECT(g.edge_count() == 5);
+  EXPECT(!g.has_edge(4, 3));
+};
+
+UNITTEST("trace_graph transitive reduction of a long chain")
+{
+  using namespace reserved_trace_unittest;
+  const int n = 100000;
+  ::std::vector<::std::pair<int, int>> edges;
+  for (int i = 0; i + 1 < n; i++)
+  {
+    edges.emplace_back(i, i + 1);
+    if (i + 2 < n)
+    {
+      edges.emplace_back(i, i + 2);
+    }
+  }
+  auto g = make_graph(n, edges);
+  EXPECT(g.remove_redundant_edges() == size_t(n - 2));
+  EXPECT(g.edge_count() == size_t(n - 1));
+};
+
+UNITTEST("trace_graph critical path")
+{
+  using namespace reserved_trace_unittest;
+  // 0 -> {1, 2} -> 3, the branch through 2 is longer
+  auto g = make_graph(4, {{0, 1}, {0, 2}, {1, 3}, {2, 3}}, {1.0f, 2.0f, 5.0f, 1.0f});
+  EXPECT(g.total_work() == 9.0f);
+  EXPECT(g.critical_path_length() == 7.0f);
+  EXPECT(g.critical_path() == ::std::vector<int>{0, 2, 3});
+};
+
+UNITTEST("trace_graph discarded vertices")
+{
+  using namespace reserved_trace_unittest;
+  trace_buffer buffer;
+  buffer.push(make_record(trace_record_kind::task, 0), "a");
+  buffer.push(make_record(trace_record_kind::discard, 1));
+  buffer.push(make_record(trace_record_kind::task, 2), "c");
+  buffer.push(make_record(trace_record_kind::edge, 0, 1));
+  buffer.push(make_record(trace_record_kind::edge, 1, 2));
+  buffer.push(make_record(trace_record_kind::edge, 0, 2));
+
+  trace_graph g;
+  g.add(buffer.records.data(), buffer.records.size(), buffer.strings);
+  g.build();
+  EXPECT(g.vertex_count() == 2);
+  EXPECT(g.edge_count() == 1);
+  EXPECT(g.has_edge(0, 2));
+};
+
+UNITTEST("trace_buffer interns strings")
+{
+  using namespace reserved_trace_unittest;
+  trace_buffer buffer;
+  buffer.push(make_record(trace_record_kind::task, 0), "update");
+  buffer.push(make_record(trace_record_kind::task, 1), "update");
+  buffer.push(make_record(trace_record_kind::task, 2), "up");
+  EXPECT(buffer.records[0].label == buffer.records[1].label);
+  EXPECT(buffer.records[2].label != buffer.records[0].label);
+  EXPECT(buffer.strings.size() == sizeof("update") + sizeof("up"));
+
+  buffer.clear();
+  EXPECT(buffer.add_string("up") == 0);
+};
+
+UNITTEST("trace file round trip")
+{
+  using namespace reserved_trace_unittest;
+  // Two buffers, as if recorded by two threads
+  trace_buffer first, second;
+  first.push(make_record(trace_record_kind::context, -1), "main");
+  first.push(make_record(trace_record_kind::task, 0), "produce");
+  auto dep = make_record(trace_record_kind::task_dep, 0);
+  dep.mode = static_cast<uint8_t>(access_mode::write);
+  dep.size = 64;
+  first.push(dep, "A");
+  second.push(make_record(trace_record_kind::task, 1), "consume");
+  second.push(make_record(trace_record_kind::edge, 0, 1));
+  auto timing    = make_record(trace_record_kind::timing, 1);
+  timing.time_ms = 2.0f;
+  timing.device  = 0;
+  second.push(timing);
+
+  ::std::stringstream ss;
+  write_trace_header(ss, 2);
+  first.write(ss);
+  second.write(ss);
+
+  trace_graph g;
+  g.read(ss);
+  g.build();
+  EXPECT(g.vertex_count() == 2);
+  EXPECT(g.has_edge(0, 1));
+  EXPECT(g.critical_path_length() == 2.0f);
+
+  ::std::ostringstream dot_oss;
+  g.print_dot(dot_oss);
+  const ::std::string dot_str = dot_oss.str();
+  EXPECT(dot_str.find("\"NODE_0\" -> \"NODE_1\"") != ::std::string::npos);
+  EXPECT(dot_str.find("produce\\nA(write)(64) ") != ::std::string::npos);
+  EXPECT(dot_str.find("// Tinf = 2") != ::std::string::npos);
+
+  ::std::ostringstream json_oss;
+  g.print_chrome_trace(json_oss);
+  const ::std::string json_str = json_oss.str();
+  EXPECT(json_str.find("\"name\":\"consume\"") != ::std::string::npos);
+  EXPECT(json_str.find("\"critical\":true") != ::std::string::npos);
+  EXPECT(json_str.find("\"name\":\"produce\"") == ::std::string::npos);
+
+  ::std::stringstream bad("NOTATRACE");
+  bool thrown = false;
+  try
+  {
+    trace_graph().read(bad);
+  }
+  catch (const ::std::runtime_error&)
+  {
+    thrown = true;
+  }
+  EXPECT(thrown);
+};
+#endif // UNITTESTED_FILE
+
+} // namespace cuda::experimental::stf::reserved
@@ -13,5 +13,6 @@
 
 #include <cuda/experimental/__algorithm/copy.cuh>
 #include <cuda/experimental/__algorithm/fill.cuh>
+#include <cuda/experimental/__algorithm/host_copy.cuh>
 
 #endif // __CUDAX_ALGORITHM__
@@ -15,8 +15,10 @@
 #include <cuda/experimental/__memory_resource/device_memory_pool.cuh>
 #include <cuda/experimental/__memory_resource/device_memory_resource.cuh>
 #include <cuda/experimental/__memory_resource/managed_memory_resource.cuh>
+#include <cuda/experimental/__memory_resource/monotonic_buffer_resource.cuh>
 #include <cuda/experimental/__memory_resource/pinned_memory_resource.cuh>
 #include <cuda/experimental/__memory_resource/properties.cuh>
 #include <cuda/experimental/__memory_resource/shared_resource.cuh>
+#include <cuda/experimental/__memory_resource/unsynchronized_pool_resource.cuh>
 
 #endif // __CUDAX_MEMORY_RESOURCE___
@@ -0,0 +1,194 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdexcept>
+#include <vector>
+
+#include "common.cuh"
+
+// the value every source element is initialized to, distinct for every index
+inline int value_at(size_t i, size_t j, size_t k = 0)
+{
+  return static_cast<int>((i * 1000 + j) * 1000 + k);
+}
+
+template <typename DstLayout, typename SrcLayout>
+void test_host_copy_2d(size_t rows, size_t cols)
+{
+  using extents_type = cuda::std::dextents<size_t, 2>;
+  const extents_type extents(rows, cols);
+
+  std::vector<int> src_storage(rows * cols);
+  std::vector<int> dst_storage(rows * cols, -1);
+  cuda::std::mdspan<int, extents_type, SrcLayout> src(src_storage.data(), extents);
+  cuda::std::mdspan<int, extents_type, DstLayout> dst(dst_storage.data(), extents);
+
+  for (size_t i = 0; i < rows; ++i)
+  {
+    for (size_t j = 0; j < cols; ++j)
+    {
+      src(i, j) = value_at(i, j);
+    }
+  }
+
+  cudax::host_copy(src, dst);
+
+  for (size_t i = 0; i < rows; ++i)
+  {
+    for (size_t j = 0; j < cols; ++j)
+    {
+      CUDAX_CHECK(dst(i, j) == value_at(i, j));
+    }
+  }
+}
+
+TEST_CASE("Host mdspan copy", "[data_manipulation]")
+{
+  // shapes below, at and across the tile and block edges
+  const size_t shapes[][2] = {{0, 5}, {1, 1}, {1, 300}, {300, 1}, {3, 5}, {64, 64}, {100, 257}, {513, 130}};
+
+  SECTION("Same layout")
+  {
+    for (const auto& shape : shapes)
+    {
+      test_host_copy_2d<cuda::std::layout_right, cuda::std::layout_right>(shape[0], shape[1]);
+      test_host_copy_2d<cuda::std::layout_left, cuda::std::layout_left>(shape[0], shape[1]);
+    }
+  }
+
+  SECTION("Different layouts")
+  {
+    for (const auto& shape : shapes)
+    {
+      test_host_copy_2d<cuda::std::layout_left, cuda::std::layout_right>(shape[0], shape[1]);
+      test_host_copy_2d<cuda::std::layout_right, cuda::std::layout_left>(shape[0], shape[1]);
+    }
+  }
+
+  SECTION("Strided source and conversion")
+  {
+    // every other column of a 70 x 2 * 90 layout_right array, copied into a layout_left array of doubles
+    const size_t rows = 70;
+    const size_t cols = 90;
+
+    std::vector<int> src_storage(rows * 2 * cols);
+    for (size_t i = 0; i < rows; ++i)
+    {
+      for (size_t j = 0; j < cols; ++j)
+      {
+        src_storage[i * 2 * cols + 2 * j] = value_at(i, j);
+      }
+    }
+
+    using extents_type = cuda::std::dextents<size_t, 2>;
+    const cuda::std::layout_stride::mapping<extents_type> src_mapping(
+      extents_type(rows, cols), cuda::std::array<size_t, 2>{2 * cols, 2});
+    cuda::std::mdspan<const int, extents_type, cuda::std::layout_stride> src(src_storage.data(), src_mapping);
+
+    std::vector<double> dst_storage(rows * cols);
+    cuda::std::mdspan<double, extents_type, cuda::std::layout_left> dst(dst_storage.data(), rows, cols);
+
+    cudax::host_copy(src, dst);
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+      for (size_t j = 0; j < cols; ++j)
+      {
+        CUDAX_CHECK(dst(i, j) == static_cast<double>(value_at(i, j)));
+      }
+    }
+  }
+
+  SECTION("Three dimensions")
+  {
+    using extents_type = cuda::std::extents<int, 9, cuda::std::dynamic_extent, 33>;
+    const extents_type extents(70);
+
+    std::vector<int> src_storage(9 * 70 * 33);
+    cuda::std::mdspan<int, extents_type> src(src_storage.data(), extents);
+    for (int i = 0; i < 9; ++i)
+    {
+      for (int j = 0; j < 70; ++j)
+      {
+        for (int k = 0; k < 33; ++k)
+        {
+          src(i, j, k) = value_at(i, j, k);
+        }
+      }
+    }
+
+    // a layout whose fastest dimension is the middle one
+    std::vector<int> dst_storage(9 * 70 * 33);
+    const cuda::std::layout_stride::mapping<extents_type> dst_mapping(
+      extents, cuda::std::array<int, 3>{70 * 33, 1, 70});
+    cuda::std::mdspan<int, extents_type, cuda::std::layout_stride> dst(dst_storage.data(), dst_mapping);
+
+    std::vector<int> left_storage(9 * 70 * 33);
+    cuda::std::mdspan<int, extents_type, cuda::std::layout_left> left(left_storage.data(), extents);
+
+    cudax::host_copy(src, dst);
+    cudax::host_copy(dst, left);
+
+    for (int i = 0; i < 9; ++i)
+    {
+      for (int j = 0; j < 70; ++j)
+      {
+        for (int k = 0; k < 33; ++k)
+        {
+          CUDAX_CHECK(dst(i, j, k) == value_at(i, j, k));
+          CUDAX_CHECK(left(i, j, k) == value_at(i, j, k));
+        }
+      }
+    }
+  }
+
+  SECTION("Mismatched extents")
+  {
+    std::vector<int> storage(12);
+    cuda::std::mdspan<int, cuda::std::dextents<size_t, 2>> src(storage.data(), 3, 4);
+    cuda::std::mdspan<int, cuda::std::dextents<size_t, 2>> dst(storage.data(), 4, 3);
+
+    CHECK_THROWS_AS(cudax::host_copy(src, dst), std::invalid_argument);
+  }
+}
+
+TEST_CASE("Host mdspan transpose", "[data_manipulation]")
+{
+  const size_t shapes[][2] = {{1, 7}, {7, 1}, {3, 5}, {200, 129}, {1000, 1000}};
+
+  for (const auto& shape : shapes)
+  {
+    const size_t rows = shape[0];
+    const size_t cols = shape[1];
+
+    std::vector<int> src_storage(rows * cols);
+    std::vector<int> dst_storage(rows * cols);
+    cuda::std::mdspan<int, cuda::std::dextents<size_t, 2>> src(src_storage.data(), rows, cols);
+    cuda::std::mdspan<int, cuda::std::dextents<size_t, 2>> dst(dst_storage.data(), cols, rows);
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+      for (size_t j = 0; j < cols; ++j)
+      {
+        src(i, j) = value_at(i, j);
+      }
+    }
+
+    cudax::host_transpose(src, dst);
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+      for (size_t j = 0; j < cols; ++j)
+      {
+        CUDAX_CHECK(dst(j, i) == value_at(i, j));
+      }
+    }
+  }
+}
@@ -0,0 +1,135 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__async/async.cuh>
+
+#include <atomic>
+#include <thread>
+
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+#if !defined(__CUDA_ARCH__)
+
+namespace
+{
+// Schedules 2^depth leaves from the workers of the pool, every inner node forks two children
+struct fork_tree
+{
+  cudax_async::static_thread_pool* pool;
+  std::atomic<int>* leaves;
+  int depth;
+
+  void operator()() const
+  {
+    if (depth == 0)
+    {
+      leaves->fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    for (int i = 0; i < 2; ++i)
+    {
+      cudax_async::start_detached(
+        cudax_async::start_on(pool->get_scheduler(), cudax_async::just()) //
+        | cudax_async::then(fork_tree{pool, leaves, depth - 1}));
+    }
+  }
+};
+
+TEST_CASE("static_thread_pool runs work scheduled from outside the pool", "[thread_pool]")
+{
+  std::atomic<int> count{0};
+  {
+    cudax_async::static_thread_pool pool{4};
+    for (int i = 0; i < 1000; ++i)
+    {
+      cudax_async::start_detached(cudax_async::start_on(pool.get_scheduler(), cudax_async::just()) //
+                                  | cudax_async::then([&] {
+                                      count.fetch_add(1, std::memory_order_relaxed);
+                                    }));
+    }
+    pool.join();
+  }
+  CUDAX_CHECK(count.load() == 1000);
+}
+
+TEST_CASE("static_thread_pool runs work scheduled from its own workers", "[thread_pool]")
+{
+  std::atomic<int> leaves{0};
+  cudax_async::static_thread_pool pool{4};
+  cudax_async::start_detached(cudax_async::start_on(pool.get_scheduler(), cudax_async::just()) //
+                              | cudax_async::then(fork_tree{&pool, &leaves, 12}));
+  pool.join();
+  CUDAX_CHECK(leaves.load() == (1 << 12));
+}
+
+TEST_CASE("static_thread_pool takes more work from a worker than its deque holds", "[thread_pool]")
+{
+  std::atomic<int> count{0};
+  cudax_async::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  cudax_async::start_detached(cudax_async::start_on(sched, cudax_async::just()) //
+                              | cudax_async::then([&] {
+                                  for (int i = 0; i < 5000; ++i)
+                                  {
+                                    cudax_async::start_detached(cudax_async::start_on(sched, cudax_async::just()) //
+                                                                | cudax_async::then([&] {
+                                                                    count.fetch_add(1, std::memory_order_relaxed);
+                                                                  }));
+                                  }
+                                }));
+  pool.join();
+  CUDAX_CHECK(count.load() == 5000);
+}
+
+TEST_CASE("continue_on moves the continuation to a worker of the pool", "[thread_pool][continue_on]")
+{
+  cudax_async::static_thread_pool pool{2};
+  const auto caller = std::this_thread::get_id();
+
+  auto snd = cudax_async::just(13) //
+           | cudax_async::continue_on(pool.get_scheduler()) //
+           | cudax_async::then([caller](int val) {
+               return std::this_thread::get_id() != caller ? val + 1 : val;
+             });
+  check_values(std::move(snd), 14);
+}
+
+TEST_CASE("when_all fans out over the pool", "[thread_pool][when_all]")
+{
+  cudax_async::static_thread_pool pool{4};
+  auto sched  = pool.get_scheduler();
+  auto square = [](int val) {
+    return val * val;
+  };
+
+  auto snd = cudax_async::when_all(cudax_async::just(1) | cudax_async::continue_on(sched) | cudax_async::then(square),
+                                   cudax_async::just(2) | cudax_async::continue_on(sched) | cudax_async::then(square),
+                                   cudax_async::just(3) | cudax_async::continue_on(sched) | cudax_async::then(square),
+                                   cudax_async::just(4) | cudax_async::continue_on(sched) | cudax_async::then(square));
+  check_values(std::move(snd), 1, 4, 9, 16);
+}
+
+TEST_CASE("static_thread_pool scheduler queries", "[thread_pool]")
+{
+  cudax_async::static_thread_pool pool1{1};
+  cudax_async::static_thread_pool pool2{1};
+
+  CUDAX_CHECK(pool1.get_scheduler() == pool1.get_scheduler());
+  CUDAX_CHECK(pool1.get_scheduler() != pool2.get_scheduler());
+  CUDAX_CHECK(pool1.available_parallelism() == 1);
+
+  auto sndr = pool1.get_scheduler().schedule();
+  CUDAX_CHECK(cudax_async::get_completion_scheduler<cudax_async::set_value_t>(cudax_async::get_env(sndr))
+              == pool1.get_scheduler());
+}
+} // namespace
+
+#endif // !defined(__CUDA_ARCH__)
@@ -0,0 +1,165 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/algorithm.cuh>
+#include <cuda/experimental/mdspan.cuh>
+
+#include <algorithm>
+#include <vector>
+
+#include <testing.cuh>
+
+using extents_2d = cuda::std::dextents<size_t, 2>;
+
+// every offset of the mapping is below its span size and taken by one element only
+template <typename Mapping>
+void check_unique_offsets(const Mapping& mapping)
+{
+  const size_t rows = mapping.extents().extent(0);
+  const size_t cols = mapping.extents().extent(1);
+
+  std::vector<bool> taken(mapping.required_span_size(), false);
+  size_t max_offset = 0;
+  bool unique       = true;
+  for (size_t i = 0; i < rows; ++i)
+  {
+    for (size_t j = 0; j < cols; ++j)
+    {
+      const size_t offset = mapping(i, j);
+      REQUIRE(offset < taken.size());
+      unique       = unique && !taken[offset];
+      taken[offset] = true;
+      max_offset    = std::max(max_offset, offset);
+    }
+  }
+  CUDAX_CHECK(unique);
+  CUDAX_CHECK((rows * cols == 0 || max_offset + 1 == static_cast<size_t>(mapping.required_span_size())));
+}
+
+template <typename Layout>
+void test_layout()
+{
+  const size_t shapes[][2] = {{0, 3}, {1, 1}, {5, 3}, {8, 8}, {16, 16}, {17, 45}, {100, 9}, {3, 200}};
+
+  for (const auto& shape : shapes)
+  {
+    const extents_2d extents(shape[0], shape[1]);
+    const typename Layout::template mapping<extents_2d> mapping(extents);
+    check_unique_offsets(mapping);
+
+    // no padding when the extents are multiples of the tiles, the square ones also make a power of two grid for the
+    // Z-order
+    if (shape[0] == shape[1] && shape[0] % mapping.tile_rows == 0 && shape[1] % mapping.tile_cols == 0)
+    {
+      CUDAX_CHECK(mapping.is_exhaustive());
+    }
+    if (shape[0] == 5)
+    {
+      CUDAX_CHECK(!mapping.is_exhaustive());
+    }
+
+    // round trip through layout_right
+    std::vector<int> right_storage(shape[0] * shape[1]);
+    std::vector<int> tiled_storage(mapping.required_span_size());
+    std::vector<int> back_storage(shape[0] * shape[1]);
+    for (size_t i = 0; i < right_storage.size(); ++i)
+    {
+      right_storage[i] = static_cast<int>(i);
+    }
+    cuda::std::mdspan<int, extents_2d> right(right_storage.data(), extents);
+    cuda::std::mdspan<int, extents_2d, Layout> tiled(tiled_storage.data(), mapping);
+    cuda::std::mdspan<int, extents_2d> back(back_storage.data(), extents);
+
+    cudax::host_copy(right, tiled);
+    cudax::host_copy(tiled, back);
+    CUDAX_CHECK(right_storage == back_storage);
+
+    // slices see the elements of the array at their origin and keep the layout
+    if (shape[0] > 2 && shape[1] > 2)
+    {
+      auto sub = cudax::submdspan(tiled, cuda::std::tuple<size_t, size_t>{1, shape[0] - 1}, cuda::std::full_extent);
+      static_assert(cuda::std::is_same_v<typename decltype(sub)::layout_type, Layout>);
+      CUDAX_CHECK(sub.extent(0) == shape[0] - 2);
+      CUDAX_CHECK(sub.extent(1) == shape[1]);
+
+      auto sub_sub = cudax::submdspan(sub, cuda::std::full_extent, cuda::std::tuple<size_t, size_t>{2, shape[1]});
+      check_unique_offsets(sub_sub.mapping());
+      CUDAX_CHECK(sub_sub.extent(0) == shape[0] - 2);
+      CUDAX_CHECK(sub_sub.extent(1) == shape[1] - 2);
+
+      bool same = true;
+      for (size_t i = 0; i < sub_sub.extent(0); ++i)
+      {
+        for (size_t j = 0; j < sub_sub.extent(1); ++j)
+        {
+          same = same && sub_sub(i, j) == right(i + 1, j + 2) && &sub_sub(i, j) == &tiled(i + 1, j + 2);
+        }
+      }
+      CUDAX_CHECK(same);
+
+      auto empty =
+        cudax::submdspan(tiled, cuda::std::tuple<size_t, size_t>{shape[0], shape[0]}, cuda::std::full_extent);
+      CUDAX_CHECK(empty.size() == 0);
+      CUDAX_CHECK(empty.mapping().required_span_size() == 0);
+    }
+  }
+}
+
+TEST_CASE("layout_tiled", "[mdspan]")
+{
+  test_layout<cudax::layout_tiled<4, 4>>();
+  test_layout<cudax::layout_tiled<8, 2>>();
+  test_layout<cudax::layout_tiled<3, 5>>();
+
+  // tiles are stored row by row, one row of tiles after the other
+  const cudax::layout_tiled<2, 2>::mapping<extents_2d> mapping(extents_2d(4, 4));
+  CUDAX_CHECK(mapping(0, 1) == 1);
+  CUDAX_CHECK(mapping(1, 0) == 2);
+  CUDAX_CHECK(mapping(0, 2) == 4);
+  CUDAX_CHECK(mapping(2, 0) == 8);
+  CUDAX_CHECK(mapping(3, 3) == 15);
+}
+
+TEST_CASE("layout_tiled_morton", "[mdspan]")
+{
+  test_layout<cudax::layout_tiled_morton<4, 4>>();
+  test_layout<cudax::layout_tiled_morton<8, 2>>();
+  test_layout<cudax::layout_tiled_morton<3, 5>>();
+
+  // 1 x 1 tiles along a Z-order curve over a 4 x 4 grid
+  const cudax::layout_tiled_morton<1, 1>::mapping<extents_2d> mapping(extents_2d(4, 4));
+  CUDAX_CHECK(mapping(0, 1) == 1);
+  CUDAX_CHECK(mapping(1, 0) == 2);
+  CUDAX_CHECK(mapping(1, 1) == 3);
+  CUDAX_CHECK(mapping(0, 2) == 4);
+  CUDAX_CHECK(mapping(2, 0) == 8);
+  CUDAX_CHECK(mapping(3, 3) == 15);
+
+  // a wide grid is a row of square blocks
+  const cudax::layout_tiled_morton<1, 1>::mapping<extents_2d> wide(extents_2d(2, 6));
+  CUDAX_CHECK(wide(1, 1) == 3);
+  CUDAX_CHECK(wide(0, 2) == 4);
+  CUDAX_CHECK(wide(1, 5) == 11);
+}
+
+TEST_CASE("Tiled mapping conversions", "[mdspan]")
+{
+  using static_extents = cuda::std::extents<int, 16, 12>;
+  using layout         = cudax::layout_tiled<4, 4>;
+
+  const layout::mapping<static_extents> static_mapping;
+  const layout::mapping<cuda::std::dextents<int, 2>> dynamic_mapping = static_mapping;
+  CUDAX_CHECK(dynamic_mapping == static_mapping);
+  CUDAX_CHECK(dynamic_mapping.required_span_size() == 16 * 12);
+
+  const layout::mapping<static_extents> back(dynamic_mapping);
+  CUDAX_CHECK(back == static_mapping);
+  CUDAX_CHECK(!(layout::mapping<cuda::std::dextents<int, 2>>(cuda::std::dextents<int, 2>(16, 8)) == static_mapping));
+}
@@ -0,0 +1,145 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <cuda/experimental/memory_resource.cuh>
+
+#include <stdexcept>
+
+#include "test_resource.cuh"
+#include <catch2/catch.hpp>
+#include <testing.cuh>
+
+using monotonic_resource = cudax::monotonic_buffer_resource<counting_host_resource>;
+static_assert(cuda::mr::resource_with<monotonic_resource, cuda::mr::host_accessible>, "");
+static_assert(!cuda::mr::resource_with<monotonic_resource, cuda::mr::device_accessible>, "");
+static_assert(!cuda::std::is_copy_constructible<monotonic_resource>::value, "");
+static_assert(!cuda::std::is_move_constructible<monotonic_resource>::value, "");
+static_assert(cuda::mr::resource_with<cudax::monotonic_buffer_resource<cudax::pinned_memory_resource>,
+                                      cuda::mr::host_accessible,
+                                      cuda::mr::device_accessible>,
+              "");
+
+static bool is_aligned(void* ptr, size_t alignment)
+{
+  return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST_CASE("monotonic_buffer_resource allocation", "[memory_resource]")
+{
+  int live_allocations = 0;
+
+  SECTION("allocations are aligned and do not overlap")
+  {
+    monotonic_resource res{counting_host_resource{&live_allocations}, 64};
+
+    char* previous = nullptr;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+      const size_t alignment = size_t{1} << (i % 8);
+      auto* ptr              = static_cast<char*>(res.allocate(i % 100 + 1, alignment));
+      CHECK(is_aligned(ptr, alignment));
+      if (previous != nullptr && ptr > previous)
+      {
+        CHECK(ptr - previous >= static_cast<ptrdiff_t>((i - 1) % 100 + 1));
+      }
+      previous = ptr;
+      res.deallocate(ptr, i % 100 + 1, alignment);
+    }
+
+    // Chunks grow geometrically, so there are only few of them
+    CHECK(live_allocations > 0);
+    CHECK(live_allocations < 16);
+
+    void* over_aligned = res.allocate(100, 4096);
+    CHECK(is_aligned(over_aligned, 4096));
+
+    res.release();
+    CHECK(live_allocations == 0);
+  }
+
+  SECTION("an initial buffer is used before the upstream resource")
+  {
+    alignas(alignof(cuda::std::max_align_t)) char buffer[256];
+    monotonic_resource res{buffer, sizeof(buffer), counting_host_resource{&live_allocations}};
+
+    CHECK(res.allocate(100) == buffer);
+    CHECK(live_allocations == 0);
+
+    void* ptr = res.allocate(200);
+    CHECK((ptr < buffer || ptr >= buffer + sizeof(buffer)));
+    CHECK(live_allocations == 1);
+
+    res.release();
+    CHECK(live_allocations == 0);
+    CHECK(res.allocate(100) == buffer);
+  }
+
+  SECTION("the destructor returns all chunks")
+  {
+    {
+      monotonic_resource res{counting_host_resource{&live_allocations}};
+      for (int i = 0; i < 100; ++i)
+      {
+        (void) res.allocate(1000);
+      }
+      CHECK(live_allocations > 0);
+    }
+    CHECK(live_allocations == 0);
+  }
+
+  SECTION("invalid alignment")
+  {
+    monotonic_resource res{counting_host_resource{&live_allocations}};
+    CHECK_THROWS_AS(res.allocate(42, 3), std::invalid_argument);
+  }
+}
+
+TEST_CASE("monotonic_buffer_resource comparison", "[memory_resource]")
+{
+  int live_allocations = 0;
+  monotonic_resource first{counting_host_resource{&live_allocations}};
+  monotonic_resource second{counting_host_resource{&live_allocations}};
+
+  CHECK(first == first);
+  CHECK(first != second);
+}
+
+TEST_CASE("monotonic_buffer_resource composes with resource wrappers", "[memory_resource]")
+{
+  int live_allocations = 0;
+
+  SECTION("resource_ref")
+  {
+    monotonic_resource res{counting_host_resource{&live_allocations}};
+    cuda::mr::resource_ref<cuda::mr::host_accessible> ref{res};
+
+    void* ptr = ref.allocate(42, 8);
+    CHECK(is_aligned(ptr, 8));
+    ref.deallocate(ptr, 42, 8);
+    CHECK(ref == cuda::mr::resource_ref<cuda::mr::host_accessible>{res});
+  }
+
+  SECTION("any_resource")
+  {
+    {
+      cudax::any_resource<cuda::mr::host_accessible> any{
+        cudax::make_shared_resource<monotonic_resource>(counting_host_resource{&live_allocations})};
+
+      void* ptr = any.allocate(42, 16);
+      CHECK(is_aligned(ptr, 16));
+      any.deallocate(ptr, 42, 16);
+      CHECK(live_allocations == 1);
+    }
+    CHECK(live_allocations == 0);
+  }
+}
@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <new>
 
 #include <catch2/catch.hpp>
 #include <testing.cuh>
@@ -206,3 +207,33 @@ using small_resource = test_resource<unsigned int>;
 
 static_assert(sizeof(big_resource) > sizeof(cuda::mr::_AnyResourceStorage));
 static_assert(sizeof(small_resource) <= sizeof(cuda::mr::_AnyResourceStorage));
+
+//! A host resource backed by aligned operator new that counts the live allocations it handed out
+struct counting_host_resource
+{
+  int* live_allocations;
+
+  void* allocate(std::size_t bytes, std::size_t align)
+  {
+    ++*live_allocations;
+    return ::operator new(bytes, std::align_val_t{align});
+  }
+
+  void deallocate(void* ptr, std::size_t, std::size_t align) noexcept
+  {
+    --*live_allocations;
+    ::operator delete(ptr, std::align_val_t{align});
+  }
+
+  friend bool operator==(const counting_host_resource& lhs, const counting_host_resource& rhs) noexcept
+  {
+    return lhs.live_allocations == rhs.live_allocations;
+  }
+
+  friend bool operator!=(const counting_host_resource& lhs, const counting_host_resource& rhs) noexcept
+  {
+    return lhs.live_allocations != rhs.live_allocations;
+  }
+
+  friend constexpr void get_property(const counting_host_resource&, cuda::mr::host_accessible) noexcept {}
+};
@@ -0,0 +1,163 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <cuda/experimental/memory_resource.cuh>
+
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "test_resource.cuh"
+#include <catch2/catch.hpp>
+#include <testing.cuh>
+
+using pool_resource = cudax::unsynchronized_pool_resource<counting_host_resource>;
+static_assert(cuda::mr::resource_with<pool_resource, cuda::mr::host_accessible>, "");
+static_assert(!cuda::mr::resource_with<pool_resource, cuda::mr::device_accessible>, "");
+static_assert(!cuda::std::is_copy_constructible<pool_resource>::value, "");
+static_assert(!cuda::std::is_move_constructible<pool_resource>::value, "");
+static_assert(cuda::mr::resource_with<cudax::unsynchronized_pool_resource<cudax::pinned_memory_resource>,
+                                      cuda::mr::host_accessible,
+                                      cuda::mr::device_accessible>,
+              "");
+
+static bool is_aligned(void* ptr, size_t alignment)
+{
+  return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST_CASE("unsynchronized_pool_resource construction", "[memory_resource]")
+{
+  int live_allocations = 0;
+
+  CHECK(pool_resource{counting_host_resource{&live_allocations}}.largest_required_pool_block()
+        == pool_resource::default_largest_required_pool_block);
+  CHECK(pool_resource{counting_host_resource{&live_allocations}, 1000}.largest_required_pool_block() == 1024);
+  CHECK(pool_resource{counting_host_resource{&live_allocations}, 0}.largest_required_pool_block() == 8);
+  CHECK(pool_resource{counting_host_resource{&live_allocations}, size_t{1} << 30}.largest_required_pool_block()
+        == size_t{1} << 20);
+  CHECK(live_allocations == 0);
+}
+
+TEST_CASE("unsynchronized_pool_resource allocation", "[memory_resource]")
+{
+  int live_allocations = 0;
+
+  SECTION("deallocated blocks are reused")
+  {
+    pool_resource res{counting_host_resource{&live_allocations}};
+
+    void* ptr = res.allocate(24, 8);
+    CHECK(is_aligned(ptr, 8));
+    CHECK(live_allocations == 1);
+    res.deallocate(ptr, 24, 8);
+
+    // 24 and 32 bytes share a size class
+    CHECK(res.allocate(32, 8) == ptr);
+    CHECK(live_allocations == 1);
+    res.deallocate(ptr, 32, 8);
+  }
+
+  SECTION("mixed sizes and alignments")
+  {
+    pool_resource res{counting_host_resource{&live_allocations}, 1024, 64};
+
+    std::vector<std::tuple<void*, size_t, size_t>> allocations;
+    for (size_t i = 0; i < 5000; ++i)
+    {
+      const size_t bytes     = i % 1500 + 1;
+      const size_t alignment = size_t{1} << (i % 7);
+      void* ptr              = res.allocate(bytes, alignment);
+      CHECK(is_aligned(ptr, alignment));
+      std::memset(ptr, static_cast<int>(i % 256), bytes);
+      allocations.emplace_back(ptr, bytes, alignment);
+
+      if (i % 3 == 0)
+      {
+        res.deallocate(ptr, bytes, alignment);
+        allocations.pop_back();
+      }
+    }
+
+    for (const auto& [ptr, bytes, alignment] : allocations)
+    {
+      res.deallocate(ptr, bytes, alignment);
+    }
+
+    // Only the chunks remain, allocations larger than the largest block went to the upstream resource
+    CHECK(live_allocations > 0);
+    res.release();
+    CHECK(live_allocations == 0);
+  }
+
+  SECTION("the destructor returns all chunks")
+  {
+    {
+      pool_resource res{counting_host_resource{&live_allocations}};
+      for (int i = 0; i < 100; ++i)
+      {
+        (void) res.allocate(64);
+      }
+      CHECK(live_allocations > 0);
+    }
+    CHECK(live_allocations == 0);
+  }
+
+  SECTION("invalid alignment")
+  {
+    pool_resource res{counting_host_resource{&live_allocations}};
+    CHECK_THROWS_AS(res.allocate(42, 3), std::invalid_argument);
+  }
+}
+
+TEST_CASE("unsynchronized_pool_resource comparison", "[memory_resource]")
+{
+  int live_allocations = 0;
+  pool_resource first{counting_host_resource{&live_allocations}};
+  pool_resource second{counting_host_resource{&live_allocations}};
+
+  CHECK(first == first);
+  CHECK(first != second);
+}
+
+TEST_CASE("unsynchronized_pool_resource composes with resource wrappers", "[memory_resource]")
+{
+  int live_allocations = 0;
+
+  SECTION("resource_ref")
+  {
+    pool_resource res{counting_host_resource{&live_allocations}};
+    cuda::mr::resource_ref<cuda::mr::host_accessible> ref{res};
+
+    void* ptr = ref.allocate(42, 8);
+    CHECK(is_aligned(ptr, 8));
+    ref.deallocate(ptr, 42, 8);
+    CHECK(ref.allocate(42, 8) == ptr);
+    ref.deallocate(ptr, 42, 8);
+  }
+
+  SECTION("any_resource")
+  {
+    {
+      cudax::any_resource<cuda::mr::host_accessible> any{
+        cudax::make_shared_resource<pool_resource>(counting_host_resource{&live_allocations})};
+
+      void* ptr = any.allocate(42, 16);
+      CHECK(is_aligned(ptr, 16));
+      any.deallocate(ptr, 42, 16);
+      CHECK(live_allocations == 1);
+    }
+    CHECK(live_allocations == 0);
+  }
+}
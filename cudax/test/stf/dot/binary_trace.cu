@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDASTF in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ * @file
+ * @brief This test makes sure we can record a binary trace and analyze it offline
+ */
+
+#include <cuda/experimental/__stf/internal/trace_analyzer.cuh>
+#include <cuda/experimental/stf.cuh>
+
+#include <sstream>
+
+using namespace cuda::experimental::stf;
+
+int main()
+{
+#if !_CCCL_COMPILER(MSVC)
+  // Generate a random filename
+  int r = rand();
+
+  char filename[64];
+  snprintf(filename, 64, "output_%d.trace", r);
+  setenv("CUDASTF_TRACE_FILE", filename, 1);
+  setenv("CUDASTF_DOT_TIMING", "1", 1);
+
+  stream_ctx ctx;
+
+  auto lA = ctx.logical_data(shape_of<slice<char>>(64)).set_symbol("A");
+  auto lB = ctx.logical_data(shape_of<slice<char>>(64)).set_symbol("B");
+
+  auto initA = ctx.task(lA.write());
+  initA.set_symbol("initA");
+  initA->*[](cudaStream_t, auto) {};
+
+  auto initB = ctx.task(lB.write());
+  initB.set_symbol("initB");
+  initB->*[](cudaStream_t, auto) {};
+
+  ctx.task(lA.rw(), lB.read()).set_symbol("updateA")->*[](cudaStream_t, auto, auto) {};
+
+  auto updateB = ctx.task(lA.read(), lB.rw());
+  updateB.set_symbol("updateB");
+  updateB->*[](cudaStream_t, auto, auto) {};
+
+  ctx.finalize();
+
+  // Call this explicitely for the purpose of the test
+  reserved::trace_recorder::instance().finish();
+
+  reserved::trace_graph g(filename);
+  EXPECT(g.vertex_count() >= 4);
+
+  // initA -> updateA, initB -> updateA and updateA -> updateB remain, updateB depends on initA and initB only through
+  // updateA
+  g.remove_redundant_edges();
+  EXPECT(g.edge_count() == 3);
+  EXPECT(!g.has_edge(initA.get_unique_id(), updateB.get_unique_id()));
+  EXPECT(!g.has_edge(initB.get_unique_id(), updateB.get_unique_id()));
+
+  ::std::ostringstream dot_oss;
+  g.print_dot(dot_oss);
+  const ::std::string dot_str = dot_oss.str();
+  EXPECT(dot_str.find("updateA\\nA(rw)(64) \\nB(read)(64) ") != ::std::string::npos);
+  EXPECT(dot_str.find("// Tinf = ") != ::std::string::npos);
+  EXPECT(g.critical_path_length() <= g.total_work());
+
+  ::std::ostringstream json_oss;
+  g.print_chrome_trace(json_oss);
+  EXPECT(json_oss.str().find("\"name\":\"updateB\"") != ::std::string::npos);
+
+  EXPECT(unlink(filename) == 0);
+#endif // !_CCCL_COMPILER(MSVC)
+}
@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDASTF in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ * @file
+ *
+ * @brief Measure the host overhead of the buddy allocator metadata with many small live allocations
+ *
+ * This does not touch any device memory.
+ */
+
+#include <cuda/experimental/__stf/allocators/buddy_allocator.cuh>
+
+#include <chrono>
+#include <random>
+
+using namespace cuda::experimental::stf;
+
+int main(int argc, char** argv)
+{
+#ifdef NDEBUG
+  size_t iter_cnt = 10000000;
+#else
+  size_t iter_cnt = 100000;
+  fprintf(stderr, "Warning: Running with small problem size in debug mode, should use DEBUG=0.\n");
+#endif
+
+  if (argc > 1)
+  {
+    iter_cnt = atol(argv[1]);
+  }
+
+  // Maximum number of allocations alive at the same time
+  size_t max_live = 100000;
+  if (argc > 2)
+  {
+    max_live = atol(argv[2]);
+  }
+
+  const size_t buffer_size = size_t(1) << 34;
+  reserved::buddy_allocator_metadata allocator(buffer_size, event_list());
+
+  ::std::mt19937_64 rng(42);
+  ::std::vector<::std::pair<::std::ptrdiff_t, size_t>> live;
+  live.reserve(max_live);
+  event_list prereqs;
+
+  std::chrono::steady_clock::time_point start, stop;
+  start = std::chrono::steady_clock::now();
+  for (size_t iter = 0; iter < iter_cnt; iter++)
+  {
+    // Allocate twice as often as we deallocate until there are max_live allocations
+    if (live.size() < max_live && (live.empty() || rng() % 3 != 0))
+    {
+      const size_t size            = 1 + rng() % 4096;
+      const ::std::ptrdiff_t offset = allocator.allocate(size, prereqs);
+      EXPECT(offset != -1);
+      live.emplace_back(offset, size);
+    }
+    else
+    {
+      // Release a random allocation
+      ::std::swap(live[rng() % live.size()], live.back());
+      allocator.deallocate(live.back().first, live.back().second, prereqs);
+      live.pop_back();
+    }
+  }
+
+  for (auto& [offset, size] : live)
+  {
+    allocator.deallocate(offset, size, prereqs);
+  }
+  stop = std::chrono::steady_clock::now();
+
+  // Everything was coalesced back into a single block
+  EXPECT(allocator.allocate(buffer_size, prereqs) == 0);
+
+  std::chrono::duration<double> duration = stop - start;
+  fprintf(stderr, "Elapsed: %.3lf us per operation\n", duration.count() * 1000000.0 / (iter_cnt + live.size()));
+}
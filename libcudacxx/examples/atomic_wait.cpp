@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the wake-up latency and the CPU time burnt by a host thread blocked in cuda::std::atomic::wait.
+//
+// A waiter blocks on an atomic while the main thread sleeps for a given delay, then changes the value and
+// notifies. The latency is the time from the notification to the waiter observing the new value, the CPU load
+// is the process CPU time divided by the wall time of the whole run.
+//
+// Build it once as is and once with -D_LIBCUDACXX_HAS_NO_ATOMIC_PARKING to compare parking the waiter against
+// polling with an exponential backoff.
+
+#include <cuda/std/atomic>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+using steady_clock = std::chrono::steady_clock;
+
+struct round_trip
+{
+  cuda::std::atomic<int> generation{0};
+  cuda::std::atomic<int> done{0};
+  cuda::std::atomic<steady_clock::rep> woken_at{0};
+};
+
+static void waiter(round_trip& rt, int rounds)
+{
+  for (int i = 0; i < rounds; ++i)
+  {
+    rt.generation.wait(i);
+    rt.woken_at.store(steady_clock::now().time_since_epoch().count());
+    rt.done.store(i + 1);
+    rt.done.notify_one();
+  }
+}
+
+static void run(std::chrono::microseconds delay, int rounds)
+{
+  round_trip rt;
+  std::vector<double> latencies;
+  latencies.reserve(rounds);
+
+  const std::clock_t cpu_start              = std::clock();
+  const steady_clock::time_point wall_start = steady_clock::now();
+
+  std::thread t(waiter, std::ref(rt), rounds);
+  for (int i = 0; i < rounds; ++i)
+  {
+    std::this_thread::sleep_for(delay);
+
+    const steady_clock::time_point notified_at = steady_clock::now();
+    rt.generation.store(i + 1);
+    rt.generation.notify_all();
+    rt.done.wait(i);
+
+    const steady_clock::time_point woken_at{steady_clock::duration{rt.woken_at.load()}};
+    latencies.push_back(std::chrono::duration<double, std::micro>(woken_at - notified_at).count());
+  }
+  t.join();
+
+  const double cpu  = double(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+  const double wall = std::chrono::duration<double>(steady_clock::now() - wall_start).count();
+
+  std::sort(latencies.begin(), latencies.end());
+  std::printf("%10lld %10.1f %10.1f %10.1f %9.1f%%\n",
+              static_cast<long long>(delay.count()),
+              latencies[rounds / 2],
+              latencies[rounds * 99 / 100],
+              latencies[rounds - 1],
+              100.0 * cpu / wall);
+}
+
+int main()
+{
+#if defined(_LIBCUDACXX_HAS_ATOMIC_PARKING)
+  std::printf("waiters park on a futex\n");
+#else
+  std::printf("waiters poll with backoff\n");
+#endif
+  std::printf("%10s %10s %10s %10s %10s\n", "delay(us)", "p50(us)", "p99(us)", "max(us)", "cpu");
+
+  for (int delay : {10, 100, 1000, 10000})
+  {
+    run(std::chrono::microseconds(delay), std::max(20, 200000 / delay));
+  }
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Compares cuda::std::sort, stable_sort, nth_element and partial_sort against the host standard library.
+//
+// Every algorithm runs on the same random, sorted, reverse sorted and few-unique inputs. The reported time is the
+// median over a number of repetitions, each one sorting a fresh copy of the input.
+
+#include <cuda/std/__algorithm_>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using steady_clock = std::chrono::steady_clock;
+
+enum class input
+{
+  random,
+  sorted,
+  reversed,
+  few_unique,
+};
+
+static const char* input_name(input in)
+{
+  switch (in)
+  {
+    case input::random:
+      return "random";
+    case input::sorted:
+      return "sorted";
+    case input::reversed:
+      return "reversed";
+    case input::few_unique:
+    default:
+      return "few_unique";
+  }
+}
+
+static std::vector<std::uint32_t> make_input(input in, std::size_t n)
+{
+  std::mt19937 rng(42);
+  std::vector<std::uint32_t> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    switch (in)
+    {
+      case input::random:
+        v[i] = rng();
+        break;
+      case input::sorted:
+        v[i] = static_cast<std::uint32_t>(i);
+        break;
+      case input::reversed:
+        v[i] = static_cast<std::uint32_t>(n - i);
+        break;
+      case input::few_unique:
+        v[i] = rng() % 16;
+        break;
+    }
+  }
+  return v;
+}
+
+template <class Fn>
+static double time_ms(const std::vector<std::uint32_t>& in, int reps, Fn fn)
+{
+  std::vector<double> times;
+  std::vector<std::uint32_t> v;
+  for (int r = 0; r < reps; ++r)
+  {
+    v                                    = in;
+    const steady_clock::time_point start = steady_clock::now();
+    fn(v.data(), v.data() + v.size());
+    times.push_back(std::chrono::duration<double, std::milli>(steady_clock::now() - start).count());
+  }
+  std::sort(times.begin(), times.end());
+  return times[times.size() / 2];
+}
+
+template <class CudaFn, class StdFn>
+static void compare(const char* name, input in, std::size_t n, CudaFn cuda_fn, StdFn std_fn)
+{
+  const std::vector<std::uint32_t> v = make_input(in, n);
+  const int reps                     = n >= (1 << 20) ? 5 : 25;
+
+  const double cuda_ms = time_ms(v, reps, cuda_fn);
+  const double std_ms  = time_ms(v, reps, std_fn);
+  std::printf("%-14s %-11s %10zu %12.3f %12.3f %8.2fx\n", name, input_name(in), n, cuda_ms, std_ms, std_ms / cuda_ms);
+}
+
+int main()
+{
+  std::printf("%-14s %-11s %10s %12s %12s %9s\n", "algorithm", "input", "n", "cuda(ms)", "std(ms)", "speedup");
+
+  for (std::size_t n : {std::size_t{1} << 10, std::size_t{1} << 16, std::size_t{1} << 22})
+  {
+    for (input in : {input::random, input::sorted, input::reversed, input::few_unique})
+    {
+      compare(
+        "sort",
+        in,
+        n,
+        [](std::uint32_t* first, std::uint32_t* last) {
+          cuda::std::sort(first, last);
+        },
+        [](std::uint32_t* first, std::uint32_t* last) {
+          std::sort(first, last);
+        });
+      compare(
+        "stable_sort",
+        in,
+        n,
+        [](std::uint32_t* first, std::uint32_t* last) {
+          cuda::std::stable_sort(first, last);
+        },
+        [](std::uint32_t* first, std::uint32_t* last) {
+          std::stable_sort(first, last);
+        });
+      compare(
+        "nth_element",
+        in,
+        n,
+        [](std::uint32_t* first, std::uint32_t* last) {
+          cuda::std::nth_element(first, first + (last - first) / 2, last);
+        },
+        [](std::uint32_t* first, std::uint32_t* last) {
+          std::nth_element(first, first + (last - first) / 2, last);
+        });
+      compare(
+        "partial_sort",
+        in,
+        n,
+        [](std::uint32_t* first, std::uint32_t* last) {
+          cuda::std::partial_sort(first, first + (last - first) / 100 + 1, last);
+        },
+        [](std::uint32_t* first, std::uint32_t* last) {
+          std::partial_sort(first, first + (last - first) / 100 + 1, last);
+        });
+    }
+  }
+
+  return 0;
+}
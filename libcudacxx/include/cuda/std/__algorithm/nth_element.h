@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
+#define _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/partial_sort.h>
+#include <cuda/std/__algorithm/sort.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/pair.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Introselect: quickselect with the pivot selection and partitioning of sort, falling back to heap select once the
+// partitions kept being unbalanced.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__nth_element(_RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare __comp)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const _RandomAccessIterator __begin = __first;
+  difference_type __depth             = 2 * _CUDA_VSTD::__sort_depth_limit<_RandomAccessIterator>(__last - __first);
+
+  while (true)
+  {
+    const difference_type __len = __last - __first;
+
+    if (__len < _LIBCUDACXX_SORT_INSERTION_LIMIT)
+    {
+      _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+      return;
+    }
+
+    if (--__depth == 0)
+    {
+      _CUDA_VSTD::__partial_sort<_AlgPolicy>(__first, __nth + 1, __last, __comp);
+      return;
+    }
+
+    _CUDA_VSTD::__choose_pivot<_AlgPolicy, _Compare>(__first, __last, __comp);
+
+    // see __introsort, all copies of the smallest element are in place and the nth is among them or to their right
+    if (__first != __begin && !__comp(*(__first - 1), *__first))
+    {
+      const _RandomAccessIterator __pivot =
+        _CUDA_VSTD::__partition_with_equals_on_left<_AlgPolicy, _Compare>(__first, __last, __comp);
+      if (__nth <= __pivot)
+      {
+        return;
+      }
+      __first = __pivot + 1;
+      continue;
+    }
+
+    const _RandomAccessIterator __pivot =
+      _CUDA_VSTD::__partition_with_equals_on_right<_AlgPolicy, _Compare>(__first, __last, __comp).first;
+
+    if (__nth == __pivot)
+    {
+      return;
+    }
+    if (__nth < __pivot)
+    {
+      __last = __pivot;
+    }
+    else
+    {
+      __first = __pivot + 1;
+    }
+  }
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __nth_element_impl(
+  _RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare& __comp)
+{
+  if (__nth == __last)
+  {
+    return;
+  }
+
+  using _Comp_ref = __comp_ref_type<_Compare>;
+  _CUDA_VSTD::__nth_element<_AlgPolicy, _Comp_ref>(__first, __nth, __last, __comp);
+}
+
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+nth_element(_RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__nth_element_impl<_ClassicAlgPolicy>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__nth), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+nth_element(_RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::nth_element(__first, __nth, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
@@ -0,0 +1,441 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_SORT_H
+#define _LIBCUDACXX___ALGORITHM_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/partial_sort.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/pair.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Ranges shorter than this are insertion sorted.
+#define _LIBCUDACXX_SORT_INSERTION_LIMIT 24
+
+// Ranges longer than this choose their pivot as the median of three medians of three.
+#define _LIBCUDACXX_SORT_NINTHER_THRESHOLD 128
+
+// Number of element moves after which an optimistic insertion sort gives up.
+#define _LIBCUDACXX_SORT_PARTIAL_INSERTION_LIMIT 8
+
+// stable, 1 compare, 0-1 swaps
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__sort2(_RandomAccessIterator __x, _RandomAccessIterator __y, _Compare __comp)
+{
+  if (__comp(*__y, *__x))
+  {
+    _IterOps<_AlgPolicy>::iter_swap(__x, __y);
+  }
+}
+
+// 3 compares, 0-3 swaps, leaves the median of the three elements in __y
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__sort3(_RandomAccessIterator __x, _RandomAccessIterator __y, _RandomAccessIterator __z, _Compare __comp)
+{
+  _CUDA_VSTD::__sort2<_AlgPolicy, _Compare>(__x, __y, __comp);
+  _CUDA_VSTD::__sort2<_AlgPolicy, _Compare>(__y, __z, __comp);
+  _CUDA_VSTD::__sort2<_AlgPolicy, _Compare>(__x, __y, __comp);
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__insertion_sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  if (__first == __last)
+  {
+    return;
+  }
+
+  for (_RandomAccessIterator __i = __first + 1; __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - 1;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__j != __first && __comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+    }
+  }
+}
+
+// Requires an element before __first that is not greater than any element of [__first, __last)
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__insertion_sort_unguarded(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  if (__first == __last)
+  {
+    return;
+  }
+
+  for (_RandomAccessIterator __i = __first + 1; __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - 1;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+    }
+  }
+}
+
+// Insertion sorts [__first, __last) unless that takes more than a handful of moves. Returns whether the range is
+// sorted.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 bool
+__insertion_sort_incomplete(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  if (__first == __last)
+  {
+    return true;
+  }
+
+  difference_type __moves = 0;
+  for (_RandomAccessIterator __i = __first + 1; __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - 1;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__j != __first && __comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+
+      __moves += __i - __j;
+      if (__moves > _LIBCUDACXX_SORT_PARTIAL_INSERTION_LIMIT)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Moves the pivot to __first: the median of three for short ranges, the pseudo-median of nine otherwise. Either way
+// an element not less than the pivot is left at the end of the range, which bounds the partitioning scans.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__choose_pivot(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const difference_type __len  = __last - __first;
+  const difference_type __half = __len / 2;
+
+  if (__len > _LIBCUDACXX_SORT_NINTHER_THRESHOLD)
+  {
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first, __first + __half, __last - 1, __comp);
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + 1, __first + (__half - 1), __last - 2, __comp);
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + 2, __first + (__half + 1), __last - 3, __comp);
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(
+      __first + (__half - 1), __first + __half, __first + (__half + 1), __comp);
+    _IterOps<_AlgPolicy>::iter_swap(__first, __first + __half);
+  }
+  else
+  {
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + __half, __first, __last - 1, __comp);
+  }
+}
+
+// Partitions around the pivot at __first, elements equal to the pivot end up on its right. Returns the final position
+// of the pivot and whether the range already was partitioned.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 pair<_RandomAccessIterator, bool>
+__partition_with_equals_on_right(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  value_type __pivot(_Ops::__iter_move(__first));
+
+  _RandomAccessIterator __i = __first;
+  _RandomAccessIterator __j = __last;
+
+  // __choose_pivot left an element not less than the pivot at the end of the range
+  while (__comp(*++__i, __pivot))
+  {
+  }
+
+  // nothing guards this scan if no element was less than the pivot
+  if (__i - 1 == __first)
+  {
+    while (__i < __j && !__comp(*--__j, __pivot))
+    {
+    }
+  }
+  else
+  {
+    while (!__comp(*--__j, __pivot))
+    {
+    }
+  }
+
+  const bool __already_partitioned = __i >= __j;
+
+  while (__i < __j)
+  {
+    _Ops::iter_swap(__i, __j);
+    while (__comp(*++__i, __pivot))
+    {
+    }
+    while (!__comp(*--__j, __pivot))
+    {
+    }
+  }
+
+  _RandomAccessIterator __pivot_pos = __i - 1;
+  if (__pivot_pos != __first)
+  {
+    *__first = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return pair<_RandomAccessIterator, bool>(__pivot_pos, __already_partitioned);
+}
+
+// Partitions around the pivot at __first, elements equal to the pivot end up on its left. Used when the pivot equals
+// the element preceding the range, in which case nothing in the range is less than the pivot and the whole run of
+// equal elements can be skipped at once. Returns the final position of the pivot.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 _RandomAccessIterator
+__partition_with_equals_on_left(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  value_type __pivot(_Ops::__iter_move(__first));
+
+  _RandomAccessIterator __i = __first;
+  _RandomAccessIterator __j = __last;
+
+  while (__comp(__pivot, *--__j))
+  {
+  }
+
+  if (__j + 1 == __last)
+  {
+    while (__i < __j && !__comp(__pivot, *++__i))
+    {
+    }
+  }
+  else
+  {
+    while (!__comp(__pivot, *++__i))
+    {
+    }
+  }
+
+  while (__i < __j)
+  {
+    _Ops::iter_swap(__i, __j);
+    while (__comp(__pivot, *--__j))
+    {
+    }
+    while (!__comp(__pivot, *++__i))
+    {
+    }
+  }
+
+  if (__j != __first)
+  {
+    *__first = _Ops::__iter_move(__j);
+  }
+  *__j = _CUDA_VSTD::move(__pivot);
+  return __j;
+}
+
+// Swaps a few elements of a badly partitioned side with elements further inside, to break up the pattern that caused
+// the bad split.
+template <class _AlgPolicy, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__break_patterns(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const difference_type __len = __last - __first;
+  if (__len < _LIBCUDACXX_SORT_INSERTION_LIMIT)
+  {
+    return;
+  }
+
+  const difference_type __quarter = __len / 4;
+  _Ops::iter_swap(__first, __first + __quarter);
+  _Ops::iter_swap(__last - 1, __last - __quarter);
+
+  if (__len > _LIBCUDACXX_SORT_NINTHER_THRESHOLD)
+  {
+    _Ops::iter_swap(__first + 1, __first + (__quarter + 1));
+    _Ops::iter_swap(__first + 2, __first + (__quarter + 2));
+    _Ops::iter_swap(__last - 2, __last - (__quarter + 1));
+    _Ops::iter_swap(__last - 3, __last - (__quarter + 2));
+  }
+}
+
+// Pattern-defeating introsort: quicksort that detects already partitioned ranges and runs of equal elements, shuffles
+// the input after unbalanced partitions and falls back to heap sort once too many of them happened.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __introsort(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __depth,
+  bool __leftmost)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  while (true)
+  {
+    const difference_type __len = __last - __first;
+
+    if (__len < _LIBCUDACXX_SORT_INSERTION_LIMIT)
+    {
+      if (__leftmost)
+      {
+        _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      else
+      {
+        _CUDA_VSTD::__insertion_sort_unguarded<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      return;
+    }
+
+    _CUDA_VSTD::__choose_pivot<_AlgPolicy, _Compare>(__first, __last, __comp);
+
+    // The element before the range is not greater than anything in it. If it is not less than the pivot either, the
+    // pivot is the smallest element and all its copies can be put in place at once.
+    if (!__leftmost && !__comp(*(__first - 1), *__first))
+    {
+      __first = _CUDA_VSTD::__partition_with_equals_on_left<_AlgPolicy, _Compare>(__first, __last, __comp) + 1;
+      continue;
+    }
+
+    const pair<_RandomAccessIterator, bool> __ret =
+      _CUDA_VSTD::__partition_with_equals_on_right<_AlgPolicy, _Compare>(__first, __last, __comp);
+    const _RandomAccessIterator __pivot = __ret.first;
+
+    const difference_type __left_len  = __pivot - __first;
+    const difference_type __right_len = __last - (__pivot + 1);
+
+    if (__left_len < __len / 8 || __right_len < __len / 8)
+    {
+      if (--__depth == 0)
+      {
+        _CUDA_VSTD::__partial_sort<_AlgPolicy>(__first, __last, __last, __comp);
+        return;
+      }
+
+      _CUDA_VSTD::__break_patterns<_AlgPolicy>(__first, __pivot);
+      _CUDA_VSTD::__break_patterns<_AlgPolicy>(__pivot + 1, __last);
+    }
+    else if (__ret.second
+             && _CUDA_VSTD::__insertion_sort_incomplete<_AlgPolicy, _Compare>(__first, __pivot, __comp)
+             && _CUDA_VSTD::__insertion_sort_incomplete<_AlgPolicy, _Compare>(__pivot + 1, __last, __comp))
+    {
+      // a balanced partition that moved nothing hints at sorted input
+      return;
+    }
+
+    _CUDA_VSTD::__introsort<_AlgPolicy, _Compare>(__first, __pivot, __comp, __depth, __leftmost);
+    __first    = __pivot + 1;
+    __leftmost = false;
+  }
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 typename iterator_traits<_RandomAccessIterator>::difference_type
+__sort_depth_limit(typename iterator_traits<_RandomAccessIterator>::difference_type __len)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using _Up             = make_unsigned_t<difference_type>;
+  return static_cast<difference_type>(_CUDA_VSTD::__bit_log2(static_cast<_Up>(__len))) + 1;
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__sort_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare& __comp)
+{
+  if (__last - __first < 2)
+  {
+    return;
+  }
+
+  using _Comp_ref = __comp_ref_type<_Compare>;
+  _CUDA_VSTD::__introsort<_AlgPolicy, _Comp_ref>(
+    __first, __last, __comp, _CUDA_VSTD::__sort_depth_limit<_RandomAccessIterator>(__last - __first), true);
+}
+
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__sort_impl<_ClassicAlgPolicy>(_CUDA_VSTD::move(__first), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void sort(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::sort(__first, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ALGORITHM_SORT_H
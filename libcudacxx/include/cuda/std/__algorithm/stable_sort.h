@@ -0,0 +1,325 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
+#define _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/lower_bound.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__algorithm/rotate.h>
+#include <cuda/std/__algorithm/sort.h>
+#include <cuda/std/__algorithm/upper_bound.h>
+#include <cuda/std/__functional/identity.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/is_trivially_default_constructible.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Length of the runs that are insertion sorted before merging starts.
+#define _LIBCUDACXX_STABLE_SORT_RUN_LENGTH 32
+
+// Size of the buffer on the stack used to merge short runs.
+#define _LIBCUDACXX_STABLE_SORT_BUFFER_BYTES 512
+
+// Elements that can be default constructed for free are merged through a small buffer on the stack, everything else is
+// merged in place with rotations.
+template <class _Tp,
+          bool = _CCCL_TRAIT(is_trivially_default_constructible, _Tp)
+              && (sizeof(_Tp) <= _LIBCUDACXX_STABLE_SORT_BUFFER_BYTES)>
+struct __stable_sort_buffer
+{
+  static constexpr ptrdiff_t __size = _LIBCUDACXX_STABLE_SORT_BUFFER_BYTES / sizeof(_Tp);
+
+  _Tp __data_[__size] = {};
+
+  _LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 _Tp* __begin()
+  {
+    return __data_;
+  }
+};
+
+template <class _Tp>
+struct __stable_sort_buffer<_Tp, false>
+{
+  static constexpr ptrdiff_t __size = 0;
+
+  _LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 _Tp* __begin()
+  {
+    return nullptr;
+  }
+};
+
+// Merges [__first, __middle) and [__middle, __last) after moving the left run into __buf.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, class _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __buffered_merge_forward(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __middle,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  _Tp* __buf)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  _Tp* __buf_end = __buf;
+  for (_RandomAccessIterator __i = __first; __i != __middle; ++__i, (void) ++__buf_end)
+  {
+    *__buf_end = _Ops::__iter_move(__i);
+  }
+
+  for (; __buf != __buf_end; ++__first)
+  {
+    if (__middle == __last)
+    {
+      for (; __buf != __buf_end; ++__buf, (void) ++__first)
+      {
+        *__first = _CUDA_VSTD::move(*__buf);
+      }
+      return;
+    }
+
+    if (__comp(*__middle, *__buf))
+    {
+      *__first = _Ops::__iter_move(__middle);
+      ++__middle;
+    }
+    else
+    {
+      *__first = _CUDA_VSTD::move(*__buf);
+      ++__buf;
+    }
+  }
+  // whatever is left of the right run already is in place
+}
+
+// Merges [__first, __middle) and [__middle, __last) back to front after moving the right run into __buf.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, class _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __buffered_merge_backward(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __middle,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  _Tp* __buf)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  _Tp* __buf_end = __buf;
+  for (_RandomAccessIterator __i = __middle; __i != __last; ++__i, (void) ++__buf_end)
+  {
+    *__buf_end = _Ops::__iter_move(__i);
+  }
+
+  while (__buf != __buf_end)
+  {
+    if (__middle == __first)
+    {
+      while (__buf != __buf_end)
+      {
+        *--__last = _CUDA_VSTD::move(*--__buf_end);
+      }
+      return;
+    }
+
+    if (__comp(*(__buf_end - 1), *(__middle - 1)))
+    {
+      *--__last = _Ops::__iter_move(--__middle);
+    }
+    else
+    {
+      *--__last = _CUDA_VSTD::move(*--__buf_end);
+    }
+  }
+  // whatever is left of the left run already is in place
+}
+
+// Merges the sorted runs [__first, __middle) and [__middle, __last). Runs that fit into the buffer are merged through
+// it, longer ones are split with a rotation into two independent merges of smaller runs.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, class _Buffer>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void __stable_merge(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __middle,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len1,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len2,
+  _Buffer& __buf)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  __identity __proj;
+
+  while (true)
+  {
+    if (__len1 == 0 || __len2 == 0)
+    {
+      return;
+    }
+
+    // skip the prefix of the left run that already is in place
+    for (; !__comp(*__middle, *__first); ++__first, (void) --__len1)
+    {
+      if (__len1 == 1)
+      {
+        return;
+      }
+    }
+
+    if (__len1 <= _Buffer::__size)
+    {
+      _CUDA_VSTD::__buffered_merge_forward<_AlgPolicy, _Compare>(__first, __middle, __last, __comp, __buf.__begin());
+      return;
+    }
+    if (__len2 <= _Buffer::__size)
+    {
+      _CUDA_VSTD::__buffered_merge_backward<_AlgPolicy, _Compare>(__first, __middle, __last, __comp, __buf.__begin());
+      return;
+    }
+
+    // [__first, __m1) and [__middle, __m2) precede [__m1, __middle) and [__m2, __last) in the merged sequence
+    _RandomAccessIterator __m1 = __first;
+    _RandomAccessIterator __m2 = __middle;
+    difference_type __len11    = 0;
+    difference_type __len21    = 0;
+    if (__len1 < __len2)
+    {
+      __len21 = __len2 / 2;
+      __m2    = __middle + __len21;
+      __m1    = _CUDA_VSTD::__upper_bound<_AlgPolicy>(__first, __middle, *__m2, __comp, __proj);
+      __len11 = __m1 - __first;
+    }
+    else
+    {
+      if (__len1 == 1)
+      {
+        // __len2 is 1 as well and *__middle < *__first
+        _Ops::iter_swap(__first, __middle);
+        return;
+      }
+      __len11 = __len1 / 2;
+      __m1    = __first + __len11;
+      __m2    = _CUDA_VSTD::__lower_bound<_AlgPolicy>(__middle, __last, *__m1, __comp, __proj);
+      __len21 = __m2 - __middle;
+    }
+    const difference_type __len12 = __len1 - __len11;
+    const difference_type __len22 = __len2 - __len21;
+
+    __middle = _CUDA_VSTD::__rotate<_AlgPolicy>(__m1, __middle, __m2).first;
+
+    // recurse into the shorter merge and continue with the longer one
+    if (__len11 + __len21 < __len12 + __len22)
+    {
+      _CUDA_VSTD::__stable_merge<_AlgPolicy, _Compare>(__first, __m1, __middle, __comp, __len11, __len21, __buf);
+      __first  = __middle;
+      __middle = __m2;
+      __len1   = __len12;
+      __len2   = __len22;
+    }
+    else
+    {
+      _CUDA_VSTD::__stable_merge<_AlgPolicy, _Compare>(__middle, __m2, __last, __comp, __len12, __len22, __buf);
+      __last   = __middle;
+      __middle = __m1;
+      __len1   = __len11;
+      __len2   = __len21;
+    }
+  }
+}
+
+// Bottom up merge sort of insertion sorted runs, without allocating.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__stable_sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const difference_type __len = __last - __first;
+  const difference_type __run = _LIBCUDACXX_STABLE_SORT_RUN_LENGTH;
+
+  difference_type __i = 0;
+  for (; __len - __i > __run; __i += __run)
+  {
+    _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first + __i, __first + (__i + __run), __comp);
+  }
+  _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first + __i, __last, __comp);
+
+  if (__len <= __run)
+  {
+    return;
+  }
+
+  __stable_sort_buffer<value_type> __buf;
+
+  for (difference_type __width = __run; __width < __len; __width *= 2)
+  {
+    for (difference_type __left = 0; __len - __left > __width; __left += 2 * __width)
+    {
+      const _RandomAccessIterator __middle = __first + (__left + __width);
+      const difference_type __right_len    = _CUDA_VSTD::min(__width, __len - (__left + __width));
+
+      // adjacent runs that already are in order need no merge
+      if (__comp(*__middle, *(__middle - 1)))
+      {
+        _CUDA_VSTD::__stable_merge<_AlgPolicy, _Compare>(
+          __first + __left, __middle, __middle + __right_len, __comp, __width, __right_len, __buf);
+      }
+    }
+  }
+}
+
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+__stable_sort_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare& __comp)
+{
+  if (__last - __first < 2)
+  {
+    return;
+  }
+
+  using _Comp_ref = __comp_ref_type<_Compare>;
+  _CUDA_VSTD::__stable_sort<_AlgPolicy, _Comp_ref>(__first, __last, __comp);
+}
+
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+stable_sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__stable_sort_impl<_ClassicAlgPolicy>(_CUDA_VSTD::move(__first), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI _CCCL_CONSTEXPR_CXX14 void
+stable_sort(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::stable_sort(__first, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ATOMIC_WAIT_PARKING_H
+#define _LIBCUDACXX___ATOMIC_WAIT_PARKING_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__atomic/order.h>
+#include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types.h>
+#include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/chrono>
+#include <cuda/std/cstdint>
+
+// Host threads that wait on an atomic are parked on a futex taken from a table of slots indexed by the atomic's
+// address. Notifiers only enter the kernel when the slot has waiters. Slots are shared between addresses, so a
+// notification wakes every thread parked on the slot and each of them re-checks its own atomic.
+//
+// Defining _LIBCUDACXX_HAS_NO_ATOMIC_PARKING keeps the previous behavior of polling with an exponential backoff.
+#if defined(_LIBCUDACXX_HAS_FUTEX) && !defined(_LIBCUDACXX_HAS_NO_ATOMIC_PARKING)
+#  define _LIBCUDACXX_HAS_ATOMIC_PARKING
+#endif // _LIBCUDACXX_HAS_FUTEX && !_LIBCUDACXX_HAS_NO_ATOMIC_PARKING
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if defined(_LIBCUDACXX_HAS_ATOMIC_PARKING)
+
+#  define _LIBCUDACXX_PARKING_SLOT_COUNT 256
+
+struct alignas(64) __cccl_parking_slot
+{
+  // bumped by every notification that finds waiters, waiters sleep as long as it is unchanged
+  int __version;
+  int __waiters;
+};
+
+// The table is a host variable. Its static data member is a template so that it is defined in every translation unit
+// that includes this header, and it is not hidden so that every shared object in the process agrees on one table.
+template <typename _Dummy = void>
+struct __cccl_parking_table
+{
+  _CCCL_VISIBILITY_DEFAULT static __cccl_parking_slot __slots[_LIBCUDACXX_PARKING_SLOT_COUNT];
+};
+
+template <typename _Dummy>
+__cccl_parking_slot __cccl_parking_table<_Dummy>::__slots[_LIBCUDACXX_PARKING_SLOT_COUNT];
+
+_LIBCUDACXX_HIDE_FROM_ABI __cccl_parking_slot& __cccl_parking_slot_for(void const volatile* __a)
+{
+  const uintptr_t __key = reinterpret_cast<uintptr_t>(__a);
+  return __cccl_parking_table<>::__slots[((__key >> 2) ^ (__key >> 12)) % _LIBCUDACXX_PARKING_SLOT_COUNT];
+}
+
+// The timeout of a parked waiter only bounds the damage of a notifier that does not share this table. Device and
+// system scope atomics may be notified by a device, or by another process through shared memory, so their waiters
+// never sleep longer than the backoff of __cccl_thread_poll_with_backoff would.
+template <typename _Sco>
+_LIBCUDACXX_HIDE_FROM_ABI _CUDA_VSTD::chrono::milliseconds __atomic_parking_timeout(_Sco)
+{
+  return _CUDA_VSTD::chrono::milliseconds(10);
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI _CUDA_VSTD::chrono::milliseconds __atomic_parking_timeout(__thread_scope_device_tag)
+{
+  return _CUDA_VSTD::chrono::milliseconds(1);
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI _CUDA_VSTD::chrono::milliseconds __atomic_parking_timeout(__thread_scope_system_tag)
+{
+  return _CUDA_VSTD::chrono::milliseconds(1);
+}
+
+template <typename _Tp, typename _Sco>
+_LIBCUDACXX_HIDE_FROM_ABI void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  __cccl_parking_slot& __slot = __cccl_parking_slot_for(__a);
+
+  // The read-modify-writes on __waiters are totally ordered: either the notifier's comes later and sees this waiter,
+  // or it comes first and this waiter sees the value that was stored before the notification.
+  __atomic_fetch_add(&__slot.__waiters, 1, __ATOMIC_ACQ_REL);
+  const int __version = __atomic_load_n(&__slot.__version, __ATOMIC_ACQUIRE);
+  if (!__atomic_poll_tester<_Tp, _Sco>(__a, __val, __order)())
+  {
+    _CUDA_VSTD::__cccl_futex_wait(&__slot.__version, __version, __atomic_parking_timeout(_Sco{}));
+  }
+  __atomic_fetch_sub(&__slot.__waiters, 1, __ATOMIC_RELAXED);
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI void __atomic_notify_host(void const volatile* __a)
+{
+  __cccl_parking_slot& __slot = __cccl_parking_slot_for(__a);
+
+  if (__atomic_fetch_add(&__slot.__waiters, 0, __ATOMIC_ACQ_REL) != 0)
+  {
+    __atomic_fetch_add(&__slot.__version, 1, __ATOMIC_RELEASE);
+    _CUDA_VSTD::__cccl_futex_wake_all(&__slot.__version);
+  }
+}
+
+#else // ^^^ _LIBCUDACXX_HAS_ATOMIC_PARKING ^^^ / vvv !_LIBCUDACXX_HAS_ATOMIC_PARKING vvv
+
+template <typename _Tp, typename _Sco>
+_LIBCUDACXX_HIDE_FROM_ABI void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI void __atomic_notify_host(void const volatile*) {}
+
+#endif // !_LIBCUDACXX_HAS_ATOMIC_PARKING
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ATOMIC_WAIT_PARKING_H
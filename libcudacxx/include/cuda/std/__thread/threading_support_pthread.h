@@ -163,6 +163,24 @@ __cccl_semaphore_wait_timed(__cccl_semaphore_t* __sem, _CUDA_VSTD::chrono::nanos
 
 #  endif // !__APPLE__
 
+// Futex
+#  if defined(__linux__)
+#    define _LIBCUDACXX_HAS_FUTEX
+
+_LIBCUDACXX_HIDE_FROM_ABI void
+__cccl_futex_wait(int const volatile* __addr, int __expected, _CUDA_VSTD::chrono::nanoseconds const& __ns)
+{
+  // returns early on a mismatch, a wake, a signal or once the relative timeout expires; callers re-check
+  __cccl_timespec_t __ts = __cccl_to_timespec(__ns);
+  ::syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __expected, &__ts, nullptr, 0);
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI void __cccl_futex_wake_all(int const volatile* __addr)
+{
+  ::syscall(SYS_futex, __addr, FUTEX_WAKE_PRIVATE, numeric_limits<int>::max(), nullptr, nullptr, 0);
+}
+#  endif // __linux__
+
 _LIBCUDACXX_HIDE_FROM_ABI void __cccl_thread_yield()
 {
   sched_yield();
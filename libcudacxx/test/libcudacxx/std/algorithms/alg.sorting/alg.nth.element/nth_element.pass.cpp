@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter>
+//   requires ShuffleIterator<Iter> && LessThanComparable<Iter::value_type>
+//   constexpr void  // constexpr in C++20
+//   nth_element(Iter first, Iter nth, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "../sort_patterns.h"
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class T>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void check_nth(const T* work, int nth, int n)
+{
+  for (int i = 0; i < nth; ++i)
+  {
+    assert(!(work[nth] < work[i]));
+  }
+  for (int i = nth + 1; i < n; ++i)
+  {
+    assert(!(work[i] < work[nth]));
+  }
+}
+
+template <class T, class Iter>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_small()
+{
+  int orig[15] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  T work[15]   = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  for (int n = 0; n < 15; ++n)
+  {
+    for (int m = 0; m < n; ++m)
+    {
+      cuda::std::nth_element(Iter(work), Iter(work + m), Iter(work + n));
+      assert(cuda::std::is_permutation(work, work + n, orig));
+      check_nth(work, m, n);
+      cuda::std::copy(orig, orig + 15, work);
+    }
+    // nth == last is a no-op
+    cuda::std::nth_element(Iter(work), Iter(work + n), Iter(work + n));
+    assert(cuda::std::equal(work, work + 15, orig));
+  }
+}
+
+template <class T, class Iter, int n>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_patterns()
+{
+  int orig[n]      = {};
+  T work[n]        = {};
+  const int nths[] = {0, n / 3, n - 1};
+  for (int p = 0; p < num_sort_patterns; ++p)
+  {
+    fill_sort_pattern(orig, n, SortPattern(p));
+    for (int nth : nths)
+    {
+      fill_sort_pattern(work, n, SortPattern(p));
+      cuda::std::nth_element(Iter(work), Iter(work + nth), Iter(work + n));
+      assert(cuda::std::is_permutation(work, work + n, orig));
+      check_nth(work, nth, n);
+    }
+  }
+}
+
+__host__ __device__ TEST_CONSTEXPR_CXX14 bool test()
+{
+  int i = 42;
+  cuda::std::nth_element(&i, &i, &i); // no-op
+  assert(i == 42);
+
+  test_small<int, random_access_iterator<int*>>();
+  test_small<int, int*>();
+  test_small<MoveOnly, random_access_iterator<MoveOnly*>>();
+  test_small<MoveOnly, MoveOnly*>();
+
+  test_patterns<int, random_access_iterator<int*>, 130>();
+
+  return true;
+}
+
+__host__ __device__ void test_long()
+{
+  test_patterns<int, int*, 2000>();
+  test_patterns<MoveOnly, MoveOnly*, 2000>();
+  test_patterns<MoveOnly, random_access_iterator<MoveOnly*>, 2000>();
+}
+
+int main(int, char**)
+{
+  test();
+  test_long();
+#if TEST_STD_VER >= 2014 && defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // TEST_STD_VER >= 2014 && _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
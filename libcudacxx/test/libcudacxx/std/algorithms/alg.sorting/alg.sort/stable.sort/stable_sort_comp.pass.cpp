@@ -0,0 +1,147 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter> && CopyConstructible<Compare>
+//   constexpr void  // constexpr in C++26
+//   stable_sort(Iter first, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "../../sort_patterns.h"
+#include "../../sortable_helpers.h"
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+// trivially default constructible, merged through the stack buffer
+struct KeyValue
+{
+  int key;
+  int value;
+};
+
+struct KeyGreater
+{
+  __host__ __device__ constexpr bool operator()(const KeyValue& a, const KeyValue& b) const
+  {
+    return a.key > b.key;
+  }
+};
+
+template <class T, class Iter>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_small()
+{
+  int orig[15] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  T work[15]   = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  for (int n = 0; n < 15; ++n)
+  {
+    cuda::std::stable_sort(Iter(work), Iter(work + n), cuda::std::greater<T>());
+    assert(cuda::std::is_sorted(work, work + n, cuda::std::greater<T>()));
+    assert(cuda::std::is_permutation(work, work + n, orig));
+    cuda::std::copy(orig, orig + 15, work);
+  }
+}
+
+template <class T, class Iter, int n>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_patterns()
+{
+  int orig[n] = {};
+  T work[n]   = {};
+  for (int p = 0; p < num_sort_patterns; ++p)
+  {
+    fill_sort_pattern(orig, n, SortPattern(p));
+    fill_sort_pattern(work, n, SortPattern(p));
+    cuda::std::stable_sort(Iter(work), Iter(work + n), cuda::std::greater<T>());
+    assert(cuda::std::is_sorted(work, work + n, cuda::std::greater<T>()));
+    assert(cuda::std::is_permutation(work, work + n, orig));
+  }
+}
+
+// the Comparator of TrivialSortableWithComp and NonTrivialSortableWithComp compares by value / 10, equivalent
+// elements must keep their order
+template <class T, int n>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_stability_sortable()
+{
+  for (int p = 0; p < num_sort_patterns; ++p)
+  {
+    T work[n] = {};
+    for (int i = 0; i < n; ++i)
+    {
+      work[i] = T(10 * (sort_pattern_value(SortPattern(p), i, n) % 23) + (i * 10 / n));
+    }
+    cuda::std::stable_sort(work, work + n, typename T::Comparator());
+    assert(cuda::std::is_sorted(work, work + n, T::less));
+  }
+}
+
+template <int n>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void test_stability_key_value()
+{
+  for (int p = 0; p < num_sort_patterns; ++p)
+  {
+    KeyValue work[n] = {};
+    for (int i = 0; i < n; ++i)
+    {
+      work[i] = KeyValue{sort_pattern_value(SortPattern(p), i, n) % 23, i};
+    }
+    cuda::std::stable_sort(work, work + n, KeyGreater());
+    for (int i = 1; i < n; ++i)
+    {
+      assert(work[i - 1].key > work[i].key || (work[i - 1].key == work[i].key && work[i - 1].value < work[i].value));
+    }
+  }
+}
+
+__host__ __device__ TEST_CONSTEXPR_CXX14 bool test()
+{
+  int i = 42;
+  cuda::std::stable_sort(&i, &i, cuda::std::greater<int>()); // no-op
+  assert(i == 42);
+
+  test_small<int, random_access_iterator<int*>>();
+  test_small<int, int*>();
+  test_small<MoveOnly, random_access_iterator<MoveOnly*>>();
+  test_small<MoveOnly, MoveOnly*>();
+
+  test_patterns<int, random_access_iterator<int*>, 150>();
+  test_patterns<MoveOnly, MoveOnly*, 150>();
+
+  test_stability_sortable<TrivialSortableWithComp, 150>();
+  test_stability_key_value<150>();
+
+  return true;
+}
+
+// long enough for merges that do not fit into the stack buffer
+__host__ __device__ void test_long()
+{
+  test_patterns<int, int*, 2000>();
+  test_patterns<MoveOnly, random_access_iterator<MoveOnly*>, 2000>();
+
+  test_stability_sortable<TrivialSortableWithComp, 2000>();
+  test_stability_sortable<NonTrivialSortableWithComp, 2000>();
+  test_stability_key_value<2000>();
+}
+
+int main(int, char**)
+{
+  test();
+  test_long();
+#if TEST_STD_VER >= 2014 && defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // TEST_STD_VER >= 2014 && _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SORT_PATTERNS_H
+#define SORT_PATTERNS_H
+
+#include "test_macros.h"
+
+// Inputs that are known to trip up quicksort and merge sort variants
+enum class SortPattern
+{
+  Ascending,
+  Descending,
+  AllEqual,
+  FewUnique,
+  OrganPipe,
+  Sawtooth,
+  AscendingThenSmallest,
+  Random,
+};
+
+constexpr int num_sort_patterns = 8;
+
+__host__ __device__ TEST_CONSTEXPR_CXX14 int sort_pattern_value(SortPattern pattern, int i, int n)
+{
+  switch (pattern)
+  {
+    case SortPattern::Ascending:
+      return i;
+    case SortPattern::Descending:
+      return n - i;
+    case SortPattern::AllEqual:
+      return 42;
+    case SortPattern::FewUnique:
+      return (i * 7) % 5;
+    case SortPattern::OrganPipe:
+      return i < n / 2 ? i : n - i;
+    case SortPattern::Sawtooth:
+      return i % 16;
+    case SortPattern::AscendingThenSmallest:
+      return i + 1 < n ? i + 1 : 0;
+    case SortPattern::Random:
+    default:
+      return static_cast<int>((static_cast<unsigned>(i) * 2654435761u) >> 20);
+  }
+}
+
+template <class T>
+__host__ __device__ TEST_CONSTEXPR_CXX14 void fill_sort_pattern(T* first, int n, SortPattern pattern)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    first[i] = T(sort_pattern_value(pattern, i, n));
+  }
+}
+
+#endif // SORT_PATTERNS_H
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+
+#include <limits>
+
+#include "nvbench_helper.cuh"
+
+template <class T>
+struct less_then_t
+{
+  T m_val;
+
+  __host__ __device__ bool operator()(const T& val) const
+  {
+    return val < m_val;
+  }
+};
+
+// the threshold below which the given fraction of uniformly distributed values lies
+template <typename T>
+T threshold_from_selectivity(double selectivity)
+{
+  const auto max_val = static_cast<double>(std::numeric_limits<T>::max());
+  const auto min_val = static_cast<double>(std::numeric_limits<T>::lowest());
+  return static_cast<T>(min_val + selectivity * (max_val - min_val));
+}
+
+template <typename T>
+static void basic(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements    = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto selectivity = state.get_float64("Selectivity");
+
+  less_then_t<T> select_op{threshold_from_selectivity<T>(selectivity)};
+
+  thrust::device_vector<T> input = generate(elements);
+  const auto selected_elements   = thrust::count_if(input.cbegin(), input.cend(), select_op);
+  thrust::device_vector<T> output(selected_elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(selected_elements);
+
+  caching_allocator_t alloc;
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    thrust::copy_if(policy(alloc, launch), input.cbegin(), input.cend(), output.begin(), select_op);
+  });
+}
+
+using types = nvbench::type_list<int32_t, int64_t>;
+
+NVBENCH_BENCH_TYPES(basic, NVBENCH_TYPE_AXES(types))
+  .set_name("base")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_float64_axis("Selectivity", std::vector{0.0, 0.01, 0.1, 0.5, 0.9, 0.99, 1.0});
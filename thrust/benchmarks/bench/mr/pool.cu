@@ -0,0 +1,195 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/sharded_pool.h>
+#include <thrust/mr/sync_pool.h>
+#include <thrust/mr/tls_pool.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Threads that outlive a single measurement, so that thread-local pools stay warm between runs, like they would in a
+// long-running host worker pool.
+class worker_group
+{
+public:
+  explicit worker_group(std::size_t num_threads)
+  {
+    for (std::size_t i = 0; i < num_threads; ++i)
+    {
+      m_threads.emplace_back([this, i] {
+        work(i);
+      });
+    }
+  }
+
+  ~worker_group()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      m_stop = true;
+    }
+    m_start.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  // runs task(thread_index) on every thread and waits for all of them to finish
+  void run(std::function<void(std::size_t)> task)
+  {
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_task    = std::move(task);
+    m_pending = m_threads.size();
+    ++m_generation;
+    m_start.notify_all();
+    m_done.wait(lock, [this] {
+      return m_pending == 0;
+    });
+  }
+
+private:
+  void work(std::size_t thread_index)
+  {
+    std::size_t generation = 0;
+
+    while (true)
+    {
+      std::function<void(std::size_t)> task;
+      {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_start.wait(lock, [&] {
+          return m_stop || m_generation != generation;
+        });
+
+        if (m_stop)
+        {
+          return;
+        }
+
+        generation = m_generation;
+        task       = m_task;
+      }
+
+      task(thread_index);
+
+      std::lock_guard<std::mutex> lock(m_mtx);
+      if (--m_pending == 0)
+      {
+        m_done.notify_one();
+      }
+    }
+  }
+
+  std::vector<std::thread> m_threads;
+  std::mutex m_mtx;
+  std::condition_variable m_start;
+  std::condition_variable m_done;
+  std::function<void(std::size_t)> m_task;
+  std::size_t m_generation = 0;
+  std::size_t m_pending    = 0;
+  bool m_stop              = false;
+};
+
+// Every thread repeatedly allocates a batch of blocks of mixed sizes, like temporary_array traffic, and frees it.
+template <typename Resource>
+void alloc_free(Resource& resource, std::size_t batches, std::size_t batch_size)
+{
+  std::vector<void*> blocks(batch_size);
+
+  for (std::size_t batch = 0; batch < batches; ++batch)
+  {
+    for (std::size_t i = 0; i < batch_size; ++i)
+    {
+      blocks[i] = resource.do_allocate(std::size_t{64} << (i % 8));
+    }
+
+    for (std::size_t i = 0; i < batch_size; ++i)
+    {
+      resource.do_deallocate(blocks[i], std::size_t{64} << (i % 8));
+    }
+  }
+}
+
+static void alloc_free(nvbench::state& state)
+{
+  using upstream_t = thrust::mr::new_delete_resource;
+
+  const auto threads          = static_cast<std::size_t>(state.get_int64("Threads"));
+  const std::string pool_name = state.get_string("Pool");
+
+  const std::size_t batches    = 64;
+  const std::size_t batch_size = 64;
+
+  upstream_t upstream;
+  thrust::mr::synchronized_pool_resource<upstream_t> sync_pool(&upstream);
+  thrust::mr::sharded_pool_resource<upstream_t> sharded_pool(&upstream);
+
+  worker_group workers(threads);
+
+  std::function<void(std::size_t)> task;
+  if (pool_name == "sync")
+  {
+    task = [&](std::size_t) {
+      alloc_free(sync_pool, batches, batch_size);
+    };
+  }
+  else if (pool_name == "tls")
+  {
+    task = [&](std::size_t) {
+      alloc_free(thrust::mr::tls_pool<upstream_t, void>(&upstream), batches, batch_size);
+    };
+  }
+  else
+  {
+    task = [&](std::size_t) {
+      alloc_free(sharded_pool, batches, batch_size);
+    };
+  }
+
+  // allocations and deallocations
+  state.add_element_count(2 * threads * batches * batch_size);
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    workers.run(task);
+  });
+}
+
+NVBENCH_BENCH(alloc_free)
+  .set_name("base")
+  .add_string_axis("Pool", {"sync", "tls", "sharded"})
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 6, 2));
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/partition.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include <limits>
+
+#include "nvbench_helper.cuh"
+
+// Compares the parallel host system the benchmarks are built for, if any, against the sequential one. The inputs live
+// in host memory either way.
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <thrust/system/omp/execution_policy.h>
+
+static const std::vector<std::string> backends{"cpp", "omp"};
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <thrust/system/tbb/execution_policy.h>
+
+static const std::vector<std::string> backends{"cpp", "tbb"};
+#else
+static const std::vector<std::string> backends{"cpp"};
+#endif
+
+template <typename F>
+void with_backend(const std::string& backend, F f)
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  if (backend == "omp")
+  {
+    f(thrust::omp::par);
+    return;
+  }
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  if (backend == "tbb")
+  {
+    f(thrust::tbb::par);
+    return;
+  }
+#endif
+  f(thrust::cpp::par);
+}
+
+template <class T>
+struct less_then_t
+{
+  T m_val;
+
+  __host__ __device__ bool operator()(const T& val) const
+  {
+    return val < m_val;
+  }
+};
+
+template <typename T>
+T value_from_entropy(double percentage)
+{
+  if (percentage == 1)
+  {
+    return std::numeric_limits<T>::max();
+  }
+
+  const auto max_val = static_cast<double>(std::numeric_limits<T>::max());
+  const auto min_val = static_cast<double>(std::numeric_limits<T>::lowest());
+  const auto result  = min_val + percentage * max_val - percentage * min_val;
+  return static_cast<T>(result);
+}
+
+template <typename T>
+static void copy(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bit_entropy entropy = str_to_entropy(state.get_string("Entropy"));
+
+  less_then_t<T> select_op{value_from_entropy<T>(entropy_to_probability(entropy))};
+
+  const thrust::host_vector<T> input = thrust::device_vector<T>(generate(elements));
+  thrust::host_vector<T> output(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  with_backend(state.get_string("Backend"), [&](auto exec) {
+    state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+      thrust::partition_copy(
+        exec,
+        input.cbegin(),
+        input.cend(),
+        output.begin(),
+        thrust::make_reverse_iterator(output.begin() + elements),
+        select_op);
+    });
+  });
+}
+
+template <typename T>
+static void in_place(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bit_entropy entropy = str_to_entropy(state.get_string("Entropy"));
+
+  less_then_t<T> select_op{value_from_entropy<T>(entropy_to_probability(entropy))};
+
+  const thrust::host_vector<T> input = thrust::device_vector<T>(generate(elements));
+  thrust::host_vector<T> vec(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  with_backend(state.get_string("Backend"), [&](auto exec) {
+    state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch&, auto& timer) {
+      vec = input;
+      timer.start();
+      thrust::stable_partition(exec, vec.begin(), vec.end(), select_op);
+      timer.stop();
+    });
+  });
+}
+
+using types = nvbench::type_list<int32_t, int64_t>;
+
+NVBENCH_BENCH_TYPES(copy, NVBENCH_TYPE_AXES(types))
+  .set_name("host_copy")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.544", "0.000"})
+  .add_string_axis("Backend", backends);
+
+NVBENCH_BENCH_TYPES(in_place, NVBENCH_TYPE_AXES(types))
+  .set_name("host_in_place")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.544", "0.000"})
+  .add_string_axis("Backend", backends);
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/unique.h>
+
+#include "nvbench_helper.cuh"
+
+// Compares the parallel host system the benchmarks are built for, if any, against the sequential one. The inputs live
+// in host memory either way.
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <thrust/system/omp/execution_policy.h>
+
+static const std::vector<std::string> backends{"cpp", "omp"};
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <thrust/system/tbb/execution_policy.h>
+
+static const std::vector<std::string> backends{"cpp", "tbb"};
+#else
+static const std::vector<std::string> backends{"cpp"};
+#endif
+
+template <typename F>
+void with_backend(const std::string& backend, F f)
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  if (backend == "omp")
+  {
+    f(thrust::omp::par);
+    return;
+  }
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  if (backend == "tbb")
+  {
+    f(thrust::tbb::par);
+    return;
+  }
+#endif
+  f(thrust::cpp::par);
+}
+
+// Segments of either exactly SegSize keys, or of a uniformly distributed size in [1, SegSize], from single element
+// segments to segments which span several tiles of the parallel systems.
+template <class KeyT, class ValueT>
+static void segments(nvbench::state& state, nvbench::type_list<KeyT, ValueT>)
+{
+  const auto elements                = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto max_segment_size        = static_cast<std::size_t>(state.get_int64("SegSize"));
+  const std::size_t min_segment_size = state.get_string("Sizes") == "fixed" ? max_segment_size : 1;
+
+  const thrust::host_vector<KeyT> in_keys =
+    thrust::device_vector<KeyT>(generate.uniform.key_segments(elements, min_segment_size, max_segment_size));
+  const thrust::host_vector<ValueT> in_vals = thrust::device_vector<ValueT>(generate(elements));
+
+  thrust::host_vector<KeyT> out_keys = in_keys;
+  const std::size_t unique_keys = thrust::distance(out_keys.begin(), thrust::unique(out_keys.begin(), out_keys.end()));
+  thrust::host_vector<ValueT> out_vals(unique_keys);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<KeyT>(elements);
+  state.add_global_memory_reads<ValueT>(elements);
+  state.add_global_memory_writes<KeyT>(unique_keys);
+  state.add_global_memory_writes<ValueT>(unique_keys);
+
+  with_backend(state.get_string("Backend"), [&](auto exec) {
+    state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+      thrust::reduce_by_key(
+        exec, in_keys.cbegin(), in_keys.cend(), in_vals.cbegin(), out_keys.begin(), out_vals.begin());
+    });
+  });
+}
+
+using key_types   = nvbench::type_list<int32_t, int64_t>;
+using value_types = nvbench::type_list<int32_t, double>;
+
+NVBENCH_BENCH_TYPES(segments, NVBENCH_TYPE_AXES(key_types, value_types))
+  .set_name("host_segments")
+  .set_type_axes_names({"KeyT{ct}", "ValueT{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(20, 28, 4))
+  .add_int64_power_of_two_axis("SegSize", {0, 2, 4, 8, 12, 16, 20})
+  .add_string_axis("Sizes", {"uniform", "fixed"})
+  .add_string_axis("Backend", backends);
@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sequence.h>
+#include <thrust/set_operations.h>
+
+#include "nvbench_helper.cuh"
+
+// Intersects two sorted lists of unique ids, the multiples of two and the multiples of three
+template <typename T>
+static void intersection(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements      = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto size_ratio    = static_cast<std::size_t>(state.get_int64("SizeRatio"));
+  const auto elements_in_A = static_cast<std::size_t>(static_cast<double>(size_ratio * elements) / 100.0f);
+
+  thrust::device_vector<T> input(elements);
+  thrust::device_vector<T> output(elements);
+
+  thrust::sequence(input.begin(), input.begin() + elements_in_A, T{0}, T{2});
+  thrust::sequence(input.begin() + elements_in_A, input.end(), T{0}, T{3});
+
+  caching_allocator_t alloc;
+  // not a warm-up run, we need to run once to determine the size of the output
+  const auto result_end = thrust::set_intersection(
+    policy(alloc),
+    input.cbegin(),
+    input.cbegin() + elements_in_A,
+    input.cbegin() + elements_in_A,
+    input.cend(),
+    output.begin());
+  const std::size_t elements_in_AB = thrust::distance(output.begin(), result_end);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements_in_AB);
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    thrust::set_intersection(
+      policy(alloc, launch),
+      input.cbegin(),
+      input.cbegin() + elements_in_A,
+      input.cbegin() + elements_in_A,
+      input.cend(),
+      output.begin());
+  });
+}
+
+using types = nvbench::type_list<int32_t, int64_t>;
+
+NVBENCH_BENCH_TYPES(intersection, NVBENCH_TYPE_AXES(types))
+  .set_name("intersection")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_int64_axis("SizeRatio", {1, 25, 50});
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/random.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include "nvbench_helper.cuh"
+
+// Compares the parallel host system the benchmarks are built for, if any, against the sequential one. The inputs live
+// in host memory either way.
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <thrust/system/omp/execution_policy.h>
+
+static const std::vector<std::string> backends{"cpp", "omp"};
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <thrust/system/tbb/execution_policy.h>
+
+static const std::vector<std::string> backends{"cpp", "tbb"};
+#else
+static const std::vector<std::string> backends{"cpp"};
+#endif
+
+template <typename F>
+void with_backend(const std::string& backend, F f)
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  if (backend == "omp")
+  {
+    f(thrust::omp::par);
+    return;
+  }
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  if (backend == "tbb")
+  {
+    f(thrust::tbb::par);
+    return;
+  }
+#endif
+  f(thrust::cpp::par);
+}
+
+template <typename T>
+static void copy(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  const thrust::host_vector<T> input = thrust::device_vector<T>(generate(elements));
+  thrust::host_vector<T> output(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  with_backend(state.get_string("Backend"), [&](auto exec) {
+    state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+      thrust::shuffle_copy(exec, input.cbegin(), input.cend(), output.begin(), thrust::default_random_engine{});
+    });
+  });
+}
+
+template <typename T>
+static void in_place(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  thrust::host_vector<T> data = thrust::device_vector<T>(generate(elements));
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  with_backend(state.get_string("Backend"), [&](auto exec) {
+    state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+      thrust::shuffle(exec, data.begin(), data.end(), thrust::default_random_engine{});
+    });
+  });
+}
+
+using types = nvbench::type_list<int32_t, int64_t>;
+
+NVBENCH_BENCH_TYPES(copy, NVBENCH_TYPE_AXES(types))
+  .set_name("host_copy")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Backend", backends);
+
+NVBENCH_BENCH_TYPES(in_place, NVBENCH_TYPE_AXES(types))
+  .set_name("host_in_place")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Backend", backends);
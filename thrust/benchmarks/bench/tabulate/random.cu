@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/random.h>
+#include <thrust/tabulate.h>
+
+#include <nvbench_helper.cuh>
+
+NVBENCH_DECLARE_TYPE_STRINGS(thrust::random::philox4x32, "philox4x32", "philox4x32");
+NVBENCH_DECLARE_TYPE_STRINGS(thrust::random::philox4x64, "philox4x64", "philox4x64");
+NVBENCH_DECLARE_TYPE_STRINGS(thrust::random::threefry4x32, "threefry4x32", "threefry4x32");
+
+// every element jumps to its own position of the engine's sequence, which encrypts each block once per element
+template <class Engine>
+struct discard_to_index_t
+{
+  Engine engine;
+
+  template <class IndexT>
+  __host__ __device__ typename Engine::result_type operator()(IndexT i) const
+  {
+    Engine e = engine;
+    e.discard(static_cast<unsigned long long>(i));
+    return e();
+  }
+};
+
+template <class Engine>
+static void basic(nvbench::state& state, nvbench::type_list<Engine>)
+{
+  using T = typename Engine::result_type;
+
+  const auto elements    = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string path = state.get_string("Path");
+
+  thrust::device_vector<T> output(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  Engine engine(42);
+
+  caching_allocator_t alloc;
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    if (path == "tabulate")
+    {
+      thrust::tabulate(policy(alloc, launch), output.begin(), output.end(), discard_to_index_t<Engine>{engine});
+    }
+    else
+    {
+      thrust::random::generate_random(policy(alloc, launch), output.begin(), output.end(), engine);
+    }
+  });
+}
+
+using engines = nvbench::type_list<thrust::random::philox4x32, thrust::random::threefry4x32, thrust::random::philox4x64>;
+
+NVBENCH_BENCH_TYPES(basic, NVBENCH_TYPE_AXES(engines))
+  .set_name("random")
+  .set_type_axes_names({"Engine{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Path", {"tabulate", "generate_random"});
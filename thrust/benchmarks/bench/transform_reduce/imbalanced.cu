@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <cstdint>
+
+#include "nvbench_helper.cuh"
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <thrust/system/omp/execution_policy.h>
+
+// a static split of the input hands the cheapest block to the first thread and the most expensive one to the last
+static const std::vector<std::string> schedules{"static", "dynamic", "guided"};
+
+auto schedule_policy(const std::string& schedule)
+{
+  const thrust::omp::schedule_kind kind = schedule == "dynamic" ? thrust::omp::schedule_kind::dynamic
+                                        : schedule == "guided"  ? thrust::omp::schedule_kind::guided
+                                                                : thrust::omp::schedule_kind::static_;
+  return thrust::omp::par.schedule(kind);
+}
+#else
+static const std::vector<std::string> schedules{"default"};
+
+auto schedule_policy(const std::string&)
+{
+  return thrust::device;
+}
+#endif
+
+// the cost of an element grows linearly with its index
+struct skewed_work_t
+{
+  std::uint32_t elements;
+  std::uint32_t max_iterations;
+
+  __host__ __device__ std::uint32_t operator()(std::uint32_t i) const
+  {
+    const auto iterations = static_cast<std::uint32_t>(std::uint64_t{i} * max_iterations / elements);
+
+    std::uint32_t state = i;
+    for (std::uint32_t it = 0; it < iterations; ++it)
+    {
+      state = state * 1664525u + 1013904223u;
+    }
+
+    return state;
+  }
+};
+
+static void imbalanced(nvbench::state& state)
+{
+  const auto elements       = static_cast<std::uint32_t>(state.get_int64("Elements"));
+  const auto max_iterations = static_cast<std::uint32_t>(state.get_int64("MaxIterations"));
+
+  state.add_element_count(elements);
+
+  const skewed_work_t op{elements, max_iterations};
+  const auto exec = schedule_policy(state.get_string("Schedule"));
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    do_not_optimize(thrust::transform_reduce(
+      exec,
+      thrust::counting_iterator<std::uint32_t>(0),
+      thrust::counting_iterator<std::uint32_t>(elements),
+      op,
+      std::uint32_t{},
+      thrust::plus<std::uint32_t>{}));
+  });
+}
+
+NVBENCH_BENCH(imbalanced)
+  .set_name("imbalanced")
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4))
+  .add_int64_axis("MaxIterations", {64, 1024})
+  .add_string_axis("Schedule", schedules);
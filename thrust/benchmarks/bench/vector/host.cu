@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/fill.h>
+#include <thrust/host_vector.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include "nvbench_helper.cuh"
+
+// an element which is not trivially copyable, but which may be relocated by copying its bytes
+struct relocatable_t
+{
+  std::int64_t value;
+
+  relocatable_t(std::int64_t value = 0)
+      : value(value)
+  {}
+
+  relocatable_t(const relocatable_t& other)
+      : value(other.value)
+  {}
+
+  relocatable_t& operator=(const relocatable_t&) = default;
+};
+
+THRUST_PROCLAIM_TRIVIALLY_RELOCATABLE(relocatable_t);
+
+NVBENCH_DECLARE_TYPE_STRINGS(relocatable_t, "relocatable", "relocatable_t");
+
+// resizes an empty vector and overwrites every element, as code preparing an output buffer does
+template <typename T>
+static void resize_then_fill(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements     = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bool default_init = state.get_string("Init") == "default";
+
+  state.add_element_count(elements);
+  state.add_global_memory_writes<T>(default_init ? elements : 2 * elements);
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    thrust::host_vector<T> vec;
+    if (default_init)
+    {
+      vec.resize(elements, thrust::default_init);
+    }
+    else
+    {
+      vec.resize(elements);
+    }
+    thrust::fill(thrust::cpp::par, vec.begin(), vec.end(), T{42});
+  });
+}
+
+// grows a vector one element at a time, which relocates its elements on every reallocation
+template <typename T>
+static void push_back(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  state.add_element_count(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    thrust::host_vector<T> vec;
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+      vec.push_back(T(static_cast<std::int64_t>(i)));
+    }
+  });
+}
+
+using types = nvbench::type_list<int32_t, int64_t, relocatable_t>;
+
+NVBENCH_BENCH_TYPES(resize_then_fill, NVBENCH_TYPE_AXES(nvbench::type_list<int32_t, int64_t>))
+  .set_name("host_resize_then_fill")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Init", {"value", "default"});
+
+NVBENCH_BENCH_TYPES(push_back, NVBENCH_TYPE_AXES(types))
+  .set_name("host_push_back")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(12, 24, 4));
@@ -0,0 +1,1109 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The main function of the Thrust benchmarks built for the host systems. It runs the benchmarks registered through
+// nvbench/nvbench.cuh with no CUDA runtime, and accepts the NVBench options that benchmarks/scripts pass to the
+// benchmarks, so that their results can be collected and analyzed as those of the CUDA benchmarks are:
+//
+//   -b, --benchmark <name or index>  runs the given benchmark only, may be repeated
+//   -a, --axis <name>=<values>       overrides the values of an axis of the last benchmark given, or of all of them
+//   --list                           prints the benchmarks and their axes
+//   --jsonlist-benches               prints the benchmarks and their axes as JSON
+//   --jsonlist-devices               prints the CPU the benchmarks run on as JSON
+//   --json <file>                    writes the results as JSON
+//   --jsonbin <file>                 writes the results as JSON, and the time of every sample to binary files
+//   --md <file>                      writes the results as Markdown
+//   --stopping-criterion <name>      stdrel (default) or entropy
+//   --min-samples, --min-time, --max-noise, --timeout, --max-angle, --min-r2  parameters of the stopping criteria
+//
+// The device is the CPU, and its number of SMs is the number of threads the parallel system may use. These may be set
+// with
+//
+//   --threads <counts>               e.g. 1,2,4,8 or [1:8]
+//
+// which runs every benchmark once for each thread count. Given more than one, the JSON results of each are written to
+// a file of their own, named <file>.threads-<count>.json, and the throughput of the states at every thread count is
+// summarized relative to the first one, as a scaling curve.
+
+#include <thrust/detail/config.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#  include <tbb/task_arena.h>
+#endif
+
+namespace nvbench
+{
+
+const axis_value& state::value_of(const std::string& name, axis_type type) const
+{
+  for (std::size_t i = 0; i < m_axes->size(); i++)
+  {
+    if ((*m_axes)[i].name == name && (*m_axes)[i].type == type)
+    {
+      return (*m_axes)[i].values[m_value_indices[i]];
+    }
+  }
+  throw std::runtime_error("no axis named '" + name + "' of the requested type");
+}
+
+namespace
+{
+
+float64_t mean_of(const std::vector<float64_t>& samples)
+{
+  float64_t sum = 0;
+  for (float64_t sample : samples)
+  {
+    sum += sample;
+  }
+  return samples.empty() ? 0 : sum / static_cast<float64_t>(samples.size());
+}
+
+float64_t relative_stdev_of(const std::vector<float64_t>& samples)
+{
+  if (samples.size() < 2)
+  {
+    return std::numeric_limits<float64_t>::infinity();
+  }
+  const float64_t mean = mean_of(samples);
+  float64_t sum        = 0;
+  for (float64_t sample : samples)
+  {
+    sum += (sample - mean) * (sample - mean);
+  }
+  return std::sqrt(sum / static_cast<float64_t>(samples.size() - 1)) / mean;
+}
+
+std::string stopping_criterion = "stdrel";
+float64_t max_angle            = 0.048;
+float64_t min_r2               = 0.36;
+
+// NVBench's entropy criterion: the samples are done once the entropy of their distribution stops growing, i.e. a line
+// fit to the entropy after each sample is flat and fits well.
+class entropy_tracker
+{
+public:
+  void add(float64_t sample)
+  {
+    // samples within about 0.5% of each other fall into the same bin
+    const auto bin = static_cast<int64_t>(std::floor(std::log(sample) / std::log1p(0.005)));
+    m_counts[bin]++;
+    m_total++;
+
+    float64_t entropy = 0;
+    for (const auto& [key, count] : m_counts)
+    {
+      const float64_t p = static_cast<float64_t>(count) / static_cast<float64_t>(m_total);
+      entropy -= p * std::log2(p);
+    }
+    m_entropy.push_back(entropy);
+  }
+
+  bool converged() const
+  {
+    const std::size_t n = m_entropy.size();
+    if (n < 2)
+    {
+      return false;
+    }
+
+    float64_t mean_x = 0, mean_y = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+      mean_x += static_cast<float64_t>(i);
+      mean_y += m_entropy[i];
+    }
+    mean_x /= static_cast<float64_t>(n);
+    mean_y /= static_cast<float64_t>(n);
+
+    float64_t sxx = 0, sxy = 0, syy = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+      const float64_t dx = static_cast<float64_t>(i) - mean_x;
+      const float64_t dy = m_entropy[i] - mean_y;
+      sxx += dx * dx;
+      sxy += dx * dy;
+      syy += dy * dy;
+    }
+    const float64_t slope = sxy / sxx;
+    const float64_t r2    = syy == 0 ? 1 : (sxy * sxy) / (sxx * syy);
+    return std::atan(slope) < max_angle && r2 > min_r2;
+  }
+
+private:
+  std::map<int64_t, std::size_t> m_counts;
+  std::size_t m_total{};
+  std::vector<float64_t> m_entropy;
+};
+
+} // namespace
+
+void state::measure(const std::function<float64_t()>& sample)
+{
+  // a first, untimed call touches the inputs and warms up the thread pool of the parallel system
+  sample();
+
+  entropy_tracker entropy;
+  float64_t total_time = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (;;)
+  {
+    const float64_t time = sample();
+    m_samples.push_back(time);
+    total_time += time;
+    entropy.add(time);
+
+    const float64_t wall_time = std::chrono::duration<float64_t>(std::chrono::steady_clock::now() - start).count();
+    if (wall_time >= m_criterion->timeout)
+    {
+      break;
+    }
+    if (static_cast<int64_t>(m_samples.size()) < m_criterion->min_samples || total_time < m_criterion->min_time)
+    {
+      continue;
+    }
+    if (stopping_criterion == "entropy" ? entropy.converged() : relative_stdev_of(m_samples) <= m_criterion->max_noise)
+    {
+      break;
+    }
+  }
+}
+
+} // namespace nvbench
+
+namespace
+{
+
+using nvbench::axis;
+using nvbench::axis_type;
+using nvbench::axis_value;
+using nvbench::benchmark;
+using nvbench::float64_t;
+using nvbench::int64_t;
+
+// The number of threads the parallel system of this build may use.
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+const char* const system_name = "omp";
+
+int64_t default_thread_count()
+{
+  return omp_get_max_threads();
+}
+
+class thread_count_scope
+{
+public:
+  explicit thread_count_scope(int64_t threads)
+  {
+    omp_set_num_threads(static_cast<int>(threads));
+  }
+};
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+const char* const system_name = "tbb";
+
+int64_t default_thread_count()
+{
+  return tbb::this_task_arena::max_concurrency();
+}
+
+class thread_count_scope
+{
+public:
+  explicit thread_count_scope(int64_t threads)
+      : m_control(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads))
+  {}
+
+private:
+  tbb::global_control m_control;
+};
+#else
+const char* const system_name = "cpp";
+
+int64_t default_thread_count()
+{
+  return 1;
+}
+
+class thread_count_scope
+{
+public:
+  explicit thread_count_scope(int64_t threads)
+  {
+    if (threads != 1)
+    {
+      throw std::runtime_error("the CPP system runs on a single thread");
+    }
+  }
+};
+#endif
+
+std::string cpu_name()
+{
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line))
+  {
+    if (line.rfind("model name", 0) == 0 && line.find(':') != std::string::npos)
+    {
+      return line.substr(line.find_first_not_of(" \t", line.find(':') + 1)) + " (" + system_name + ")";
+    }
+  }
+  return std::string("CPU (") + system_name + ")";
+}
+
+std::string quote(const std::string& str)
+{
+  std::string result = "\"";
+  for (char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        result += c;
+    }
+  }
+  return result + "\"";
+}
+
+std::string to_json_string(float64_t value)
+{
+  std::ostringstream str;
+  str.precision(17);
+  str << value;
+  return str.str();
+}
+
+std::string type_name(axis_type type)
+{
+  switch (type)
+  {
+    case axis_type::type:
+      return "type";
+    case axis_type::int64:
+      return "int64";
+    case axis_type::float64:
+      return "float64";
+    default:
+      return "string";
+  }
+}
+
+// the CPU, as the one device of NVBench's device list
+std::string device_json(int64_t threads)
+{
+  return "{\"id\": 0, \"name\": " + quote(cpu_name())
+       + ", \"global_memory_bus_width\": 0, \"number_of_sms\": " + std::to_string(threads)
+       + ", \"ecc_state\": false}";
+}
+
+std::string axes_json(const benchmark& bench, const std::string& indent)
+{
+  std::string json = "[";
+  for (std::size_t i = 0; i < bench.axes().size(); i++)
+  {
+    const axis& a = bench.axes()[i];
+    json += (i ? ",\n" : "\n") + indent + "  {\n" + indent + "    \"name\": " + quote(a.name) + ",\n" + indent
+          + "    \"type\": " + quote(type_name(a.type)) + ",\n" + indent + "    \"flags\": " + quote(a.flags) + ",\n"
+          + indent + "    \"values\": [";
+    for (std::size_t j = 0; j < a.values.size(); j++)
+    {
+      const axis_value& v = a.values[j];
+      json += (j ? ",\n" : "\n") + indent + "      {\"input_string\": " + quote(v.input_string)
+            + ", \"description\": " + quote(v.description);
+      if (a.type != axis_type::type)
+      {
+        json += ", \"value\": " + quote(v.value);
+      }
+      json += "}";
+    }
+    json += "\n" + indent + "    ]\n" + indent + "  }";
+  }
+  return json + "\n" + indent + "]";
+}
+
+std::string benches_json(const std::vector<benchmark*>& benches)
+{
+  std::string json = "{\n  \"benchmarks\": [";
+  for (std::size_t i = 0; i < benches.size(); i++)
+  {
+    json += (i ? ",\n" : "\n") + std::string("    {\n      \"name\": ") + quote(benches[i]->name())
+          + ",\n      \"index\": " + std::to_string(i) + ",\n      \"axes\": " + axes_json(*benches[i], "      ")
+          + "\n    }";
+  }
+  return json + "\n  ]\n}\n";
+}
+
+// the results of one state of a benchmark at one thread count
+struct state_result
+{
+  std::vector<std::size_t> value_indices;
+  std::string skip_reason;
+  std::size_t element_count{};
+  std::size_t global_memory_bytes{};
+  std::vector<float64_t> samples;
+
+  float64_t mean() const
+  {
+    return nvbench::mean_of(samples);
+  }
+
+  float64_t elements_per_second() const
+  {
+    return static_cast<float64_t>(element_count) / mean();
+  }
+
+  float64_t bytes_per_second() const
+  {
+    return static_cast<float64_t>(global_memory_bytes) / mean();
+  }
+};
+
+struct bench_result
+{
+  benchmark* bench;
+  std::vector<state_result> states;
+};
+
+std::string state_name(const benchmark& bench, const std::vector<std::size_t>& value_indices)
+{
+  std::string name = "Device=0";
+  for (std::size_t i = 0; i < bench.axes().size(); i++)
+  {
+    const axis& a           = bench.axes()[i];
+    const axis_value& value = a.values[value_indices[i]];
+    name += " " + a.name + "=" + (a.flags == "pow2" ? "2^" + value.input_string : value.input_string);
+  }
+  return name;
+}
+
+std::string summary_json(const std::string& tag, const std::string& name, const std::string& data)
+{
+  return "{\"tag\": " + quote(tag) + ", \"name\": " + quote(name) + ", \"data\": [" + data + "]}";
+}
+
+std::string datum_json(const std::string& name, const std::string& type, const std::string& value)
+{
+  return "{\"name\": " + quote(name) + ", \"type\": " + quote(type) + ", \"value\": " + quote(value) + "}";
+}
+
+// writes the results in the layout of NVBench's JSON output, with the samples of state i in <bin_dir>/i.bin
+void write_json(const std::string& path, bool with_samples, int64_t threads, const std::vector<bench_result>& results)
+{
+  const std::string bin_dir = path + "-bin";
+  if (with_samples)
+  {
+    std::filesystem::create_directories(bin_dir);
+  }
+
+  std::string json = "{\n  \"devices\": [" + device_json(threads) + "],\n  \"benchmarks\": [";
+
+  std::size_t sample_file = 0;
+  for (std::size_t b = 0; b < results.size(); b++)
+  {
+    const benchmark& bench = *results[b].bench;
+    json += (b ? ",\n" : "\n") + std::string("    {\n      \"name\": ") + quote(bench.name()) + ",\n      \"index\": "
+          + std::to_string(b) + ",\n      \"devices\": [0],\n      \"axes\": " + axes_json(bench, "      ")
+          + ",\n      \"states\": [";
+
+    for (std::size_t s = 0; s < results[b].states.size(); s++)
+    {
+      const state_result& state = results[b].states[s];
+
+      std::string axis_values;
+      for (std::size_t i = 0; i < bench.axes().size(); i++)
+      {
+        const axis& a           = bench.axes()[i];
+        const axis_value& value = a.values[state.value_indices[i]];
+        axis_values += std::string(i ? ", " : "") + datum_json(
+                         a.name, type_name(a.type), a.type == axis_type::type ? value.input_string : value.value);
+      }
+
+      std::vector<std::string> summaries;
+      if (!state.samples.empty())
+      {
+        const float64_t mean = state.mean();
+        const auto [min, max] = std::minmax_element(state.samples.begin(), state.samples.end());
+
+        summaries.push_back(summary_json(
+          "nv/cold/sample_size", "Samples", datum_json("value", "int64", std::to_string(state.samples.size()))));
+        summaries.push_back(
+          summary_json("nv/cold/time/cpu/mean", "CPU Time", datum_json("value", "float64", to_json_string(mean))));
+        summaries.push_back(
+          summary_json("nv/cold/time/cpu/min", "Min CPU Time", datum_json("value", "float64", to_json_string(*min))));
+        summaries.push_back(
+          summary_json("nv/cold/time/cpu/max", "Max CPU Time", datum_json("value", "float64", to_json_string(*max))));
+        summaries.push_back(summary_json(
+          "nv/cold/time/cpu/stdev/relative",
+          "Noise",
+          datum_json("value", "float64", to_json_string(nvbench::relative_stdev_of(state.samples)))));
+        if (state.element_count)
+        {
+          summaries.push_back(summary_json(
+            "nv/cold/bw/item_rate",
+            "Elem/s",
+            datum_json("value", "float64", to_json_string(state.elements_per_second()))));
+        }
+        if (state.global_memory_bytes)
+        {
+          summaries.push_back(summary_json(
+            "nv/cold/bw/global/bytes_per_second",
+            "GlobalMem BW",
+            datum_json("value", "float64", to_json_string(state.bytes_per_second()))));
+        }
+        if (with_samples)
+        {
+          const std::string filename = bin_dir + "/" + std::to_string(sample_file++) + ".bin";
+          std::ofstream file(filename, std::ios::binary);
+          for (float64_t sample : state.samples)
+          {
+            // little endian float32, as NVBench writes them
+            const auto value = static_cast<float>(sample);
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+          }
+          summaries.push_back(summary_json(
+            "nv/json/bin:nv/cold/sample_times",
+            "Samples Times File",
+            datum_json("filename", "string", filename) + ", "
+              + datum_json("size", "int64", std::to_string(state.samples.size()))));
+        }
+      }
+
+      json += (s ? ",\n" : "\n") + std::string("        {\n          \"name\": ")
+            + quote(state_name(bench, state.value_indices)) + ",\n          \"device\": 0,\n"
+            + "          \"axis_values\": ["
+            + axis_values + "],\n          \"summaries\": [";
+      for (std::size_t i = 0; i < summaries.size(); i++)
+      {
+        json += (i ? ",\n            " : "\n            ") + summaries[i];
+      }
+      json += std::string(summaries.empty() ? "" : "\n          ") + "],\n          \"is_skipped\": "
+            + (state.skip_reason.empty() ? "false" : "true") + ",\n          \"skip_reason\": "
+            + quote(state.skip_reason) + "\n        }";
+    }
+    json += "\n      ]\n    }";
+  }
+  json += "\n  ]\n}\n";
+
+  std::ofstream file(path);
+  file << json;
+}
+
+std::string format_time(float64_t seconds)
+{
+  char buffer[32];
+  if (seconds >= 1)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f s", seconds);
+  }
+  else if (seconds >= 1e-3)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f ms", seconds * 1e3);
+  }
+  else
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f us", seconds * 1e6);
+  }
+  return buffer;
+}
+
+std::string format_rate(float64_t rate, const char* unit)
+{
+  const char* prefixes[] = {"", "K", "M", "G", "T"};
+  std::size_t prefix     = 0;
+  while (rate >= 1000 && prefix + 1 < std::size(prefixes))
+  {
+    rate /= 1000;
+    prefix++;
+  }
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f%s%s", rate, prefixes[prefix], unit);
+  return buffer;
+}
+
+std::string markdown_table(const std::vector<std::string>& header, const std::vector<std::vector<std::string>>& rows)
+{
+  std::vector<std::size_t> widths(header.size());
+  for (std::size_t i = 0; i < header.size(); i++)
+  {
+    widths[i] = header[i].size();
+    for (const auto& row : rows)
+    {
+      widths[i] = std::max(widths[i], row[i].size());
+    }
+  }
+
+  std::string table;
+  auto add_row = [&](const std::vector<std::string>& row) {
+    for (std::size_t i = 0; i < row.size(); i++)
+    {
+      table += "| " + std::string(widths[i] - row[i].size(), ' ') + row[i] + " ";
+    }
+    table += "|\n";
+  };
+
+  add_row(header);
+  for (std::size_t width : widths)
+  {
+    table += "|" + std::string(width + 2, '-');
+  }
+  table += "|\n";
+  for (const auto& row : rows)
+  {
+    add_row(row);
+  }
+  return table + "\n";
+}
+
+std::vector<std::string> axis_columns(const benchmark& bench, const std::vector<std::size_t>& value_indices)
+{
+  std::vector<std::string> columns;
+  for (std::size_t i = 0; i < bench.axes().size(); i++)
+  {
+    const axis& a           = bench.axes()[i];
+    const axis_value& value = a.values[value_indices[i]];
+    columns.push_back(a.flags == "pow2" ? "2^" + value.input_string : value.input_string);
+  }
+  return columns;
+}
+
+std::string results_markdown(const bench_result& result, int64_t threads)
+{
+  const benchmark& bench = *result.bench;
+  std::string markdown   = "## " + bench.name() + " (" + std::to_string(threads) + " threads)\n\n";
+
+  std::vector<std::string> header;
+  for (const axis& a : bench.axes())
+  {
+    header.push_back(a.name);
+  }
+  for (const char* column : {"Samples", "CPU Time", "Noise", "Elem/s", "GlobalMem BW"})
+  {
+    header.push_back(column);
+  }
+
+  std::vector<std::vector<std::string>> rows;
+  for (const state_result& state : result.states)
+  {
+    std::vector<std::string> row = axis_columns(bench, state.value_indices);
+    if (state.samples.empty())
+    {
+      row.insert(row.end(), {"skipped", state.skip_reason, "", "", ""});
+    }
+    else
+    {
+      char noise[32];
+      std::snprintf(noise, sizeof(noise), "%.2f%%", 100 * nvbench::relative_stdev_of(state.samples));
+      row.insert(row.end(),
+                 {std::to_string(state.samples.size()),
+                  format_time(state.mean()),
+                  noise,
+                  state.element_count ? format_rate(state.elements_per_second(), "") : "",
+                  state.global_memory_bytes ? format_rate(state.bytes_per_second(), "B/s") : ""});
+    }
+    rows.push_back(std::move(row));
+  }
+  return markdown + markdown_table(header, rows);
+}
+
+// the throughput of every state at every thread count, relative to the first thread count
+std::string
+scaling_markdown(const std::vector<int64_t>& thread_counts, const std::vector<std::vector<bench_result>>& results)
+{
+  std::string markdown;
+  for (std::size_t b = 0; b < results.front().size(); b++)
+  {
+    const benchmark& bench = *results.front()[b].bench;
+    markdown += "## " + bench.name() + " (thread scaling)\n\n";
+
+    std::vector<std::string> header;
+    for (const axis& a : bench.axes())
+    {
+      header.push_back(a.name);
+    }
+    for (const char* column : {"Threads", "CPU Time", "Elem/s", "GlobalMem BW", "Speedup", "Efficiency"})
+    {
+      header.push_back(column);
+    }
+
+    std::vector<std::vector<std::string>> rows;
+    for (std::size_t s = 0; s < results.front()[b].states.size(); s++)
+    {
+      const state_result& base = results.front()[b].states[s];
+      for (std::size_t t = 0; t < thread_counts.size(); t++)
+      {
+        const state_result& state    = results[t][b].states[s];
+        std::vector<std::string> row = axis_columns(bench, state.value_indices);
+        row.push_back(std::to_string(thread_counts[t]));
+        if (state.samples.empty() || base.samples.empty())
+        {
+          row.insert(row.end(), {"skipped", "", "", "", ""});
+        }
+        else
+        {
+          const float64_t speedup    = base.mean() / state.mean();
+          const float64_t efficiency = speedup * static_cast<float64_t>(thread_counts.front())
+                                     / static_cast<float64_t>(thread_counts[t]);
+          char speedup_str[32], efficiency_str[32];
+          std::snprintf(speedup_str, sizeof(speedup_str), "%.2fx", speedup);
+          std::snprintf(efficiency_str, sizeof(efficiency_str), "%.0f%%", 100 * efficiency);
+          row.insert(row.end(),
+                     {format_time(state.mean()),
+                      state.element_count ? format_rate(state.elements_per_second(), "") : "",
+                      state.global_memory_bytes ? format_rate(state.bytes_per_second(), "B/s") : "",
+                      speedup_str,
+                      efficiency_str});
+        }
+        rows.push_back(std::move(row));
+      }
+    }
+    markdown += markdown_table(header, rows);
+  }
+  return markdown;
+}
+
+std::string trim(const std::string& str)
+{
+  const std::size_t first = str.find_first_not_of(" \t");
+  if (first == std::string::npos)
+  {
+    return {};
+  }
+  return str.substr(first, str.find_last_not_of(" \t") - first + 1);
+}
+
+// splits "[a, b, c]" or "a" into its values, and expands integer ranges "first:last[:stride]"
+std::vector<std::string> parse_values(std::string values, bool integral)
+{
+  values = trim(values);
+  if (!values.empty() && values.front() == '[' && values.back() == ']')
+  {
+    values = values.substr(1, values.size() - 2);
+  }
+
+  std::vector<std::string> result;
+  std::stringstream stream(values);
+  std::string value;
+  while (std::getline(stream, value, ','))
+  {
+    value = trim(value);
+    if (integral && value.find(':') != std::string::npos)
+    {
+      std::vector<int64_t> bounds;
+      std::stringstream range(value);
+      std::string bound;
+      while (std::getline(range, bound, ':'))
+      {
+        bounds.push_back(std::stoll(bound));
+      }
+      for (int64_t v : nvbench::range(bounds.at(0), bounds.at(1), bounds.size() > 2 ? bounds[2] : 1))
+      {
+        result.push_back(std::to_string(v));
+      }
+    }
+    else if (!value.empty())
+    {
+      result.push_back(value);
+    }
+  }
+  return result;
+}
+
+// applies "-a Name[flags]=values" to a benchmark, which replaces the values of the axis, or selects from those of a
+// type axis
+void apply_axis_option(benchmark& bench, const std::string& option)
+{
+  const std::size_t eq = option.find('=');
+  if (eq == std::string::npos)
+  {
+    throw std::runtime_error("expected <axis>=<values>, got '" + option + "'");
+  }
+
+  std::string name = trim(option.substr(0, eq));
+  std::string flags;
+  if (!name.empty() && name.back() == ']' && name.find('[') != std::string::npos)
+  {
+    flags = name.substr(name.rfind('[') + 1, name.size() - name.rfind('[') - 2);
+    name  = name.substr(0, name.rfind('['));
+  }
+
+  for (std::size_t i = 0; i < bench.axes().size(); i++)
+  {
+    axis& a = bench.axes()[i];
+    if (a.name != name)
+    {
+      continue;
+    }
+
+    const std::vector<std::string> values = parse_values(option.substr(eq + 1), a.type == axis_type::int64);
+    std::vector<axis_value> selected;
+    for (const std::string& value : values)
+    {
+      switch (a.type)
+      {
+        case axis_type::type: {
+          auto it = std::find_if(a.values.begin(), a.values.end(), [&](const axis_value& v) {
+            return v.input_string == value;
+          });
+          if (it == a.values.end())
+          {
+            throw std::runtime_error("axis '" + name + "' has no type '" + value + "'");
+          }
+          selected.push_back(*it);
+          break;
+        }
+        case axis_type::int64:
+          if (flags == "pow2")
+          {
+            const int64_t exponent = std::stoll(value);
+            const int64_t v        = int64_t{1} << exponent;
+            selected.push_back(
+              {value, "2^" + value + " = " + std::to_string(v), std::to_string(v), v, 0.0});
+          }
+          else
+          {
+            const int64_t v = std::stoll(value);
+            selected.push_back({value, "", value, v, 0.0});
+          }
+          break;
+        case axis_type::float64:
+          selected.push_back({value, "", value, 0, std::stod(value)});
+          break;
+        case axis_type::string:
+          selected.push_back({value, "", value, 0, 0.0});
+          break;
+      }
+    }
+
+    a.flags  = a.type == axis_type::int64 ? flags : a.flags;
+    a.values = std::move(selected);
+    return;
+  }
+
+  throw std::runtime_error("benchmark '" + bench.name() + "' has no axis named '" + name + "'");
+}
+
+// runs every state of a benchmark, i.e. every combination of the values of its axes
+bench_result run(benchmark& bench, const nvbench::criterion_params& criterion)
+{
+  bench_result result{&bench, {}};
+
+  const std::size_t type_axes = bench.type_axes_count();
+  for (const nvbench::type_config& config : bench.type_configs())
+  {
+    // the indices of the types of this configuration among the (selected) values of the type axes
+    std::vector<std::size_t> indices(bench.axes().size(), 0);
+    bool selected = true;
+    for (std::size_t i = 0; i < type_axes; i++)
+    {
+      const std::vector<axis_value>& values = bench.axes()[i].values;
+      auto it = std::find_if(values.begin(), values.end(), [&](const axis_value& v) {
+        return v.input_string == config.input_strings[i];
+      });
+      selected = selected && it != values.end();
+      indices[i] = static_cast<std::size_t>(it - values.begin());
+    }
+    if (!selected)
+    {
+      continue;
+    }
+
+    for (;;)
+    {
+      bool empty = false;
+      for (std::size_t i = type_axes; i < bench.axes().size(); i++)
+      {
+        empty = empty || bench.axes()[i].values.empty();
+      }
+      if (empty)
+      {
+        break;
+      }
+
+      nvbench::state state(bench.axes(), indices, criterion);
+      try
+      {
+        config.run(state);
+      }
+      catch (const std::exception& e)
+      {
+        state.skip(e.what());
+      }
+
+      std::fprintf(stderr, "# %s %s\n", bench.name().c_str(), state_name(bench, indices).c_str());
+      result.states.push_back(
+        {indices, state.skip_reason(), state.element_count(), state.global_memory_bytes(), state.samples()});
+
+      // the next combination of the values of the other axes, the first of them changing fastest
+      std::size_t i = type_axes;
+      for (; i < bench.axes().size(); i++)
+      {
+        if (++indices[i] < bench.axes()[i].values.size())
+        {
+          break;
+        }
+        indices[i] = 0;
+      }
+      if (i == bench.axes().size())
+      {
+        break;
+      }
+    }
+  }
+
+  return result;
+}
+
+std::string json_path_for(const std::string& path, int64_t threads, std::size_t thread_counts)
+{
+  if (thread_counts == 1)
+  {
+    return path;
+  }
+  std::filesystem::path p(path);
+  return (p.parent_path() / (p.stem().string() + ".threads-" + std::to_string(threads) + p.extension().string()))
+    .string();
+}
+
+int run_main(int argc, char** argv)
+{
+  std::vector<benchmark*> benches;
+  for (auto& bench : nvbench::registered_benchmarks())
+  {
+    benches.push_back(bench.get());
+  }
+
+  nvbench::criterion_params criterion;
+  std::vector<int64_t> thread_counts{default_thread_count()};
+  std::string json_path;
+  std::string md_path;
+  bool with_samples = false;
+
+  // the selected benchmarks, with the axis options given for each of them
+  std::vector<std::pair<benchmark*, std::vector<std::string>>> selection;
+  std::vector<std::string> global_axis_options;
+
+  for (int i = 1; i < argc; i++)
+  {
+    const std::string arg = argv[i];
+    auto next             = [&]() -> std::string {
+      if (i + 1 >= argc)
+      {
+        throw std::runtime_error("missing value after " + arg);
+      }
+      return argv[++i];
+    };
+
+    if (arg == "--list" || arg == "-l")
+    {
+      for (std::size_t b = 0; b < benches.size(); b++)
+      {
+        std::printf("%zu: %s\n", b, benches[b]->name().c_str());
+        for (const axis& a : benches[b]->axes())
+        {
+          std::printf("  %s%s:", a.name.c_str(), a.flags.empty() ? "" : ("[" + a.flags + "]").c_str());
+          for (const axis_value& v : a.values)
+          {
+            std::printf(" %s", v.input_string.c_str());
+          }
+          std::printf("\n");
+        }
+      }
+      return 0;
+    }
+    else if (arg == "--jsonlist-benches")
+    {
+      std::printf("%s", benches_json(benches).c_str());
+      return 0;
+    }
+    else if (arg == "--jsonlist-devices")
+    {
+      std::printf("{\n  \"devices\": [%s]\n}\n", device_json(default_thread_count()).c_str());
+      return 0;
+    }
+    else if (arg == "-b" || arg == "--benchmark")
+    {
+      const std::string name = next();
+      auto it                = std::find_if(benches.begin(), benches.end(), [&](benchmark* bench) {
+        return bench->name() == name;
+      });
+      if (it == benches.end() && !name.empty() && std::all_of(name.begin(), name.end(), ::isdigit)
+          && std::stoull(name) < benches.size())
+      {
+        it = benches.begin() + std::stoll(name);
+      }
+      if (it == benches.end())
+      {
+        throw std::runtime_error("no benchmark named '" + name + "'");
+      }
+      selection.push_back({*it, global_axis_options});
+    }
+    else if (arg == "-a" || arg == "--axis")
+    {
+      (selection.empty() ? global_axis_options : selection.back().second).push_back(next());
+    }
+    else if (arg == "--json")
+    {
+      json_path = next();
+    }
+    else if (arg == "--jsonbin")
+    {
+      json_path    = next();
+      with_samples = true;
+    }
+    else if (arg == "--md")
+    {
+      md_path = next();
+    }
+    else if (arg == "--threads")
+    {
+      thread_counts.clear();
+      for (const std::string& value : parse_values(next(), true))
+      {
+        thread_counts.push_back(std::stoll(value));
+      }
+    }
+    else if (arg == "--stopping-criterion")
+    {
+      nvbench::stopping_criterion = next();
+      if (nvbench::stopping_criterion != "stdrel" && nvbench::stopping_criterion != "entropy")
+      {
+        throw std::runtime_error("unknown stopping criterion '" + nvbench::stopping_criterion + "'");
+      }
+    }
+    else if (arg == "--min-samples")
+    {
+      criterion.min_samples = std::stoll(next());
+    }
+    else if (arg == "--min-time")
+    {
+      criterion.min_time = std::stod(next());
+    }
+    else if (arg == "--max-noise")
+    {
+      // given in percent, as to NVBench
+      criterion.max_noise = std::stod(next()) / 100;
+    }
+    else if (arg == "--timeout")
+    {
+      criterion.timeout = std::stod(next());
+    }
+    else if (arg == "--max-angle")
+    {
+      nvbench::max_angle = std::stod(next());
+    }
+    else if (arg == "--min-r2")
+    {
+      nvbench::min_r2 = std::stod(next());
+    }
+    else if (arg == "-d" || arg == "--device" || arg == "--devices")
+    {
+      // there is one device, the CPU
+      next();
+    }
+    else
+    {
+      throw std::runtime_error("unknown option '" + arg + "'");
+    }
+  }
+
+  if (selection.empty())
+  {
+    for (benchmark* bench : benches)
+    {
+      selection.push_back({bench, global_axis_options});
+    }
+  }
+  for (auto& [bench, axis_options] : selection)
+  {
+    for (const std::string& option : axis_options)
+    {
+      apply_axis_option(*bench, option);
+    }
+  }
+
+  // the tables are printed as each benchmark finishes, and written to the --md file at the end
+  std::string markdown;
+  auto print_markdown = [&](const std::string& tables) {
+    std::fputs(tables.c_str(), stdout);
+    std::fflush(stdout);
+    markdown += tables;
+  };
+
+  std::vector<std::vector<bench_result>> results;
+  for (int64_t threads : thread_counts)
+  {
+    thread_count_scope scope(threads);
+
+    results.emplace_back();
+    for (auto& [bench, axis_options] : selection)
+    {
+      results.back().push_back(run(*bench, criterion));
+      print_markdown(results_markdown(results.back().back(), threads));
+    }
+
+    if (!json_path.empty())
+    {
+      write_json(json_path_for(json_path, threads, thread_counts.size()), with_samples, threads, results.back());
+    }
+  }
+
+  if (thread_counts.size() > 1)
+  {
+    print_markdown(scaling_markdown(thread_counts, results));
+  }
+
+  if (!md_path.empty())
+  {
+    std::ofstream(md_path) << markdown;
+  }
+
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    return run_main(argc, argv);
+  }
+  catch (const std::exception& e)
+  {
+    std::fprintf(stderr, "error: %s\n", e.what());
+    return 1;
+  }
+}
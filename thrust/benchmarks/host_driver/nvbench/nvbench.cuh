@@ -0,0 +1,561 @@
+// SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// A host-only stand-in for the subset of the NVBench API that the Thrust benchmarks use. It lets the benchmark sources
+// be built against the CPP, OMP and TBB systems without a CUDA toolkit: the benchmarks register themselves here, and
+// the driver in host_driver.cpp runs them on the CPU and prints or writes the results in NVBench's format.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUC__)
+#  include <cxxabi.h>
+
+#  include <cstdlib>
+#endif
+
+// the benchmark sources and nvbench_helper use the CUDA execution space specifiers on functors which run on the host
+#if !defined(__CUDACC__)
+#  if !defined(__host__)
+#    define __host__
+#  endif
+#  if !defined(__device__)
+#    define __device__
+#  endif
+#  if !defined(__forceinline__)
+#    define __forceinline__ inline
+#  endif
+#endif
+
+namespace nvbench
+{
+
+using std::int16_t;
+using std::int32_t;
+using std::int64_t;
+using std::int8_t;
+using std::uint16_t;
+using std::uint32_t;
+using std::uint64_t;
+using std::uint8_t;
+using float32_t = float;
+using float64_t = double;
+
+template <typename... Ts>
+struct type_list
+{};
+
+namespace detail
+{
+
+template <typename T>
+std::string demangled_name()
+{
+#if defined(__GNUC__)
+  int status = 0;
+  std::unique_ptr<char, void (*)(void*)> name(
+    abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status), std::free);
+  if (status == 0 && name)
+  {
+    return name.get();
+  }
+#endif
+  return typeid(T).name();
+}
+
+} // namespace detail
+
+template <typename T>
+struct type_strings
+{
+  static std::string input_string()
+  {
+    return detail::demangled_name<T>();
+  }
+
+  static std::string description()
+  {
+    return detail::demangled_name<T>();
+  }
+};
+
+} // namespace nvbench
+
+#define NVBENCH_DECLARE_TYPE_STRINGS(Type, InputString, Description) \
+  template <>                                                        \
+  struct nvbench::type_strings<Type>                                 \
+  {                                                                  \
+    static std::string input_string()                                \
+    {                                                                \
+      return InputString;                                            \
+    }                                                                \
+    static std::string description()                                 \
+    {                                                                \
+      return Description;                                            \
+    }                                                                \
+  }
+
+NVBENCH_DECLARE_TYPE_STRINGS(bool, "Bool", "bool");
+NVBENCH_DECLARE_TYPE_STRINGS(char, "C8", "char");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int8_t, "I8", "int8");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int16_t, "I16", "int16");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int32_t, "I32", "int32");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int64_t, "I64", "int64");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint8_t, "U8", "uint8");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint16_t, "U16", "uint16");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint32_t, "U32", "uint32");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint64_t, "U64", "uint64");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float32_t, "F32", "float");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float64_t, "F64", "double");
+
+namespace nvbench
+{
+
+// the inclusive range [start, end] in steps of stride
+inline std::vector<int64_t> range(int64_t start, int64_t end, int64_t stride = 1)
+{
+  std::vector<int64_t> result;
+  for (int64_t value = start; value <= end; value += stride)
+  {
+    result.push_back(value);
+  }
+  return result;
+}
+
+// The execution tags only change how NVBench batches and synchronizes GPU launches. On the host every sample is one
+// synchronous call of the launcher, so the tags are accepted and ignored, except that the timer tag is implied by the
+// signature of the launcher.
+struct exec_tag_t
+{
+  unsigned flags;
+};
+
+constexpr exec_tag_t operator|(exec_tag_t lhs, exec_tag_t rhs)
+{
+  return exec_tag_t{lhs.flags | rhs.flags};
+}
+
+namespace exec_tag
+{
+constexpr exec_tag_t none{0};
+constexpr exec_tag_t sync{1};
+constexpr exec_tag_t no_batch{2};
+constexpr exec_tag_t timer{4};
+} // namespace exec_tag
+
+struct launch
+{};
+
+// Times the region between start() and stop() of a launcher which takes a timer, to leave out its set up work.
+class timer
+{
+public:
+  void start()
+  {
+    m_start = std::chrono::steady_clock::now();
+  }
+
+  void stop()
+  {
+    m_elapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+  double elapsed() const
+  {
+    return m_elapsed;
+  }
+
+private:
+  std::chrono::steady_clock::time_point m_start{};
+  double m_elapsed{};
+};
+
+enum class axis_type
+{
+  type,
+  int64,
+  float64,
+  string
+};
+
+struct axis_value
+{
+  std::string input_string;
+  std::string description;
+  // the value as it is written to JSON, which is empty for type axes
+  std::string value;
+  int64_t int64_value{};
+  float64_t float64_value{};
+};
+
+struct axis
+{
+  std::string name;
+  axis_type type;
+  // "pow2" for power of two axes, whose input strings are the exponents of their values
+  std::string flags;
+  std::vector<axis_value> values;
+};
+
+// The measurements the driver takes for one state, and the stopping criterion it takes them by.
+struct criterion_params
+{
+  int64_t min_samples = 10;
+  float64_t min_time  = 0.5;
+  float64_t max_noise = 0.005;
+  float64_t timeout   = 15.0;
+};
+
+class state
+{
+public:
+  state(const std::vector<axis>& axes, std::vector<std::size_t> value_indices, const criterion_params& criterion)
+      : m_axes(&axes)
+      , m_value_indices(std::move(value_indices))
+      , m_criterion(&criterion)
+  {}
+
+  int64_t get_int64(const std::string& name) const
+  {
+    return value_of(name, axis_type::int64).int64_value;
+  }
+
+  float64_t get_float64(const std::string& name) const
+  {
+    return value_of(name, axis_type::float64).float64_value;
+  }
+
+  const std::string& get_string(const std::string& name) const
+  {
+    return value_of(name, axis_type::string).input_string;
+  }
+
+  void add_element_count(std::size_t elements, const std::string& = {})
+  {
+    m_element_count += elements;
+  }
+
+  template <typename T>
+  void add_global_memory_reads(std::size_t count, const std::string& = {})
+  {
+    m_bytes_read += count * sizeof(T);
+  }
+
+  template <typename T>
+  void add_global_memory_writes(std::size_t count, const std::string& = {})
+  {
+    m_bytes_written += count * sizeof(T);
+  }
+
+  void skip(std::string reason)
+  {
+    m_skip_reason = std::move(reason);
+  }
+
+  template <typename Launcher>
+  void exec(exec_tag_t, Launcher&& launcher)
+  {
+    launch launch_params;
+    if constexpr (std::is_invocable_v<Launcher&, launch&, timer&>)
+    {
+      measure([&] {
+        timer t;
+        launcher(launch_params, t);
+        return t.elapsed();
+      });
+    }
+    else
+    {
+      measure([&] {
+        timer t;
+        t.start();
+        launcher(launch_params);
+        t.stop();
+        return t.elapsed();
+      });
+    }
+  }
+
+  template <typename Launcher>
+  void exec(Launcher&& launcher)
+  {
+    exec(exec_tag::none, std::forward<Launcher>(launcher));
+  }
+
+  const std::vector<std::size_t>& value_indices() const
+  {
+    return m_value_indices;
+  }
+
+  bool is_skipped() const
+  {
+    return !m_skip_reason.empty();
+  }
+
+  const std::string& skip_reason() const
+  {
+    return m_skip_reason;
+  }
+
+  std::size_t element_count() const
+  {
+    return m_element_count;
+  }
+
+  std::size_t global_memory_bytes() const
+  {
+    return m_bytes_read + m_bytes_written;
+  }
+
+  // the duration of each sample, in seconds
+  const std::vector<float64_t>& samples() const
+  {
+    return m_samples;
+  }
+
+private:
+  const axis_value& value_of(const std::string& name, axis_type type) const;
+
+  // takes samples until the stopping criterion is met, see host_driver.cpp
+  void measure(const std::function<float64_t()>& sample);
+
+  const std::vector<axis>* m_axes;
+  std::vector<std::size_t> m_value_indices;
+  const criterion_params* m_criterion;
+
+  std::string m_skip_reason;
+  std::size_t m_element_count{};
+  std::size_t m_bytes_read{};
+  std::size_t m_bytes_written{};
+  std::vector<float64_t> m_samples;
+};
+
+// One instantiation of a benchmark for a combination of the types on its type axes.
+struct type_config
+{
+  std::vector<std::string> input_strings;
+  void (*run)(state&);
+};
+
+class benchmark
+{
+public:
+  benchmark(std::string name, std::vector<axis> type_axes, std::vector<type_config> type_configs)
+      : m_name(std::move(name))
+      , m_axes(std::move(type_axes))
+      , m_type_configs(std::move(type_configs))
+  {}
+
+  benchmark& set_name(std::string name)
+  {
+    m_name = std::move(name);
+    return *this;
+  }
+
+  benchmark& set_type_axes_names(std::vector<std::string> names)
+  {
+    for (std::size_t i = 0; i < names.size() && i < m_axes.size(); i++)
+    {
+      m_axes[i].name = std::move(names[i]);
+    }
+    return *this;
+  }
+
+  benchmark& add_int64_axis(std::string name, std::vector<int64_t> values)
+  {
+    axis a{std::move(name), axis_type::int64, "", {}};
+    for (int64_t value : values)
+    {
+      a.values.push_back({std::to_string(value), "", std::to_string(value), value, 0.0});
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark& add_int64_power_of_two_axis(std::string name, std::vector<int64_t> exponents)
+  {
+    axis a{std::move(name), axis_type::int64, "pow2", {}};
+    for (int64_t exponent : exponents)
+    {
+      const int64_t value = int64_t{1} << exponent;
+      a.values.push_back(
+        {std::to_string(exponent), "2^" + std::to_string(exponent) + " = " + std::to_string(value),
+         std::to_string(value), value, 0.0});
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark& add_float64_axis(std::string name, std::vector<float64_t> values)
+  {
+    axis a{std::move(name), axis_type::float64, "", {}};
+    for (float64_t value : values)
+    {
+      std::string str = std::to_string(value);
+      str.erase(str.find_last_not_of('0') + 1);
+      if (str.back() == '.')
+      {
+        str.pop_back();
+      }
+      a.values.push_back({str, "", str, 0, value});
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark& add_string_axis(std::string name, std::vector<std::string> values)
+  {
+    axis a{std::move(name), axis_type::string, "", {}};
+    for (std::string& value : values)
+    {
+      a.values.push_back({value, "", value, 0, 0.0});
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  const std::string& name() const
+  {
+    return m_name;
+  }
+
+  // the type axes come first, in the order of the type lists
+  const std::vector<axis>& axes() const
+  {
+    return m_axes;
+  }
+
+  std::vector<axis>& axes()
+  {
+    return m_axes;
+  }
+
+  std::size_t type_axes_count() const
+  {
+    return m_type_configs.empty() ? 0 : m_type_configs.front().input_strings.size();
+  }
+
+  const std::vector<type_config>& type_configs() const
+  {
+    return m_type_configs;
+  }
+
+private:
+  std::string m_name;
+  std::vector<axis> m_axes;
+  std::vector<type_config> m_type_configs;
+};
+
+inline std::vector<std::unique_ptr<benchmark>>& registered_benchmarks()
+{
+  static std::vector<std::unique_ptr<benchmark>> benchmarks;
+  return benchmarks;
+}
+
+namespace detail
+{
+
+template <typename List>
+struct type_axis_of;
+
+template <typename... Ts>
+struct type_axis_of<type_list<Ts...>>
+{
+  static axis get(std::size_t index)
+  {
+    return axis{"T" + std::to_string(index),
+                axis_type::type,
+                "",
+                {axis_value{type_strings<Ts>::input_string(), type_strings<Ts>::description(), "", 0, 0.0}...}};
+  }
+};
+
+// Adds a type_config for every combination of one type from each of the remaining type axes, after the chosen ones.
+template <typename Generator, typename Chosen, typename... Remaining>
+struct type_configs_of;
+
+template <typename Generator, typename... Chosen>
+struct type_configs_of<Generator, type_list<Chosen...>>
+{
+  static void add(std::vector<type_config>& configs)
+  {
+    configs.push_back(type_config{{type_strings<Chosen>::input_string()...}, [](state& s) {
+                                    Generator{}(s, type_list<Chosen...>{});
+                                  }});
+  }
+};
+
+template <typename Generator, typename... Chosen, typename... Ts, typename... Remaining>
+struct type_configs_of<Generator, type_list<Chosen...>, type_list<Ts...>, Remaining...>
+{
+  static void add(std::vector<type_config>& configs)
+  {
+    (type_configs_of<Generator, type_list<Chosen..., Ts>, Remaining...>::add(configs), ...);
+  }
+};
+
+template <typename Generator, typename TypeAxes>
+struct typed_benchmark_builder;
+
+template <typename Generator, typename... TypeAxes>
+struct typed_benchmark_builder<Generator, type_list<TypeAxes...>>
+{
+  static benchmark& add(std::string name)
+  {
+    std::vector<axis> axes;
+    (axes.push_back(type_axis_of<TypeAxes>::get(axes.size())), ...);
+
+    std::vector<type_config> configs;
+    type_configs_of<Generator, type_list<>, TypeAxes...>::add(configs);
+
+    registered_benchmarks().push_back(
+      std::make_unique<benchmark>(std::move(name), std::move(axes), std::move(configs)));
+    return *registered_benchmarks().back();
+  }
+};
+
+inline benchmark& add_benchmark(std::string name, void (*run)(state&))
+{
+  registered_benchmarks().push_back(
+    std::make_unique<benchmark>(std::move(name), std::vector<axis>{}, std::vector<type_config>{{{}, run}}));
+  return *registered_benchmarks().back();
+}
+
+} // namespace detail
+
+} // namespace nvbench
+
+#define NVBENCH_DETAIL_CONCAT_IMPL(a, b) a##b
+#define NVBENCH_DETAIL_CONCAT(a, b)      NVBENCH_DETAIL_CONCAT_IMPL(a, b)
+#define NVBENCH_DETAIL_UNIQUE(prefix)    NVBENCH_DETAIL_CONCAT(prefix, __LINE__)
+
+#define NVBENCH_TYPE_AXES(...) nvbench::type_list<__VA_ARGS__>
+
+#define NVBENCH_BENCH(KernelGenerator)                                                    \
+  static nvbench::benchmark& NVBENCH_DETAIL_UNIQUE(nvbench_benchmark_) =                  \
+    nvbench::detail::add_benchmark(#KernelGenerator, [](nvbench::state& nvbench_state) { \
+      KernelGenerator(nvbench_state);                                                     \
+    })
+
+#define NVBENCH_BENCH_TYPES(KernelGenerator, TypeAxes)                                       \
+  struct NVBENCH_DETAIL_UNIQUE(nvbench_generator_)                                           \
+  {                                                                                          \
+    template <typename... Ts>                                                                \
+    void operator()(nvbench::state& nvbench_state, nvbench::type_list<Ts...> types) const   \
+    {                                                                                        \
+      KernelGenerator(nvbench_state, types);                                                 \
+    }                                                                                        \
+  };                                                                                         \
+  static nvbench::benchmark& NVBENCH_DETAIL_UNIQUE(nvbench_benchmark_) =                     \
+    nvbench::detail::typed_benchmark_builder<NVBENCH_DETAIL_UNIQUE(nvbench_generator_),      \
+                                             TypeAxes>::add(#KernelGenerator)
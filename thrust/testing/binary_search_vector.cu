@@ -331,6 +331,42 @@ struct TestVectorBinarySearch
 };
 VariableUnitTest<TestVectorBinarySearch, SignedIntegralTypes> TestVectorBinarySearchInstance;
 
+template <typename T>
+struct TestVectorSearchSortedQueries
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_vec = unittest::random_integers<T>(n);
+    thrust::sort(h_vec.begin(), h_vec.end());
+    thrust::device_vector<T> d_vec = h_vec;
+
+    // sorted queries may be searched by sweeping the haystack
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(2 * n);
+    thrust::sort(h_input.begin(), h_input.end());
+    thrust::device_vector<T> d_input = h_input;
+
+    using int_type = typename thrust::host_vector<T>::difference_type;
+    thrust::host_vector<int_type> h_output(2 * n);
+    thrust::device_vector<int_type> d_output(2 * n);
+
+    thrust::lower_bound(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin());
+    thrust::lower_bound(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin());
+
+    ASSERT_EQUAL(h_output, d_output);
+
+    thrust::upper_bound(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin());
+    thrust::upper_bound(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin());
+
+    ASSERT_EQUAL(h_output, d_output);
+
+    thrust::binary_search(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin());
+    thrust::binary_search(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin());
+
+    ASSERT_EQUAL(h_output, d_output);
+  }
+};
+VariableUnitTest<TestVectorSearchSortedQueries, SignedIntegralTypes> TestVectorSearchSortedQueriesInstance;
+
 template <typename T>
 struct TestVectorLowerBoundDiscardIterator
 {
@@ -0,0 +1,84 @@
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+#include <unittest/unittest.h>
+
+using thrust::system::detail::internal::balanced_path;
+
+void TestBalancedPathSingleKey()
+{
+  // a single run of equivalent elements is split by rank, pairing up as many elements of either range
+  const int n1 = 7;
+  const int n2 = 4;
+
+  thrust::host_vector<int> a(n1, 13);
+  thrust::host_vector<int> b(n2, 13);
+
+  for (int diagonal = 0; diagonal <= n1 + n2; ++diagonal)
+  {
+    const thrust::pair<int, int> split = balanced_path(a.begin(), n1, b.begin(), n2, diagonal, thrust::less<int>());
+
+    if (diagonal <= 2 * n2)
+    {
+      ASSERT_EQUAL(split.first, diagonal / 2);
+      ASSERT_EQUAL(split.second, diagonal / 2);
+    }
+    else
+    {
+      ASSERT_EQUAL(split.first, diagonal - n2);
+      ASSERT_EQUAL(split.second, n2);
+    }
+  }
+
+  // the unpaired rest of the longer run may come from the second range as well
+  for (int diagonal = 0; diagonal <= n1 + n2; ++diagonal)
+  {
+    const thrust::pair<int, int> split = balanced_path(b.begin(), n2, a.begin(), n1, diagonal, thrust::less<int>());
+
+    if (diagonal <= 2 * n2)
+    {
+      ASSERT_EQUAL(split.first, diagonal / 2);
+      ASSERT_EQUAL(split.second, diagonal / 2);
+    }
+    else
+    {
+      ASSERT_EQUAL(split.first, n2);
+      ASSERT_EQUAL(split.second, diagonal - n2);
+    }
+  }
+}
+DECLARE_UNITTEST(TestBalancedPathSingleKey);
+
+void TestBalancedPathRuns()
+{
+  // the runs of 1 and 2 are cut, the elements before them are split like a merge
+  const int a_data[] = {0, 1, 1, 1, 2, 2, 3};
+  const int b_data[] = {1, 1, 2, 2, 2, 2};
+
+  thrust::host_vector<int> a(a_data, a_data + 7);
+  thrust::host_vector<int> b(b_data, b_data + 6);
+
+  thrust::pair<int, int> split = balanced_path(a.begin(), 7, b.begin(), 6, 1, thrust::less<int>());
+  ASSERT_EQUAL(split.first, 1);
+  ASSERT_EQUAL(split.second, 0);
+
+  // a split at an odd rank in the run of 1 is moved back to pair up its elements
+  split = balanced_path(a.begin(), 7, b.begin(), 6, 4, thrust::less<int>());
+  ASSERT_EQUAL(split.first, 2);
+  ASSERT_EQUAL(split.second, 1);
+
+  split = balanced_path(a.begin(), 7, b.begin(), 6, 5, thrust::less<int>());
+  ASSERT_EQUAL(split.first, 3);
+  ASSERT_EQUAL(split.second, 2);
+
+  // the unpaired rest of the run of 2 comes from b
+  split = balanced_path(a.begin(), 7, b.begin(), 6, 11, thrust::less<int>());
+  ASSERT_EQUAL(split.first, 6);
+  ASSERT_EQUAL(split.second, 5);
+
+  split = balanced_path(a.begin(), 7, b.begin(), 6, 13, thrust::less<int>());
+  ASSERT_EQUAL(split.first, 7);
+  ASSERT_EQUAL(split.second, 6);
+}
+DECLARE_UNITTEST(TestBalancedPathRuns);
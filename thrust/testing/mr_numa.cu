@@ -0,0 +1,118 @@
+#include <thrust/fill.h>
+#include <thrust/mr/numa.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+
+#include <unittest/unittest.h>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <thrust/system/omp/memory.h>
+#  include <thrust/system/omp/vector.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <thrust/system/tbb/memory.h>
+#  include <thrust/system/tbb/vector.h>
+#endif
+
+// touches the pages sequentially and counts them, to check that the resource hands over every page of the allocation
+struct counting_toucher
+{
+  static std::size_t touched;
+
+  void operator()(char* pages, std::size_t num_pages, std::size_t page_size) const
+  {
+    for (std::size_t page = 0; page < num_pages; ++page)
+    {
+      pages[page * page_size] = 1;
+    }
+    touched += num_pages;
+  }
+};
+
+std::size_t counting_toucher::touched = 0;
+
+template <thrust::mr::numa_policy Policy>
+void TestNumaResourceAllocation()
+{
+  using resource = thrust::mr::numa_resource<counting_toucher, Policy>;
+
+  resource memres;
+
+  const std::size_t sizes[] = {1, 4096, resource::min_bytes - 1, resource::min_bytes, 3 * resource::min_bytes + 5};
+
+  for (std::size_t size : sizes)
+  {
+    for (std::size_t alignment = 1; alignment <= 64 * 1024; alignment <<= 2)
+    {
+      counting_toucher::touched = 0;
+
+      void* ptr = memres.do_allocate(size, alignment);
+      ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+
+      char* char_ptr = reinterpret_cast<char*>(ptr);
+      thrust::fill(char_ptr, char_ptr + size, char{});
+
+      memres.do_deallocate(ptr, size, alignment);
+
+      // only large allocations are placed, and interleaving may take the place of touching
+      const std::size_t page_size = thrust::detail::numa_page_size();
+      if (size < resource::min_bytes || alignment > page_size)
+      {
+        ASSERT_EQUAL(counting_toucher::touched, 0u);
+      }
+      else if (Policy == thrust::mr::numa_policy::first_touch)
+      {
+        ASSERT_EQUAL(counting_toucher::touched, (size + page_size - 1) / page_size);
+      }
+    }
+  }
+}
+
+void TestNumaResourceFirstTouch()
+{
+  TestNumaResourceAllocation<thrust::mr::numa_policy::first_touch>();
+}
+DECLARE_UNITTEST(TestNumaResourceFirstTouch);
+
+void TestNumaResourceInterleave()
+{
+  TestNumaResourceAllocation<thrust::mr::numa_policy::interleave>();
+}
+DECLARE_UNITTEST(TestNumaResourceInterleave);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+
+#  if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+namespace device_system = thrust::omp;
+#  else
+namespace device_system = thrust::tbb;
+#  endif
+
+template <typename Vector>
+void TestNumaVector(const size_t n)
+{
+  using T = typename Vector::value_type;
+
+  Vector v(n);
+  thrust::sequence(v.begin(), v.end());
+
+  ASSERT_EQUAL(thrust::reduce(v.begin(), v.end(), T(0)), static_cast<T>(n) * static_cast<T>(n - 1) / 2);
+
+  // growth reallocates through the resource, possibly crossing min_bytes
+  v.resize(n + (1 << 18), T(1));
+  ASSERT_EQUAL(thrust::reduce(v.begin(), v.end(), T(0)),
+               static_cast<T>(n) * static_cast<T>(n - 1) / 2 + static_cast<T>(1 << 18));
+}
+
+void TestFirstTouchAllocator(const size_t n)
+{
+  TestNumaVector<device_system::vector<long long, device_system::first_touch_allocator<long long>>>(n);
+}
+DECLARE_SIZED_UNITTEST(TestFirstTouchAllocator);
+
+void TestInterleavedAllocator(const size_t n)
+{
+  TestNumaVector<device_system::vector<long long, device_system::interleaved_allocator<long long>>>(n);
+}
+DECLARE_SIZED_UNITTEST(TestInterleavedAllocator);
+
+#endif
@@ -2,8 +2,12 @@
 
 #include <thrust/mr/new.h>
 #include <thrust/mr/pool.h>
+#include <thrust/mr/sharded_pool.h>
 #include <thrust/mr/sync_pool.h>
 
+#include <thread>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -244,6 +248,12 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestShardedPool()
+{
+  TestPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPool);
+
 template <template <typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -353,6 +363,12 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestShardedPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCachingOversized);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -372,3 +388,143 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestShardedGlobalPool()
+{
+  TestGlobalPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedGlobalPool);
+
+template <typename Pool>
+void TestPoolConcurrentUse(Pool& pool)
+{
+  const std::size_t num_threads = 8;
+  const std::size_t num_blocks  = 256;
+
+  // blocks allocated by one thread are deallocated by another one
+  std::vector<std::vector<void*>> blocks(num_threads, std::vector<void*>(num_blocks));
+  std::vector<std::size_t> failures(num_threads, 0);
+
+  auto size_of = [](std::size_t i) {
+    return std::size_t{1} << (i % 12);
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      for (std::size_t i = 0; i < num_blocks; ++i)
+      {
+        blocks[t][i] = pool.do_allocate(size_of(i));
+        std::memset(blocks[t][i], static_cast<int>(t), size_of(i));
+      }
+
+      for (std::size_t i = 0; i < num_blocks; ++i)
+      {
+        const unsigned char* bytes = static_cast<const unsigned char*>(blocks[t][i]);
+        for (std::size_t j = 0; j < size_of(i); ++j)
+        {
+          failures[t] += bytes[j] != t;
+        }
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  threads.clear();
+
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    ASSERT_EQUAL(failures[t], 0u);
+  }
+
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      const std::size_t other = (t + 1) % num_threads;
+      for (std::size_t i = 0; i < num_blocks; ++i)
+      {
+        pool.do_deallocate(blocks[other][i], size_of(i));
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+void TestSynchronizedPoolConcurrentUse()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::synchronized_pool_resource<thrust::mr::new_delete_resource> pool(&upstream);
+
+  TestPoolConcurrentUse(pool);
+}
+DECLARE_UNITTEST(TestSynchronizedPoolConcurrentUse);
+
+void TestShardedPoolConcurrentUse()
+{
+  using Pool = thrust::mr::sharded_pool_resource<thrust::mr::new_delete_resource>;
+
+  // the default stripe count is one on single core machines, which would not exercise sharding
+  thrust::mr::new_delete_resource upstream;
+  Pool pool(&upstream, Pool::get_default_options(), 4);
+
+  TestPoolConcurrentUse(pool);
+}
+DECLARE_UNITTEST(TestShardedPoolConcurrentUse);
+
+// counts the chunks a pool allocates from upstream
+class counting_resource final : public thrust::mr::new_delete_resource_base
+{
+public:
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    ++allocations;
+    return new_delete_resource_base::do_allocate(bytes, alignment);
+  }
+
+  std::size_t allocations = 0;
+};
+
+void TestShardedPoolProducerConsumer()
+{
+  using Pool = thrust::mr::sharded_pool_resource<counting_resource>;
+
+  counting_resource upstream;
+  Pool pool(&upstream, Pool::get_default_options(), 4);
+
+  const std::size_t num_rounds = 16;
+  const std::size_t num_blocks = 256;
+  std::vector<void*> blocks(num_blocks);
+  std::size_t allocations = 0;
+
+  for (std::size_t round = 0; round < num_rounds; ++round)
+  {
+    // this thread produces the blocks, and a new thread, mostly on another stripe, consumes them
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+      blocks[i] = pool.do_allocate(64);
+    }
+
+    std::thread([&] {
+      for (std::size_t i = 0; i < num_blocks; ++i)
+      {
+        pool.do_deallocate(blocks[i], 64);
+      }
+    }).join();
+
+    // the consumed blocks go back to the producer's free list, so no new chunks are needed after the first round
+    if (round == 0)
+    {
+      allocations = upstream.allocations;
+    }
+    ASSERT_EQUAL(upstream.allocations, allocations);
+  }
+}
+DECLARE_UNITTEST(TestShardedPoolProducerConsumer);
@@ -0,0 +1,276 @@
+#include <thrust/copy.h>
+#include <thrust/equal.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/partition.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/unique.h>
+
+#include <atomic>
+#include <cmath>
+
+#include <unittest/unittest.h>
+
+using thrust::system::omp::detail::parallel_params;
+
+template <typename Policy>
+parallel_params params_of(Policy policy)
+{
+  return thrust::system::omp::detail::parallel_params_of(policy);
+}
+
+void TestOmpParModifiers()
+{
+  ASSERT_EQUAL(params_of(thrust::omp::par).num_threads, 0);
+  ASSERT_EQUAL(params_of(thrust::omp::par).grain, 0u);
+  ASSERT_EQUAL(params_of(thrust::omp::par).schedule == thrust::omp::schedule_kind::static_, true);
+
+  auto policy = thrust::omp::par.on(3).grain(64).schedule(thrust::omp::schedule_kind::guided);
+  ASSERT_EQUAL(params_of(policy).num_threads, 3);
+  ASSERT_EQUAL(params_of(policy).grain, 64u);
+  ASSERT_EQUAL(params_of(policy).schedule == thrust::omp::schedule_kind::guided, true);
+
+  // the modifiers compose with an attached allocator in either order
+  std::allocator<int> alloc;
+  auto with_alloc = thrust::omp::par(alloc).schedule(thrust::omp::schedule_kind::dynamic).on(2);
+  ASSERT_EQUAL(params_of(with_alloc).num_threads, 2);
+  ASSERT_EQUAL(params_of(with_alloc).schedule == thrust::omp::schedule_kind::dynamic, true);
+
+  auto buffer = thrust::detail::get_temporary_buffer<int>(with_alloc, 16);
+  return_temporary_buffer(with_alloc, buffer.first, 16);
+}
+DECLARE_UNITTEST(TestOmpParModifiers);
+
+struct is_even
+{
+  template <typename T>
+  bool operator()(T x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+// counts its invocations, which must happen once per element however the input is tiled
+struct counted_is_even
+{
+  std::atomic<size_t>* calls;
+
+  template <typename T>
+  bool operator()(T x) const
+  {
+    ++*calls;
+    return x % 2 == 0;
+  }
+};
+
+struct increment
+{
+  template <typename T>
+  void operator()(T& x) const
+  {
+    ++x;
+  }
+};
+
+template <typename Policy>
+void check_algorithms(Policy policy, size_t n)
+{
+  using T = int;
+
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  // for_each
+  {
+    thrust::host_vector<T> h_result = h_data;
+    thrust::host_vector<T> d_result = h_data;
+    thrust::for_each(h_result.begin(), h_result.end(), increment());
+    thrust::for_each(policy, d_result.begin(), d_result.end(), increment());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+
+  // reduce
+  {
+    const T h_sum = thrust::reduce(h_data.begin(), h_data.end(), T(13), thrust::bit_xor<T>());
+    const T d_sum = thrust::reduce(policy, h_data.begin(), h_data.end(), T(13), thrust::bit_xor<T>());
+    ASSERT_EQUAL(h_sum, d_sum);
+  }
+
+  // copy_if
+  {
+    thrust::host_vector<T> h_result(n);
+    thrust::host_vector<T> d_result(n);
+    const size_t h_size =
+      thrust::copy_if(h_data.begin(), h_data.end(), h_result.begin(), is_even()) - h_result.begin();
+    const size_t d_size =
+      thrust::copy_if(policy, h_data.begin(), h_data.end(), d_result.begin(), is_even()) - d_result.begin();
+    ASSERT_EQUAL(h_size, d_size);
+    h_result.resize(h_size);
+    d_result.resize(d_size);
+    ASSERT_EQUAL(h_result, d_result);
+
+    std::atomic<size_t> calls{0};
+    thrust::copy_if(policy, h_data.begin(), h_data.end(), d_result.begin(), counted_is_even{&calls});
+    ASSERT_EQUAL(calls.load(), n);
+  }
+
+  // remove_if, in place
+  {
+    thrust::host_vector<T> h_result = h_data;
+    thrust::host_vector<T> d_result = h_data;
+    h_result.erase(thrust::remove_if(h_result.begin(), h_result.end(), is_even()), h_result.end());
+    d_result.erase(thrust::remove_if(policy, d_result.begin(), d_result.end(), is_even()), d_result.end());
+    ASSERT_EQUAL(h_result, d_result);
+
+    std::atomic<size_t> calls{0};
+    d_result = h_data;
+    thrust::remove_if(policy, d_result.begin(), d_result.end(), counted_is_even{&calls});
+    ASSERT_EQUAL(calls.load(), n);
+  }
+
+  // unique, in place over runs of equal keys
+  {
+    thrust::host_vector<T> h_result(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_result[i] = h_data[i] % 3;
+    }
+    thrust::host_vector<T> d_result = h_result;
+    h_result.erase(thrust::unique(h_result.begin(), h_result.end()), h_result.end());
+    d_result.erase(thrust::unique(policy, d_result.begin(), d_result.end()), d_result.end());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+
+  // reduce_by_key, over runs of equal keys of growing length
+  {
+    thrust::host_vector<T> keys(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      keys[i] = static_cast<T>(std::sqrt(static_cast<double>(i)));
+    }
+    thrust::host_vector<T> h_keys(n);
+    thrust::host_vector<T> h_values(n);
+    thrust::host_vector<T> d_keys(n);
+    thrust::host_vector<T> d_values(n);
+    const size_t h_size =
+      thrust::reduce_by_key(keys.begin(), keys.end(), h_data.begin(), h_keys.begin(), h_values.begin()).first
+      - h_keys.begin();
+    const size_t d_size =
+      thrust::reduce_by_key(policy, keys.begin(), keys.end(), h_data.begin(), d_keys.begin(), d_values.begin()).first
+      - d_keys.begin();
+    ASSERT_EQUAL(h_size, d_size);
+    ASSERT_EQUAL(h_keys, d_keys);
+    ASSERT_EQUAL(h_values, d_values);
+  }
+
+  // stable_partition, in place and copied
+  {
+    thrust::host_vector<T> h_result = h_data;
+    thrust::host_vector<T> d_result = h_data;
+    const size_t h_size = thrust::stable_partition(h_result.begin(), h_result.end(), is_even()) - h_result.begin();
+    const size_t d_size =
+      thrust::stable_partition(policy, d_result.begin(), d_result.end(), is_even()) - d_result.begin();
+    ASSERT_EQUAL(h_size, d_size);
+    ASSERT_EQUAL(h_result, d_result);
+
+    thrust::host_vector<T> d_true(n);
+    thrust::host_vector<T> d_false(n);
+    const auto ends = thrust::stable_partition_copy(
+      policy, h_data.begin(), h_data.end(), h_data.begin(), d_true.begin(), d_false.begin(), is_even());
+    d_true.erase(ends.first, d_true.end());
+    d_false.erase(ends.second, d_false.end());
+    ASSERT_EQUAL(d_true.size(), h_size);
+    ASSERT_EQUAL(
+      thrust::equal(d_true.begin(), d_true.end(), h_result.begin())
+        && thrust::equal(d_false.begin(), d_false.end(), h_result.begin() + h_size),
+      true);
+
+    std::atomic<size_t> calls{0};
+    d_result = h_data;
+    thrust::stable_partition(policy, d_result.begin(), d_result.end(), counted_is_even{&calls});
+    ASSERT_EQUAL(calls.load(), n);
+
+    calls = 0;
+    thrust::stable_partition_copy(
+      policy, h_data.begin(), h_data.end(), d_true.begin(), d_false.begin(), counted_is_even{&calls});
+    ASSERT_EQUAL(calls.load(), n);
+  }
+
+  // shuffle, the same permutation for every team size and tiling
+  {
+    thrust::host_vector<T> h_result = h_data;
+    thrust::host_vector<T> d_result = h_data;
+    thrust::default_random_engine h_g(183);
+    thrust::default_random_engine d_g(183);
+    thrust::shuffle(h_result.begin(), h_result.end(), h_g);
+    thrust::shuffle(policy, d_result.begin(), d_result.end(), d_g);
+    ASSERT_EQUAL(h_result, d_result);
+  }
+
+  // stable_sort, radix sorted and merge sorted
+  {
+    thrust::host_vector<T> h_result = h_data;
+    thrust::host_vector<T> d_result = h_data;
+    thrust::stable_sort(h_result.begin(), h_result.end());
+    thrust::stable_sort(policy, d_result.begin(), d_result.end());
+    ASSERT_EQUAL(h_result, d_result);
+
+    d_result = h_data;
+    thrust::stable_sort(h_result.begin(), h_result.end(), thrust::greater<T>());
+    thrust::stable_sort(policy, d_result.begin(), d_result.end(), thrust::greater<T>());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+}
+
+void TestOmpParModifiersAlgorithms(const size_t n)
+{
+  const thrust::omp::schedule_kind kinds[] = {
+    thrust::omp::schedule_kind::static_, thrust::omp::schedule_kind::dynamic, thrust::omp::schedule_kind::guided};
+
+  for (thrust::omp::schedule_kind kind : kinds)
+  {
+    check_algorithms(thrust::omp::par.schedule(kind), n);
+    check_algorithms(thrust::omp::par.schedule(kind).on(3), n);
+    check_algorithms(thrust::omp::par.schedule(kind).grain(7), n);
+    check_algorithms(thrust::omp::par.schedule(kind).on(1).grain(1000), n);
+  }
+}
+DECLARE_SIZED_UNITTEST(TestOmpParModifiersAlgorithms);
+
+// reduces one row per element of the outer loop, on a single thread so that the nested loops don't oversubscribe
+struct reduce_row
+{
+  const int* data;
+  int width;
+
+  void operator()(int& row) const
+  {
+    row = thrust::reduce(thrust::omp::par.on(1), data + row * width, data + (row + 1) * width);
+  }
+};
+
+void TestOmpParModifiersNested()
+{
+  const int height = 37;
+  const int width  = 101;
+
+  thrust::host_vector<int> data = unittest::random_integers<int>(height * width);
+  thrust::host_vector<int> rows(height);
+  thrust::sequence(rows.begin(), rows.end());
+
+  thrust::for_each(thrust::omp::par.schedule(thrust::omp::schedule_kind::dynamic),
+                   rows.begin(),
+                   rows.end(),
+                   reduce_row{thrust::raw_pointer_cast(data.data()), width});
+
+  for (int row = 0; row < height; ++row)
+  {
+    ASSERT_EQUAL(rows[row], thrust::reduce(data.begin() + row * width, data.begin() + (row + 1) * width));
+  }
+}
+DECLARE_UNITTEST(TestOmpParModifiersNested);
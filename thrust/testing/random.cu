@@ -670,6 +670,360 @@ void TestRanlux48Unequal()
 }
 DECLARE_UNITTEST(TestRanlux48Unequal);
 
+void TestPhilox4x32Validation()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineValidation<Engine, 1955073260u>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Validation);
+
+void TestPhilox4x32Min()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Min);
+
+void TestPhilox4x32Max()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Max);
+
+void TestPhilox4x32SaveRestore()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32SaveRestore);
+
+void TestPhilox4x32Equal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Equal);
+
+void TestPhilox4x32Unequal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Unequal);
+
+void TestPhilox4x64Validation()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineValidation<Engine, 3409172418970261260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Validation);
+
+void TestPhilox4x64Min()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Min);
+
+void TestPhilox4x64Max()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Max);
+
+void TestPhilox4x64SaveRestore()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64SaveRestore);
+
+void TestPhilox4x64Equal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Equal);
+
+void TestPhilox4x64Unequal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Unequal);
+
+void TestThreefry4x32Validation()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineValidation<Engine, 112810865u>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Validation);
+
+void TestThreefry4x32Min()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Min);
+
+void TestThreefry4x32Max()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Max);
+
+void TestThreefry4x32SaveRestore()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32SaveRestore);
+
+void TestThreefry4x32Equal()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Equal);
+
+void TestThreefry4x32Unequal()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Unequal);
+
+void TestThreefry4x64Validation()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineValidation<Engine, 9253438642465275567ull>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Validation);
+
+void TestThreefry4x64Min()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Min);
+
+void TestThreefry4x64Max()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Max);
+
+void TestThreefry4x64SaveRestore()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64SaveRestore);
+
+void TestThreefry4x64Equal()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Equal);
+
+void TestThreefry4x64Unequal()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Unequal);
+
+// the first block of a counter-based engine with a zero key and counter, from the known answer tests of Random123
+template <typename Engine>
+struct ValidateCounterBasedEngineBlock
+{
+  using result_type = typename Engine::result_type;
+
+  _CCCL_HOST_DEVICE bool operator()(void) const
+  {
+    Engine e(0);
+
+    bool result = true;
+    for (size_t i = 0; i < Engine::word_count; ++i)
+    {
+      result &= (e() == m_block[i]);
+    }
+
+    // the counter picks the block
+    e.set_counter({0, 0, 0, 1});
+    e.discard(Engine::word_count);
+    Engine e1(0);
+    e1.discard(2 * Engine::word_count);
+    result &= (e == e1) && (e() == e1());
+
+    return result;
+  }
+
+  result_type m_block[4];
+};
+
+template <typename Engine>
+void TestCounterBasedEngineBlock(typename Engine::result_type y0,
+                                 typename Engine::result_type y1,
+                                 typename Engine::result_type y2,
+                                 typename Engine::result_type y3)
+{
+  ValidateCounterBasedEngineBlock<Engine> f{{y0, y1, y2, y3}};
+
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), f);
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), f);
+
+  ASSERT_EQUAL(true, d[0]);
+}
+
+void TestCounterBasedEngineKnownAnswers()
+{
+  TestCounterBasedEngineBlock<thrust::random::philox4x32>(0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8);
+  TestCounterBasedEngineBlock<thrust::random::philox4x64>(
+    0x16554d9eca36314c, 0xdb20fe9d672d0fdc, 0xd7e772cee186176b, 0x7e68b68aec7ba23b);
+  TestCounterBasedEngineBlock<thrust::random::threefry4x32>(0x9c6ca96a, 0xe17eae66, 0xfc10ecd4, 0x5256a7d8);
+  TestCounterBasedEngineBlock<thrust::random::threefry4x64>(
+    0x09218ebde6c85537, 0x55941f5266d86105, 0x4bd25e16282434dc, 0xee29ec846bd2e40b);
+}
+DECLARE_UNITTEST(TestCounterBasedEngineKnownAnswers);
+
+// discard and generate have to agree with stepping the engine one value at a time, from every position in a block
+template <typename Engine>
+void TestCounterBasedEngineDiscardAndGenerate()
+{
+  using T = typename Engine::result_type;
+
+  for (unsigned long long start = 0; start < 2 * Engine::word_count; ++start)
+  {
+    for (unsigned long long z = 0; z < 3 * Engine::word_count + 2; ++z)
+    {
+      Engine stepped(13);
+      stepped.discard(start);
+      thrust::host_vector<T> expected(z);
+      for (unsigned long long i = 0; i < z; ++i)
+      {
+        expected[i] = stepped();
+      }
+
+      Engine discarded(13);
+      discarded.discard(start);
+      discarded.discard(z);
+      ASSERT_EQUAL(true, discarded == stepped);
+
+      Engine generated(13);
+      generated.discard(start);
+      thrust::host_vector<T> result(z);
+      generated.generate(result.begin(), result.end());
+      ASSERT_EQUAL(expected, result);
+      ASSERT_EQUAL(true, generated == stepped);
+      ASSERT_EQUAL(stepped(), generated());
+    }
+  }
+
+  // jumps far ahead carry into the upper words of the counter, here to the first block with a counter of 1 << w
+  Engine far(13);
+  if (Engine::word_size == 32)
+  {
+    far.discard(1ull << 34);
+  }
+  else
+  {
+    for (int i = 0; i < 4; ++i)
+    {
+      far.discard(~0ull);
+    }
+    far.discard(4);
+  }
+  Engine set(13);
+  set.set_counter({0, 0, 1, 0});
+  ASSERT_EQUAL(true, set == far);
+  ASSERT_EQUAL(set(), far());
+}
+
+void TestPhiloxDiscardAndGenerate()
+{
+  TestCounterBasedEngineDiscardAndGenerate<thrust::random::philox4x32>();
+  TestCounterBasedEngineDiscardAndGenerate<thrust::random::philox4x64>();
+}
+DECLARE_UNITTEST(TestPhiloxDiscardAndGenerate);
+
+void TestThreefryDiscardAndGenerate()
+{
+  TestCounterBasedEngineDiscardAndGenerate<thrust::random::threefry4x32>();
+  TestCounterBasedEngineDiscardAndGenerate<thrust::random::threefry4x64>();
+}
+DECLARE_UNITTEST(TestThreefryDiscardAndGenerate);
+
+template <typename Engine>
+void TestGenerateRandom(const size_t n)
+{
+  using T = typename Engine::result_type;
+
+  Engine h_engine(7);
+  h_engine.discard(3);
+  Engine d_engine = h_engine;
+
+  thrust::host_vector<T> h_result(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_result[i] = h_engine();
+  }
+
+  thrust::device_vector<T> d_result(n);
+  thrust::random::generate_random(d_result.begin(), d_result.end(), d_engine);
+
+  ASSERT_EQUAL(h_result, d_result);
+  ASSERT_EQUAL(true, h_engine == d_engine);
+}
+
+void TestGenerateRandomPhilox(const size_t n)
+{
+  TestGenerateRandom<thrust::random::philox4x32>(n);
+}
+DECLARE_SIZED_UNITTEST(TestGenerateRandomPhilox);
+
+void TestGenerateRandomThreefry(const size_t n)
+{
+  TestGenerateRandom<thrust::random::threefry4x64>(n);
+}
+DECLARE_SIZED_UNITTEST(TestGenerateRandomThreefry);
+
 _CCCL_DIAG_PUSH
 _CCCL_DIAG_SUPPRESS_MSVC(4305) // truncation warning
 template <typename Distribution, typename Validator>
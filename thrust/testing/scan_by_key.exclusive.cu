@@ -159,6 +159,38 @@ void TestExclusiveScanByKey(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestExclusiveScanByKey);
 
+template <typename T>
+void TestExclusiveScanByKeyLongSegments(const size_t n)
+{
+  // segments straddling the tiles of the parallel host backends, including a single segment
+  const size_t segment_lengths[] = {97, 1021, n + 1};
+
+  thrust::host_vector<T> h_vals   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_vals = h_vals;
+
+  thrust::host_vector<T> h_output(n);
+  thrust::device_vector<T> d_output(n);
+
+  for (size_t segment_length : segment_lengths)
+  {
+    thrust::host_vector<int> h_keys(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_keys[i] = static_cast<int>(i / segment_length);
+    }
+    thrust::device_vector<int> d_keys = h_keys;
+
+    thrust::exclusive_scan_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_output.begin());
+    thrust::exclusive_scan_by_key(d_keys.begin(), d_keys.end(), d_vals.begin(), d_output.begin());
+    ASSERT_EQUAL(d_output, h_output);
+
+    thrust::exclusive_scan_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_output.begin(), (T) 11);
+    thrust::exclusive_scan_by_key(d_keys.begin(), d_keys.end(), d_vals.begin(), d_output.begin(), (T) 11);
+    ASSERT_EQUAL(d_output, h_output);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestExclusiveScanByKeyLongSegments);
+
 template <typename T>
 void TestExclusiveScanByKeyInPlace(const size_t n)
 {
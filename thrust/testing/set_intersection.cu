@@ -204,6 +204,43 @@ void TestSetIntersectionMultiset(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSetIntersectionMultiset);
 
+void TestSetIntersectionLongRuns()
+{
+  // runs of equivalent elements which are much longer than a parallel tile
+  const int n1 = 100000;
+  const int n2 = 70000;
+
+  thrust::host_vector<int> h_a(n1);
+  thrust::host_vector<int> h_b(n2);
+
+  for (int i = 0; i < n1; ++i)
+  {
+    h_a[i] = i / 1021;
+  }
+
+  for (int i = 0; i < n2; ++i)
+  {
+    h_b[i] = i / 97;
+  }
+
+  thrust::device_vector<int> d_a = h_a;
+  thrust::device_vector<int> d_b = h_b;
+
+  thrust::host_vector<int> h_result(n1 + n2);
+  thrust::device_vector<int> d_result(n1 + n2);
+
+  thrust::host_vector<int>::iterator h_end =
+    thrust::set_intersection(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+  h_result.erase(h_end, h_result.end());
+
+  thrust::device_vector<int>::iterator d_end =
+    thrust::set_intersection(d_a.begin(), d_a.end(), d_b.begin(), d_b.end(), d_result.begin());
+  d_result.erase(d_end, d_result.end());
+
+  ASSERT_EQUAL(h_result, d_result);
+}
+DECLARE_UNITTEST(TestSetIntersectionLongRuns);
+
 // FIXME: disabled on Windows, because it causes a failure on the internal CI system in one specific configuration.
 // That failure will be tracked in a new NVBug, this is disabled to unblock submitting all the other changes.
 #if !_CCCL_COMPILER(MSVC)
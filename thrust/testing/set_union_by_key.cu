@@ -1,5 +1,6 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/set_operations.h>
 #include <thrust/sort.h>
 
@@ -295,3 +296,56 @@ void TestSetUnionByKeyMultiset(const size_t n)
   ASSERT_EQUAL(h_result_val, d_result_val);
 }
 DECLARE_VARIABLE_UNITTEST(TestSetUnionByKeyMultiset);
+
+void TestSetUnionByKeySingleKey()
+{
+  // a single run of equivalent keys, whose values tell which input elements make it to the output
+  const int n1 = 70000;
+  const int n2 = 100000;
+
+  thrust::host_vector<int> h_a_key(n1, 13);
+  thrust::host_vector<int> h_b_key(n2, 13);
+
+  thrust::host_vector<int> h_a_val(n1);
+  thrust::host_vector<int> h_b_val(n2);
+  thrust::sequence(h_a_val.begin(), h_a_val.end());
+  thrust::sequence(h_b_val.begin(), h_b_val.end(), n1);
+
+  thrust::device_vector<int> d_a_key = h_a_key;
+  thrust::device_vector<int> d_b_key = h_b_key;
+
+  thrust::device_vector<int> d_a_val = h_a_val;
+  thrust::device_vector<int> d_b_val = h_b_val;
+
+  thrust::host_vector<int> h_result_key(n1 + n2), h_result_val(n1 + n2);
+  thrust::device_vector<int> d_result_key(n1 + n2), d_result_val(n1 + n2);
+
+  thrust::pair<thrust::host_vector<int>::iterator, thrust::host_vector<int>::iterator> h_end = thrust::set_union_by_key(
+    h_a_key.begin(),
+    h_a_key.end(),
+    h_b_key.begin(),
+    h_b_key.end(),
+    h_a_val.begin(),
+    h_b_val.begin(),
+    h_result_key.begin(),
+    h_result_val.begin());
+  h_result_key.erase(h_end.first, h_result_key.end());
+  h_result_val.erase(h_end.second, h_result_val.end());
+
+  thrust::pair<thrust::device_vector<int>::iterator, thrust::device_vector<int>::iterator> d_end =
+    thrust::set_union_by_key(
+      d_a_key.begin(),
+      d_a_key.end(),
+      d_b_key.begin(),
+      d_b_key.end(),
+      d_a_val.begin(),
+      d_b_val.begin(),
+      d_result_key.begin(),
+      d_result_val.begin());
+  d_result_key.erase(d_end.first, d_result_key.end());
+  d_result_val.erase(d_end.second, d_result_val.end());
+
+  ASSERT_EQUAL(h_result_key, d_result_key);
+  ASSERT_EQUAL(h_result_val, d_result_val);
+}
+DECLARE_UNITTEST(TestSetUnionByKeySingleKey);
@@ -479,6 +479,28 @@ void TestBijectionLength()
 }
 DECLARE_UNITTEST(TestBijectionLength);
 
+void TestBijectionBatch()
+{
+  thrust::default_random_engine g(0xD5);
+
+  for (uint64_t m : {uint64_t(1), uint64_t(31), uint64_t(1000), uint64_t(1) << 20})
+  {
+    thrust::system::detail::generic::feistel_bijection f(m, g);
+
+    for (uint64_t first : {uint64_t(0), uint64_t(5), f.nearest_power_of_two() - 16})
+    {
+      uint64_t batch[16];
+      f(first, batch);
+
+      for (uint64_t j = 0; j < 16; ++j)
+      {
+        ASSERT_EQUAL(batch[j], f(first + j));
+      }
+    }
+  }
+}
+DECLARE_UNITTEST(TestBijectionBatch);
+
 // Individual input keys should be permuted to output locations with uniform
 // probability. Perform chi-squared test with confidence 99.9%.
 template <typename Vector>
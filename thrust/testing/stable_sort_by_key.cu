@@ -1,7 +1,12 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename RandomAccessIterator1, typename RandomAccessIterator2>
@@ -120,3 +125,66 @@ struct TestStableSortByKeySemantics
 VariableUnitTest<TestStableSortByKeySemantics,
                  unittest::type_list<unittest::uint8_t, unittest::uint16_t, unittest::uint32_t>>
   TestStableSortByKeySemanticsInstance;
+
+template <typename T>
+struct TestStableSortByKeySignedKeys
+{
+  void operator()(const size_t n)
+  {
+    // few distinct keys of both signs, so that every run of equal keys spans several tiles
+    thrust::host_vector<int> h_random = unittest::random_integers<int>(n);
+
+    std::vector<std::pair<T, int>> h_ascending(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_ascending[i] = std::make_pair(static_cast<T>(h_random[i] % 101 - 50), static_cast<int>(i));
+    }
+    std::vector<std::pair<T, int>> h_descending = h_ascending;
+
+    thrust::host_vector<T> h_keys(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_keys[i] = h_ascending[i].first;
+    }
+
+    std::stable_sort(h_ascending.begin(), h_ascending.end(), [](std::pair<T, int> a, std::pair<T, int> b) {
+      return a.first < b.first;
+    });
+    std::stable_sort(h_descending.begin(), h_descending.end(), [](std::pair<T, int> a, std::pair<T, int> b) {
+      return a.first > b.first;
+    });
+
+    thrust::host_vector<T> h_sorted_keys(n);
+    thrust::host_vector<int> h_sorted_values(n);
+
+    thrust::device_vector<T> d_keys = h_keys;
+    thrust::device_vector<int> d_values(n);
+    thrust::sequence(d_values.begin(), d_values.end());
+
+    thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), thrust::less<T>());
+
+    for (size_t i = 0; i < n; i++)
+    {
+      h_sorted_keys[i]   = h_ascending[i].first;
+      h_sorted_values[i] = h_ascending[i].second;
+    }
+    ASSERT_EQUAL(h_sorted_keys, d_keys);
+    ASSERT_EQUAL(h_sorted_values, d_values);
+
+    d_keys = h_keys;
+    thrust::sequence(d_values.begin(), d_values.end());
+
+    thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), thrust::greater<T>());
+
+    for (size_t i = 0; i < n; i++)
+    {
+      h_sorted_keys[i]   = h_descending[i].first;
+      h_sorted_values[i] = h_descending[i].second;
+    }
+    ASSERT_EQUAL(h_sorted_keys, d_keys);
+    ASSERT_EQUAL(h_sorted_values, d_values);
+  }
+};
+VariableUnitTest<TestStableSortByKeySignedKeys,
+                 unittest::type_list<signed char, short, int, long long, float, double>>
+  TestStableSortByKeySignedKeysInstance;
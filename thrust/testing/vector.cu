@@ -641,6 +641,149 @@ void TestVectorResizing()
 }
 DECLARE_VECTOR_UNITTEST(TestVectorResizing);
 
+template <class Vector>
+void TestVectorDefaultInitResizing()
+{
+  using T = typename Vector::value_type;
+
+  Vector v(3, thrust::default_init);
+
+  ASSERT_EQUAL(v.size(), 3lu);
+
+  v = {0, 1, 2};
+  v.resize(5, thrust::default_init);
+
+  ASSERT_EQUAL(v.size(), 5lu);
+
+  v[3] = 3;
+  v[4] = 4;
+
+  Vector ref{0, 1, 2, 3, 4};
+  ASSERT_EQUAL(v, ref);
+
+  // grow beyond the capacity
+  v.resize(1000, thrust::default_init);
+
+  ASSERT_EQUAL(v.size(), 1000lu);
+  ASSERT_EQUAL(v[4], T(4));
+
+  v.resize(2, thrust::default_init);
+
+  ref = {0, 1};
+  ASSERT_EQUAL(v, ref);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorDefaultInitResizing);
+
+// counts the copies and destructions of its instances
+template <int Tag>
+struct CountedElement
+{
+  static int copies;
+  static int destructions;
+
+  int value;
+
+  CountedElement(int value = 7)
+      : value(value)
+  {}
+
+  CountedElement(const CountedElement& other)
+      : value(other.value)
+  {
+    ++copies;
+  }
+
+  CountedElement& operator=(const CountedElement&) = default;
+
+  ~CountedElement()
+  {
+    ++destructions;
+  }
+
+  static void reset()
+  {
+    copies       = 0;
+    destructions = 0;
+  }
+};
+
+template <int Tag>
+int CountedElement<Tag>::copies = 0;
+
+template <int Tag>
+int CountedElement<Tag>::destructions = 0;
+
+using RelocatableElement    = CountedElement<0>;
+using NonRelocatableElement = CountedElement<1>;
+
+THRUST_PROCLAIM_TRIVIALLY_RELOCATABLE(RelocatableElement);
+
+void TestVectorDefaultInitNonTrivialType()
+{
+  // default initialization runs non-trivial default constructors
+  thrust::host_vector<NonRelocatableElement> v(4, thrust::default_init);
+  v.resize(100, thrust::default_init);
+
+  for (size_t i = 0; i < v.size(); ++i)
+  {
+    ASSERT_EQUAL(v[i].value, 7);
+  }
+}
+DECLARE_UNITTEST(TestVectorDefaultInitNonTrivialType);
+
+void TestVectorGrowthRelocatesTriviallyRelocatableElements()
+{
+  thrust::host_vector<RelocatableElement> v;
+  for (int i = 0; i < 1000; ++i)
+  {
+    v.push_back(RelocatableElement(i));
+  }
+
+  const thrust::host_vector<RelocatableElement> src(5000, RelocatableElement(-1));
+  RelocatableElement::reset();
+
+  // growth moves the bytes of the old elements instead of copying and destroying them, so only
+  // the inserted elements are copied
+  v.reserve(5000);
+  v.resize(6000);
+  v.insert(v.begin() + 1, src.begin(), src.end());
+
+  ASSERT_EQUAL(RelocatableElement::copies, 5000);
+  ASSERT_EQUAL(RelocatableElement::destructions, 0);
+
+  ASSERT_EQUAL(v.size(), 11000lu);
+  ASSERT_EQUAL(v[0].value, 0);
+  ASSERT_EQUAL(v[1].value, -1);
+  ASSERT_EQUAL(v[5000].value, -1);
+  ASSERT_EQUAL(v[5001].value, 1);
+  ASSERT_EQUAL(v[5999].value, 999);
+  ASSERT_EQUAL(v[10999].value, 7);
+}
+DECLARE_UNITTEST(TestVectorGrowthRelocatesTriviallyRelocatableElements);
+
+void TestVectorGrowthCopiesOtherElements()
+{
+  thrust::host_vector<NonRelocatableElement> v;
+  NonRelocatableElement::reset();
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    v.push_back(NonRelocatableElement(i));
+  }
+
+  ASSERT_EQUAL(v.size(), 1000lu);
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQUAL(v[i].value, i);
+  }
+
+  // growth copied the old elements and destroyed the originals, so the only copies alive are
+  // those of the 1000 pushed temporaries
+  ASSERT_GEQUAL(NonRelocatableElement::copies, 2000);
+  ASSERT_EQUAL(NonRelocatableElement::copies - NonRelocatableElement::destructions, 0);
+}
+DECLARE_UNITTEST(TestVectorGrowthCopiesOtherElements);
+
 template <class Vector>
 void TestVectorReserving()
 {
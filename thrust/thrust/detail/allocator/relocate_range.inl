@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/copy_construct_range.h>
+#include <thrust/detail/allocator/destroy_range.h>
+#include <thrust/detail/copy.h>
+#include <thrust/detail/memory_wrapper.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace allocator_traits_detail
+{
+
+// relocate_range has two cases:
+// if T is trivially relocatable and Allocator has no effectful member functions construct or destroy:
+//   1. copy the bytes of the range, after which the source range is abandoned without destruction
+// else
+//   2. copy construct the range, after which the source range must be destroyed
+
+template <typename Allocator, typename T>
+struct can_relocate_bitwise
+    : integral_constant<bool,
+                        thrust::is_trivially_relocatable<T>::value && !has_member_construct2<Allocator, T, T>::value
+                          && !has_effectful_member_destroy<Allocator, T>::value>
+{};
+
+// std::allocator's construct and destroy only invoke T's copy constructor and destructor
+template <typename U, typename T>
+struct can_relocate_bitwise<std::allocator<U>, T> : thrust::is_trivially_relocatable<T>
+{};
+
+// relocate_range case 1: copy bytes
+template <typename Allocator, typename Pointer>
+_CCCL_HOST_DEVICE ::cuda::std::enable_if_t<can_relocate_bitwise<Allocator, typename pointer_element<Pointer>::type>::value,
+                                           Pointer>
+relocate_range(Allocator& a, Pointer first, Pointer last, Pointer result)
+{
+  using byte_pointer = typename rebind_pointer<Pointer, unsigned char>::type;
+
+  const typename thrust::iterator_difference<Pointer>::type n = last - first;
+
+  thrust::copy_n(allocator_system<Allocator>::get(a),
+                 thrust::reinterpret_pointer_cast<byte_pointer>(first),
+                 n * sizeof(typename pointer_element<Pointer>::type),
+                 thrust::reinterpret_pointer_cast<byte_pointer>(result));
+
+  return result + n;
+}
+
+// relocate_range case 2: copy construct
+template <typename Allocator, typename Pointer>
+_CCCL_HOST_DEVICE ::cuda::std::enable_if_t<!can_relocate_bitwise<Allocator, typename pointer_element<Pointer>::type>::value,
+                                           Pointer>
+relocate_range(Allocator& a, Pointer first, Pointer last, Pointer result)
+{
+  // XXX assumes Pointer's associated System is default-constructible
+  typename thrust::iterator_system<Pointer>::type from_system;
+
+  return thrust::detail::copy_construct_range(from_system, a, first, last, result);
+}
+
+// destroy_relocated_range case 1: no-op
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::enable_if_t<can_relocate_bitwise<Allocator, typename pointer_element<Pointer>::type>::value>
+destroy_relocated_range(Allocator&, Pointer, Size) noexcept
+{
+  // no op
+}
+
+// destroy_relocated_range case 2: destroy
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE
+  ::cuda::std::enable_if_t<!can_relocate_bitwise<Allocator, typename pointer_element<Pointer>::type>::value>
+  destroy_relocated_range(Allocator& a, Pointer p, Size n) noexcept
+{
+  destroy_range(a, p, n);
+}
+
+} // namespace allocator_traits_detail
+
+template <typename Allocator, typename Pointer>
+_CCCL_HOST_DEVICE Pointer relocate_range(Allocator& a, Pointer first, Pointer last, Pointer result)
+{
+  return allocator_traits_detail::relocate_range(a, first, last, result);
+}
+
+// releases either side of a relocation which does not own its elements afterwards: the source range once the
+// relocation has succeeded, or the relocated copies when it is abandoned
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE void destroy_relocated_range(Allocator& a, Pointer p, Size n) noexcept
+{
+  return allocator_traits_detail::destroy_relocated_range(a, p, n);
+}
+
+} // namespace detail
+THRUST_NAMESPACE_END
@@ -104,6 +104,8 @@ public:
 
   _CCCL_HOST_DEVICE void value_initialize_n(iterator first, size_type n);
 
+  _CCCL_HOST_DEVICE void default_initialize_n(iterator first, size_type n);
+
   _CCCL_HOST_DEVICE void uninitialized_fill_n(iterator first, size_type n, const value_type& value);
 
   template <typename InputIterator>
@@ -122,6 +124,12 @@ public:
 
   _CCCL_HOST_DEVICE void destroy(iterator first, iterator last) noexcept;
 
+  // relocate moves [first, last) into uninitialized storage at result; afterwards exactly one of the two ranges
+  // owns the elements, and the other must be released with destroy_relocated instead of destroy
+  _CCCL_HOST_DEVICE iterator relocate(iterator first, iterator last, iterator result);
+
+  _CCCL_HOST_DEVICE void destroy_relocated(iterator first, iterator last) noexcept;
+
   _CCCL_HOST_DEVICE void deallocate_on_allocator_mismatch(const contiguous_storage& other) noexcept;
 
   _CCCL_HOST_DEVICE void
@@ -27,8 +27,10 @@
 #endif // no system header
 #include <thrust/detail/allocator/allocator_traits.h>
 #include <thrust/detail/allocator/copy_construct_range.h>
+#include <thrust/detail/allocator/default_initialize_range.h>
 #include <thrust/detail/allocator/destroy_range.h>
 #include <thrust/detail/allocator/fill_construct_range.h>
+#include <thrust/detail/allocator/relocate_range.h>
 #include <thrust/detail/allocator/value_initialize_range.h>
 #include <thrust/detail/contiguous_storage.h>
 #include <thrust/detail/swap.h>
@@ -208,6 +210,12 @@ _CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::value_initialize_n(iterator
   value_initialize_range(m_allocator, first.base(), n);
 } // end contiguous_storage::value_initialize_n()
 
+template <typename T, typename Alloc>
+_CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::default_initialize_n(iterator first, size_type n)
+{
+  default_initialize_range(m_allocator, first.base(), n);
+} // end contiguous_storage::default_initialize_n()
+
 template <typename T, typename Alloc>
 _CCCL_HOST_DEVICE void
 contiguous_storage<T, Alloc>::uninitialized_fill_n(iterator first, size_type n, const value_type& x)
@@ -259,6 +267,19 @@ _CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::destroy(iterator first, ite
   destroy_range(m_allocator, first.base(), last - first);
 } // end contiguous_storage::destroy()
 
+template <typename T, typename Alloc>
+_CCCL_HOST_DEVICE typename contiguous_storage<T, Alloc>::iterator
+contiguous_storage<T, Alloc>::relocate(iterator first, iterator last, iterator result)
+{
+  return iterator(relocate_range(m_allocator, first.base(), last.base(), result.base()));
+} // end contiguous_storage::relocate()
+
+template <typename T, typename Alloc>
+_CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::destroy_relocated(iterator first, iterator last) noexcept
+{
+  destroy_relocated_range(m_allocator, first.base(), last - first);
+} // end contiguous_storage::destroy_relocated()
+
 template <typename T, typename Alloc>
 _CCCL_HOST_DEVICE void
 contiguous_storage<T, Alloc>::deallocate_on_allocator_mismatch(const contiguous_storage& other) noexcept
@@ -44,6 +44,19 @@
 
 THRUST_NAMESPACE_BEGIN
 
+/*! \p default_init_t is the type of \p default_init, which selects the overloads of the
+ *  vector constructors and \p resize which default-initialize the new elements instead of
+ *  value-initializing them. Elements of trivially default constructible types are left
+ *  uninitialized, which saves a pass over memory which is about to be overwritten anyway.
+ */
+struct default_init_t
+{};
+
+/*! \p default_init is the tag passed to vector constructors and \p resize to request
+ *  default-initialized elements.
+ */
+THRUST_INLINE_CONSTANT default_init_t default_init{};
+
 namespace detail
 {
 
@@ -90,6 +103,17 @@ public:
    */
   explicit vector_base(size_type n, const Alloc& alloc);
 
+  /*! This constructor creates a vector_base with default-initialized elements.
+   *  \param n The number of elements to create.
+   */
+  vector_base(size_type n, default_init_t);
+
+  /*! This constructor creates a vector_base with default-initialized elements.
+   *  \param n The number of elements to create.
+   *  \param alloc The allocator to use by this vector_base.
+   */
+  vector_base(size_type n, default_init_t, const Alloc& alloc);
+
   /*! This constructor creates a vector_base with copies
    *  of an exemplar element.
    *  \param n The number of elements to initially create.
@@ -228,6 +252,18 @@ public:
    */
   void resize(size_type new_size, const value_type& x);
 
+  /*! \brief Resizes this vector_base to the specified number of elements.
+   *  \param new_size Number of elements this vector_base should contain.
+   *  \throw std::length_error If n exceeds max_size().
+   *
+   *  This method will resize this vector_base to the specified number of
+   *  elements. If the number is smaller than this vector_base's current
+   *  size this vector_base is truncated, otherwise this vector_base is
+   *  extended and new elements are default initialized, which leaves
+   *  elements of trivially default constructible types uninitialized.
+   */
+  void resize(size_type new_size, default_init_t);
+
   /*! Returns the number of elements in this vector_base.
    */
   _CCCL_HOST_DEVICE size_type size() const;
@@ -503,6 +539,8 @@ private:
 
   void value_init(size_type n);
 
+  void default_init_n(size_type n);
+
   void fill_init(size_type n, const T& x);
 
   // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
@@ -517,6 +555,13 @@ private:
   // this method appends n value-initialized elements at the end
   void append(size_type n);
 
+  // this method appends n default-initialized elements at the end
+  void append(size_type n, default_init_t);
+
+  // this method appends n elements at the end, constructed by initialize(storage, first, n)
+  template <typename Initializer>
+  void append_with(size_type n, Initializer initialize);
+
   // this method performs insertion from a fill value
   void fill_insert(iterator position, size_type n, const T& x);
 
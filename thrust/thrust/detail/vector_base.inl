@@ -75,6 +75,22 @@ vector_base<T, Alloc>::vector_base(size_type n, const Alloc& alloc)
   value_init(n);
 } // end vector_base::vector_base()
 
+template <typename T, typename Alloc>
+vector_base<T, Alloc>::vector_base(size_type n, default_init_t)
+    : m_storage()
+    , m_size(0)
+{
+  default_init_n(n);
+} // end vector_base::vector_base()
+
+template <typename T, typename Alloc>
+vector_base<T, Alloc>::vector_base(size_type n, default_init_t, const Alloc& alloc)
+    : m_storage(alloc)
+    , m_size(0)
+{
+  default_init_n(n);
+} // end vector_base::vector_base()
+
 template <typename T, typename Alloc>
 vector_base<T, Alloc>::vector_base(size_type n, const value_type& value)
     : m_storage()
@@ -223,6 +239,18 @@ void vector_base<T, Alloc>::value_init(size_type n)
   } // end if
 } // end vector_base::value_init()
 
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::default_init_n(size_type n)
+{
+  if (n > 0)
+  {
+    m_storage.allocate(n);
+    m_size = n;
+
+    m_storage.default_initialize_n(begin(), size());
+  } // end if
+} // end vector_base::default_init_n()
+
 template <typename T, typename Alloc>
 void vector_base<T, Alloc>::fill_init(size_type n, const T& x)
 {
@@ -327,6 +355,21 @@ void vector_base<T, Alloc>::resize(size_type new_size, const value_type& x)
   } // end else
 } // end vector_base::resize()
 
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::resize(size_type new_size, default_init_t)
+{
+  if (new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(new_size - size(), default_init);
+  } // end else
+} // end vector_base::resize()
+
 template <typename T, typename Alloc>
 _CCCL_HOST_DEVICE typename vector_base<T, Alloc>::size_type vector_base<T, Alloc>::size() const
 {
@@ -358,8 +401,8 @@ void vector_base<T, Alloc>::reserve(size_type n)
 
     try
     {
-      // construct copy all elements into the newly allocated storage
-      new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
+      // relocate all elements into the newly allocated storage
+      new_end = m_storage.relocate(begin(), end(), new_storage.begin());
     } // end try
     catch (...)
     {
@@ -371,8 +414,8 @@ void vector_base<T, Alloc>::reserve(size_type n)
       throw;
     } // end catch
 
-    // call destructors on the elements in the old storage
-    m_storage.destroy(begin(), end());
+    // release the elements in the old storage
+    m_storage.destroy_relocated(begin(), end());
 
     // record the vector's new state
     m_storage.swap(new_storage);
@@ -748,34 +791,50 @@ void vector_base<T, Alloc>::copy_insert(iterator position, ForwardIterator first
 
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
+      // the new elements go to their final position in the new storage first, so that
+      // the old storage is left untouched if their construction throws
+      iterator new_first = new_storage.begin() + (position - begin());
 
       try
       {
-        // construct copy elements before the insertion to the beginning of the newly
-        // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
-
         // construct copy elements to insert
-        new_end = m_storage.uninitialized_copy(first, last, new_end);
+        m_storage.uninitialized_copy(first, last, new_first);
+      } // end try
+      catch (...)
+      {
+        new_storage.deallocate();
+
+        // rethrow
+        throw;
+      } // end catch
 
-        // construct copy displaced elements from the old storage to the new storage
+      // record how many elements we relocate in the try block below
+      iterator relocated_end = new_storage.begin();
+
+      try
+      {
+        // relocate elements before the insertion to the beginning of the newly
+        // allocated storage
+        relocated_end = m_storage.relocate(begin(), position, new_storage.begin());
+
+        // relocate displaced elements from the old storage to the new storage
         // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
+        m_storage.relocate(position, end(), new_first + num_new_elements);
       } // end try
       catch (...)
       {
-        // something went wrong, so destroy & deallocate the new storage
-        m_storage.destroy(new_storage.begin(), new_end);
+        // something went wrong, so release the relocated elements, destroy the new elements
+        // & deallocate the new storage
+        new_storage.destroy_relocated(new_storage.begin(), relocated_end);
+        m_storage.destroy(new_first, new_first + num_new_elements);
         new_storage.deallocate();
 
         // rethrow
         throw;
       } // end catch
 
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
+      // release the elements in the old storage
+      m_storage.destroy_relocated(begin(), end());
 
       // record the vector's new state
       m_storage.swap(new_storage);
@@ -786,6 +845,23 @@ void vector_base<T, Alloc>::copy_insert(iterator position, ForwardIterator first
 
 template <typename T, typename Alloc>
 void vector_base<T, Alloc>::append(size_type n)
+{
+  append_with(n, [](storage_type& storage, iterator first, size_type count) {
+    storage.value_initialize_n(first, count);
+  });
+} // end vector_base::append()
+
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::append(size_type n, default_init_t)
+{
+  append_with(n, [](storage_type& storage, iterator first, size_type count) {
+    storage.default_initialize_n(first, count);
+  });
+} // end vector_base::append()
+
+template <typename T, typename Alloc>
+template <typename Initializer>
+void vector_base<T, Alloc>::append_with(size_type n, Initializer initialize)
 {
   if (n != 0)
   {
@@ -793,8 +869,8 @@ void vector_base<T, Alloc>::append(size_type n)
     {
       // we've got room for all of them
 
-      // default construct new elements at the end of the vector
-      m_storage.value_initialize_n(end(), n);
+      // construct new elements at the end of the vector
+      initialize(m_storage, end(), n);
 
       // extend the size
       m_size += n;
@@ -815,37 +891,36 @@ void vector_base<T, Alloc>::append(size_type n)
       // create new storage
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
+      // record how many elements we relocate in the try block below
+      iterator relocated_end = new_storage.begin();
 
       try
       {
-        // construct copy all elements into the newly allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
+        // relocate all elements into the newly allocated storage
+        relocated_end = m_storage.relocate(begin(), end(), new_storage.begin());
 
         // construct new elements to insert
-        new_storage.value_initialize_n(new_end, n);
-        new_end += n;
+        initialize(new_storage, relocated_end, n);
       } // end try
       catch (...)
       {
-        // something went wrong, so destroy & deallocate the new storage
-        new_storage.destroy(new_storage.begin(), new_end);
+        // something went wrong, so release the relocated elements & deallocate the new storage
+        new_storage.destroy_relocated(new_storage.begin(), relocated_end);
         new_storage.deallocate();
 
         // rethrow
         throw;
       } // end catch
 
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
+      // release the elements in the old storage
+      m_storage.destroy_relocated(begin(), end());
 
       // record the vector's new state
       m_storage.swap(new_storage);
       m_size = old_size + n;
     } // end else
   } // end if
-} // end vector_base::append()
+} // end vector_base::append_with()
 
 template <typename T, typename Alloc>
 void vector_base<T, Alloc>::fill_insert(iterator position, size_type n, const T& x)
@@ -914,35 +989,50 @@ void vector_base<T, Alloc>::fill_insert(iterator position, size_type n, const T&
 
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
+      // the new elements go to their final position in the new storage first, so that
+      // the old storage is left untouched if their construction throws
+      iterator new_first = new_storage.begin() + (position - begin());
 
       try
       {
-        // construct copy elements before the insertion to the beginning of the newly
-        // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
-
         // construct new elements to insert
-        m_storage.uninitialized_fill_n(new_end, n, x);
-        new_end += n;
+        m_storage.uninitialized_fill_n(new_first, n, x);
+      } // end try
+      catch (...)
+      {
+        new_storage.deallocate();
+
+        // rethrow
+        throw;
+      } // end catch
+
+      // record how many elements we relocate in the try block below
+      iterator relocated_end = new_storage.begin();
+
+      try
+      {
+        // relocate elements before the insertion to the beginning of the newly
+        // allocated storage
+        relocated_end = m_storage.relocate(begin(), position, new_storage.begin());
 
-        // construct copy displaced elements from the old storage to the new storage
+        // relocate displaced elements from the old storage to the new storage
         // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
+        m_storage.relocate(position, end(), new_first + n);
       } // end try
       catch (...)
       {
-        // something went wrong, so destroy & deallocate the new storage
-        m_storage.destroy(new_storage.begin(), new_end);
+        // something went wrong, so release the relocated elements, destroy the new elements
+        // & deallocate the new storage
+        new_storage.destroy_relocated(new_storage.begin(), relocated_end);
+        m_storage.destroy(new_first, new_first + n);
         new_storage.deallocate();
 
         // rethrow
         throw;
       } // end catch
 
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
+      // release the elements in the old storage
+      m_storage.destroy_relocated(begin(), end());
 
       // record the vector's new state
       m_storage.swap(new_storage);
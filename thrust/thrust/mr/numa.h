@@ -0,0 +1,212 @@
+/*
+ *  Copyright 2018 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource that decides on which NUMA node the pages of large allocations end up, either by touching
+ *  them from the threads that are going to use them or by interleaving them over all nodes.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+
+#include <cstddef>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  define THRUST_MR_NUMA_HAS_MMAP 1
+#endif
+
+#if defined(__linux__)
+#  include <sys/syscall.h>
+#  if defined(SYS_mbind)
+#    define THRUST_MR_NUMA_HAS_MBIND 1
+#  endif
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+//! \cond
+namespace detail
+{
+
+inline std::size_t numa_page_size()
+{
+#if defined(THRUST_MR_NUMA_HAS_MMAP)
+  static const std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  return page_size;
+#else
+  return 4096;
+#endif
+}
+
+// fresh pages straight from the operating system, which backs them with memory on the first write only
+inline void* numa_allocate_pages(std::size_t bytes)
+{
+#if defined(THRUST_MR_NUMA_HAS_MMAP)
+  void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+  if (p == MAP_FAILED)
+  {
+    throw std::bad_alloc();
+  }
+  return p;
+#else
+  return mr::new_delete_resource().do_allocate(bytes, numa_page_size());
+#endif
+}
+
+inline void numa_deallocate_pages(void* p, std::size_t bytes)
+{
+#if defined(THRUST_MR_NUMA_HAS_MMAP)
+  ::munmap(p, bytes);
+#else
+  mr::new_delete_resource().do_deallocate(p, bytes, numa_page_size());
+#endif
+}
+
+// Asks the kernel to interleave the pages over all nodes of the process through the raw mbind system call, so that
+// neither libnuma nor its headers are needed. The kernel clips the node mask to the nodes the process is allowed to
+// use, the mask has to stay within the nodes the kernel was configured for though, so it covers the first 64 only.
+// Returns false if the pages keep the default policy.
+inline bool numa_interleave_pages(void* p, std::size_t bytes)
+{
+#if defined(THRUST_MR_NUMA_HAS_MBIND)
+  const int mpol_interleave = 3; // MPOL_INTERLEAVE from <linux/mempolicy.h>
+
+  unsigned long nodes[64 / (8 * sizeof(unsigned long))];
+  for (unsigned long& word : nodes)
+  {
+    word = ~0ul;
+  }
+
+  // the kernel reads one bit less than the size of the mask that it is given
+  return ::syscall(SYS_mbind, p, bytes, mpol_interleave, nodes, 8 * sizeof(nodes) + 1, 0u) == 0;
+#else
+  (void) p;
+  (void) bytes;
+  return false;
+#endif
+}
+
+} // namespace detail
+//! \endcond
+
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! Where \p numa_resource places the pages of an allocation.
+ */
+enum class numa_policy
+{
+  /*! Every page is written once right after the allocation, by the thread that the static decomposition of the
+   *      parallel algorithms assigns it to, and the operating system backs it with memory of that thread's node.
+   *      This pays off when the threads are pinned, e.g. with \c OMP_PROC_BIND=close.
+   */
+  first_touch,
+
+  /*! The pages are spread round robin over all nodes the process may allocate from, which evens out the bandwidth of
+   *      access patterns that don't follow the static decomposition. Requires Linux, and falls back to
+   *      \p first_touch elsewhere or if the kernel refuses the request.
+   */
+  interleave
+};
+
+/*! A memory resource that takes allocations of at least \p min_bytes straight from the operating system as whole
+ *      pages and places them on NUMA nodes according to \p Policy. Smaller and overaligned allocations go to
+ *      \p new_delete_resource, since their pages are shared with other allocations anyway.
+ *
+ *  \p PageToucher is default constructible and called as <tt>touch(pages, num_pages, page_size)</tt> on new
+ *      allocations that need to be touched, with \p pages pointing to the first of \p num_pages pages of
+ *      \p page_size bytes each. It has to write to every page, from the thread that a parallel algorithm of its system
+ *      would assign the corresponding part of an array to.
+ *
+ *  The resource is stateless and safe to use from multiple threads.
+ *
+ *  \tparam PageToucher the type of the function object that writes to the pages of new allocations
+ *  \tparam Policy where the pages of large allocations are placed
+ */
+template <typename PageToucher, numa_policy Policy = numa_policy::first_touch>
+class numa_resource final : public memory_resource<>
+{
+public:
+  /*! The size of the smallest allocation that is placed, smaller ones would not give every thread a page of its own.
+   */
+  static constexpr std::size_t min_bytes = 1 << 20;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    const std::size_t page_size = detail::numa_page_size();
+
+    if (bytes < min_bytes || alignment > page_size)
+    {
+      return m_upstream.do_allocate(bytes, alignment);
+    }
+
+    const std::size_t num_pages = (bytes + page_size - 1) / page_size;
+
+    void* p = detail::numa_allocate_pages(num_pages * page_size);
+
+    if (Policy == numa_policy::interleave && detail::numa_interleave_pages(p, num_pages * page_size))
+    {
+      return p;
+    }
+
+    PageToucher()(static_cast<char*>(p), num_pages, page_size);
+
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    const std::size_t page_size = detail::numa_page_size();
+
+    if (bytes < min_bytes || alignment > page_size)
+    {
+      m_upstream.do_deallocate(p, bytes, alignment);
+      return;
+    }
+
+    const std::size_t num_pages = (bytes + page_size - 1) / page_size;
+
+    detail::numa_deallocate_pages(p, num_pages * page_size);
+  }
+
+private:
+  new_delete_resource m_upstream;
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,364 @@
+/*
+ *  Copyright 2018 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A pooling memory resource adaptor that is safe to use from multiple threads and which shards its free lists
+ *  by thread and block size, so that concurrent allocations rarely contend on a lock.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/pool.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A thread-safe pooling memory resource adaptor with the same caching behavior as \p unsynchronized_pool_resource,
+ *      but without a single lock around all of it, like \p synchronized_pool_resource has.
+ *
+ *  Every block size bucket has one free list per stripe, and every thread allocates from and deallocates to the stripe
+ *      it's assigned to. Each of those free lists has its own lock, so threads only contend when they share a stripe
+ *      and a bucket at the same time. Every block records the stripe whose free list it was carved for, and goes back
+ *      to that free list when it's deallocated, even by another thread. So blocks allocated by one thread and
+ *      deallocated by another are reused by the allocating thread, instead of piling up in the deallocating thread's
+ *      free list while the allocating one keeps refilling its own from upstream.
+ *
+ *  Allocating new chunks from upstream, as well as oversized and overaligned allocations, which are handled exactly
+ * like in \p unsynchronized_pool_resource, take a single lock, so \p Upstream doesn't need to be thread-safe.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template <typename Upstream>
+class sharded_pool_resource final : public memory_resource<typename Upstream::pointer>
+{
+  using oversized_pool = unsynchronized_pool_resource<Upstream>;
+  using lock_t         = std::lock_guard<std::mutex>;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return oversized_pool::get_default_options();
+  }
+
+  /*! Get the default number of stripes, which is the number of hardware threads rounded up to a power of two.
+   */
+  static std::size_t get_default_stripe_count()
+  {
+    const std::size_t threads = (std::max)(1u, std::thread::hardware_concurrency());
+
+    std::size_t stripes = 1;
+    while (stripes < threads)
+    {
+      stripes *= 2;
+    }
+
+    return stripes;
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   *  \param stripes the number of free lists per block size; must be a power of two
+   */
+  sharded_pool_resource(Upstream* upstream,
+                        pool_options options = get_default_options(),
+                        std::size_t stripes  = get_default_stripe_count())
+      : m_upstream(upstream)
+      , m_options(options)
+      , m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size))
+      , m_bucket_count(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1)
+      , m_stripe_count(stripes)
+      , m_free_lists(new free_list[m_stripe_count * m_bucket_count])
+      , m_allocated()
+      , m_oversized(upstream, options)
+  {
+    assert(m_options.validate());
+    assert(detail::is_power_of_2(m_stripe_count));
+
+    for (std::size_t i = 0; i < m_stripe_count * m_bucket_count; ++i)
+    {
+      m_free_lists[i].head                     = block_descriptor_ptr();
+      m_free_lists[i].previous_allocated_count = 0;
+    }
+  }
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  sharded_pool_resource(pool_options options = get_default_options())
+      : sharded_pool_resource(get_global_resource<Upstream>(), options)
+  {}
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~sharded_pool_resource()
+  {
+    release();
+  }
+
+private:
+  using void_ptr        = typename Upstream::pointer;
+  using void_ptr_traits = thrust::detail::pointer_traits<void_ptr>;
+  using char_ptr        = typename void_ptr_traits::template rebind<char>::other;
+
+  struct block_descriptor;
+  struct chunk_descriptor;
+
+  using block_descriptor_ptr = typename void_ptr_traits::template rebind<block_descriptor>::other;
+  using chunk_descriptor_ptr = typename void_ptr_traits::template rebind<chunk_descriptor>::other;
+
+  struct block_descriptor
+  {
+    block_descriptor_ptr next;
+    std::size_t stripe;
+  };
+
+  struct chunk_descriptor
+  {
+    std::size_t size;
+    chunk_descriptor_ptr next;
+  };
+
+  // aligned to keep the locks of neighboring free lists out of each other's cache lines
+  struct alignas(64) free_list
+  {
+    std::mutex mtx;
+    block_descriptor_ptr head;
+    std::size_t previous_allocated_count;
+  };
+
+  Upstream* m_upstream;
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+  std::size_t m_bucket_count;
+  std::size_t m_stripe_count;
+
+  std::unique_ptr<free_list[]> m_free_lists;
+
+  // guards everything below, and all calls to upstream
+  std::mutex m_upstream_mtx;
+  chunk_descriptor_ptr m_allocated;
+  oversized_pool m_oversized;
+
+  static std::size_t this_thread_index()
+  {
+    static std::atomic<std::size_t> next_thread_index(0);
+    static thread_local const std::size_t thread_index = next_thread_index++;
+
+    return thread_index;
+  }
+
+  std::size_t this_thread_stripe() const
+  {
+    return this_thread_index() & (m_stripe_count - 1);
+  }
+
+  free_list& get_free_list(std::size_t stripe, std::size_t bucket_idx)
+  {
+    return m_free_lists[stripe * m_bucket_count + bucket_idx];
+  }
+
+  // allocates a new chunk from upstream and splits it into blocks of the given stripe pushed to its free list,
+  // which must be locked by the caller
+  void refill(free_list& list, std::size_t stripe, std::size_t bytes_log2)
+  {
+    const std::size_t bytes = static_cast<std::size_t>(1) << bytes_log2;
+
+    std::size_t n = list.previous_allocated_count;
+    if (n == 0)
+    {
+      n = m_options.min_blocks_per_chunk;
+      if (n < (m_options.min_bytes_per_chunk >> bytes_log2))
+      {
+        n = m_options.min_bytes_per_chunk >> bytes_log2;
+      }
+    }
+    else
+    {
+      n = n * 3 / 2;
+      if (n > (m_options.max_bytes_per_chunk >> bytes_log2))
+      {
+        n = m_options.max_bytes_per_chunk >> bytes_log2;
+      }
+      if (n > m_options.max_blocks_per_chunk)
+      {
+        n = m_options.max_blocks_per_chunk;
+      }
+    }
+    list.previous_allocated_count = n;
+
+    std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
+    std::size_t block_size      = bytes + descriptor_size;
+    block_size += m_options.alignment - block_size % m_options.alignment;
+    std::size_t chunk_size = block_size * n;
+
+    void_ptr allocated;
+    {
+      lock_t lock(m_upstream_mtx);
+
+      allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+      chunk_descriptor_ptr chunk =
+        static_cast<chunk_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + chunk_size));
+
+      chunk_descriptor chunk_desc;
+      chunk_desc.size = chunk_size;
+      chunk_desc.next = m_allocated;
+      *chunk          = chunk_desc;
+      m_allocated     = chunk;
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      block_descriptor_ptr block = static_cast<block_descriptor_ptr>(
+        static_cast<void_ptr>(static_cast<char_ptr>(allocated) + block_size * i + bytes));
+
+      block_descriptor block_desc;
+      block_desc.next   = list.head;
+      block_desc.stripe = stripe;
+      *block            = block_desc;
+      list.head         = block;
+    }
+  }
+
+public:
+  /*! Releases all held memory to upstream. Unlike allocation and deallocation, this must not be called concurrently
+   *      with any other member function, since all memory previously allocated from the pool becomes invalid anyway.
+   */
+  void release()
+  {
+    // reset the free lists
+    for (std::size_t i = 0; i < m_stripe_count * m_bucket_count; ++i)
+    {
+      m_free_lists[i].head                     = block_descriptor_ptr();
+      m_free_lists[i].previous_allocated_count = 0;
+    }
+
+    // deallocate memory allocated for the buckets
+    while (detail::pointer_traits<chunk_descriptor_ptr>::get(m_allocated))
+    {
+      chunk_descriptor_ptr alloc = m_allocated;
+      m_allocated                = thrust::raw_reference_cast(*m_allocated).next;
+
+      void_ptr p = static_cast<void_ptr>(
+        static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - thrust::raw_reference_cast(*alloc).size);
+      m_upstream->do_deallocate(
+        p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+    }
+
+    // deallocate cached oversized/overaligned memory
+    m_oversized.release();
+  }
+
+  _CCCL_NODISCARD virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max)(bytes, m_options.smallest_block_size);
+    assert(detail::is_power_of_2(alignment));
+
+    // an oversized and/or overaligned allocation requested; needs to be allocated separately
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_upstream_mtx);
+      return m_oversized.do_allocate(bytes, alignment);
+    }
+
+    // the request is NOT for oversized and/or overaligned memory
+    // allocate a block from this thread's free list of the appropriate bucket
+    std::size_t bytes_log2   = thrust::detail::log2_ri(bytes);
+    const std::size_t stripe = this_thread_stripe();
+    free_list& list          = get_free_list(stripe, bytes_log2 - m_smallest_block_log2);
+
+    bytes = static_cast<std::size_t>(1) << bytes_log2;
+
+    lock_t lock(list.mtx);
+
+    if (!detail::pointer_traits<block_descriptor_ptr>::get(list.head))
+    {
+      refill(list, stripe, bytes_log2);
+    }
+
+    block_descriptor_ptr block = list.head;
+    list.head                  = thrust::raw_reference_cast(*block).next;
+    return static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(block)) - bytes);
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max)(n, m_options.smallest_block_size);
+    assert(detail::is_power_of_2(alignment));
+
+    // verify that the pointer is at least as aligned as claimed
+    assert(reinterpret_cast<detail::intmax_t>(void_ptr_traits::get(p)) % alignment == 0);
+
+    // the deallocated block is oversized and/or overaligned
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_upstream_mtx);
+      m_oversized.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    // push the block to the front of the free list of the appropriate bucket it was allocated from
+    std::size_t n_log2 = thrust::detail::log2_ri(n);
+
+    n = static_cast<std::size_t>(1) << n_log2;
+
+    block_descriptor_ptr block = static_cast<block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(p) + n));
+    const std::size_t stripe   = thrust::raw_reference_cast(*block).stripe;
+    free_list& list            = get_free_list(stripe, n_log2 - m_smallest_block_log2);
+
+    lock_t lock(list.mtx);
+
+    block_descriptor desc;
+    desc.next   = list.head;
+    desc.stripe = stripe;
+    *block      = desc;
+    list.head   = block;
+  }
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -35,9 +35,14 @@
 #include <thrust/random/discard_block_engine.h>
 #include <thrust/random/linear_congruential_engine.h>
 #include <thrust/random/linear_feedback_shift_engine.h>
+#include <thrust/random/philox_engine.h>
 #include <thrust/random/subtract_with_carry_engine.h>
+#include <thrust/random/threefry_engine.h>
 #include <thrust/random/xor_combine_engine.h>
 
+// algorithms
+#include <thrust/random/generate_random.h>
+
 // distributions
 #include <thrust/random/normal_distribution.h>
 #include <thrust/random/uniform_int_distribution.h>
@@ -0,0 +1,189 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cstddef> // for size_t
+#include <cstdint>
+
+#include <nv/target>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the mask of the lower w bits of a UIntType
+template <typename UIntType, size_t w>
+struct counter_based_engine_wordmask
+{
+  static const UIntType value = w < 8 * sizeof(UIntType) ? ((UIntType(1) << (w % (8 * sizeof(UIntType)))) - 1)
+                                                          : ~UIntType(0);
+};
+
+// the k-th element of consts
+template <typename UIntType, size_t k, UIntType... consts>
+struct counter_based_engine_constant;
+
+template <typename UIntType, UIntType head, UIntType... tail>
+struct counter_based_engine_constant<UIntType, 0, head, tail...>
+{
+  static const UIntType value = head;
+};
+
+template <typename UIntType, size_t k, UIntType head, UIntType... tail>
+struct counter_based_engine_constant<UIntType, k, head, tail...>
+{
+  static const UIntType value = counter_based_engine_constant<UIntType, k - 1, tail...>::value;
+};
+
+// the high and low halves of the 2w bit product of two w bit words
+template <size_t w>
+struct counter_based_engine_mulhilo
+{
+  static_assert(w <= 32, "counter based engines support word sizes up to 64 bits");
+
+  _CCCL_HOST_DEVICE static void apply(std::uint64_t a, std::uint64_t b, std::uint64_t& hi, std::uint64_t& lo)
+  {
+    const std::uint64_t product = a * b;
+    hi                          = product >> w;
+    lo                          = product & counter_based_engine_wordmask<std::uint64_t, w>::value;
+  }
+};
+
+template <>
+struct counter_based_engine_mulhilo<64>
+{
+  _CCCL_HOST_DEVICE static void apply(std::uint64_t a, std::uint64_t b, std::uint64_t& hi, std::uint64_t& lo)
+  {
+    lo = a * b;
+
+    // clang-format off
+    NV_IF_TARGET(NV_IS_DEVICE,
+      (hi = __umul64hi(a, b);),
+      (hi = host_mulhi(a, b);));
+    // clang-format on
+  }
+
+private:
+  static std::uint64_t host_mulhi(std::uint64_t a, std::uint64_t b)
+  {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+    const std::uint64_t a_lo = a & 0xffffffffu, a_hi = a >> 32;
+    const std::uint64_t b_lo = b & 0xffffffffu, b_hi = b >> 32;
+
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t hi_lo = a_hi * b_lo;
+    const std::uint64_t lo_hi = a_lo * b_hi;
+    const std::uint64_t hi_hi = a_hi * b_hi;
+
+    const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+    return hi_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+  }
+};
+
+// rotates a w bit word left by r bits
+template <size_t w>
+_CCCL_HOST_DEVICE std::uint64_t counter_based_engine_rotl(std::uint64_t x, unsigned int r)
+{
+  const std::uint64_t mask = counter_based_engine_wordmask<std::uint64_t, w>::value;
+  return ((x << r) | (x >> ((w - r) % w))) & mask;
+}
+
+// the rotation constants of the rounds of Threefry, which repeat after eight rounds
+template <size_t w, size_t n>
+struct threefry_rotation;
+
+template <>
+struct threefry_rotation<32, 2>
+{
+  _CCCL_HOST_DEVICE static unsigned int value(size_t round, size_t)
+  {
+    const unsigned int rotations[8] = {13, 15, 26, 6, 17, 29, 16, 24};
+    return rotations[round];
+  }
+};
+
+template <>
+struct threefry_rotation<64, 2>
+{
+  _CCCL_HOST_DEVICE static unsigned int value(size_t round, size_t)
+  {
+    const unsigned int rotations[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    return rotations[round];
+  }
+};
+
+template <>
+struct threefry_rotation<32, 4>
+{
+  _CCCL_HOST_DEVICE static unsigned int value(size_t round, size_t pair)
+  {
+    const unsigned int rotations[8][2] = {{10, 26}, {11, 21}, {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10}, {18, 20}};
+    return rotations[round][pair];
+  }
+};
+
+template <>
+struct threefry_rotation<64, 4>
+{
+  _CCCL_HOST_DEVICE static unsigned int value(size_t round, size_t pair)
+  {
+    const unsigned int rotations[8][2] = {{14, 16}, {52, 57}, {23, 40}, {5, 37}, {25, 33}, {46, 12}, {58, 22}, {32, 32}};
+    return rotations[round][pair];
+  }
+};
+
+// adds z to the counter whose least significant word is counter[0] and whose words are w bits wide
+template <typename UIntType, size_t w, size_t n>
+_CCCL_HOST_DEVICE void counter_based_engine_increment(UIntType (&counter)[n], unsigned long long z)
+{
+  const UIntType mask = counter_based_engine_wordmask<UIntType, w>::value;
+
+  for (size_t k = 0; k < n && z != 0; ++k)
+  {
+    const std::uint64_t digit = w < 64 ? (z & counter_based_engine_wordmask<std::uint64_t, w>::value) : z;
+    const std::uint64_t sum   = static_cast<std::uint64_t>(counter[k]) + digit;
+
+    counter[k] = static_cast<UIntType>(sum) & mask;
+
+    // the part of z beyond this word plus the carry out of it
+    const std::uint64_t carry = w < 64 ? (sum >> (w % 64)) : (sum < digit);
+    z                         = (w < 64 ? (z >> (w % 64)) : 0) + carry;
+  }
+}
+
+} // namespace detail
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/random/generate_random.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// fills one chunk of the range from a copy of the engine that jumped to the start of the chunk
+template <typename RandomAccessIterator, typename Engine, typename Size>
+struct generate_random_chunk
+{
+  // a few blocks per chunk, so that a chunk that doesn't start on a block boundary encrypts only one block in vain
+  static const Size chunk_size = static_cast<Size>(4 * Engine::word_count);
+
+  RandomAccessIterator first;
+  Engine engine;
+  Size n;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE void operator()(Size chunk) const
+  {
+    const Size begin = chunk * chunk_size;
+    const Size end   = n - begin < chunk_size ? n : begin + chunk_size;
+
+    Engine e = engine;
+    e.discard(static_cast<unsigned long long>(begin));
+    e.generate(first + begin, first + end);
+  }
+};
+
+} // namespace detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Engine>
+void generate_random(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                     RandomAccessIterator first,
+                     RandomAccessIterator last,
+                     Engine& e)
+{
+  using size_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+  using chunk_fn  = detail::generate_random_chunk<RandomAccessIterator, Engine, size_type>;
+
+  const size_type n = last - first;
+
+  if (n <= 0)
+  {
+    return;
+  }
+
+  const size_type num_chunks = (n + chunk_fn::chunk_size - 1) / chunk_fn::chunk_size;
+
+  thrust::for_each_n(exec, thrust::counting_iterator<size_type>(0), num_chunks, chunk_fn{first, e, n});
+
+  e.discard(static_cast<unsigned long long>(n));
+} // end generate_random()
+
+template <typename RandomAccessIterator, typename Engine>
+void generate_random(RandomAccessIterator first, RandomAccessIterator last, Engine& e)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  thrust::random::generate_random(select_system(system), first, last, e);
+} // end generate_random()
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,302 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine_math.h>
+#include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/philox_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE philox_engine<UIntType, w, n, r, consts...>::philox_engine(result_type value)
+{
+  seed(value);
+} // end philox_engine::philox_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::seed(result_type value)
+{
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_x[j] = 0;
+    m_y[j] = 0;
+  }
+
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    m_k[j] = 0;
+  }
+  m_k[0] = value & wordmask;
+
+  // the next invocation encrypts the counter
+  m_i = n - 1;
+} // end philox_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void
+philox_engine<UIntType, w, n, r, consts...>::set_counter(const ::cuda::std::array<result_type, n>& counter)
+{
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_x[n - 1 - j] = counter[j] & wordmask;
+  }
+
+  m_i = n - 1;
+} // end philox_engine::set_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::encrypt(result_type (&y)[n]) const
+{
+  using word = std::uint64_t;
+
+  const word mask = wordmask;
+
+  word x[n];
+  for (size_t j = 0; j < n; ++j)
+  {
+    x[j] = m_x[j];
+  }
+
+  word k[n / 2];
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    k[j] = m_k[j];
+  }
+
+  const word m0 = detail::counter_based_engine_constant<UIntType, 0, consts...>::value;
+  const word c0 = detail::counter_based_engine_constant<UIntType, 1, consts...>::value;
+  const word m1 = detail::counter_based_engine_constant<UIntType, n - 2, consts...>::value;
+  const word c1 = detail::counter_based_engine_constant<UIntType, n - 1, consts...>::value;
+
+  for (size_t round = 0; round < r; ++round)
+  {
+    word hi0, lo0;
+
+    if (n == 2)
+    {
+      detail::counter_based_engine_mulhilo<w>::apply(x[0], m0, hi0, lo0);
+
+      x[0] = hi0 ^ k[0] ^ x[1];
+      x[1] = lo0;
+
+      k[0] = (k[0] + c0) & mask;
+    }
+    else
+    {
+      // the words are permuted to (x2, x1, x0, x3) before every round
+      word hi1, lo1;
+      detail::counter_based_engine_mulhilo<w>::apply(x[n - 2], m0, hi0, lo0);
+      detail::counter_based_engine_mulhilo<w>::apply(x[0], m1, hi1, lo1);
+
+      x[0]     = hi0 ^ k[0] ^ x[1];
+      x[1]     = lo0;
+      x[n - 2] = hi1 ^ k[n / 2 - 1] ^ x[n - 1];
+      x[n - 1] = lo1;
+
+      k[0]         = (k[0] + c0) & mask;
+      k[n / 2 - 1] = (k[n / 2 - 1] + c1) & mask;
+    }
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    y[j] = static_cast<result_type>(x[j]);
+  }
+} // end philox_engine::encrypt()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE typename philox_engine<UIntType, w, n, r, consts...>::result_type
+philox_engine<UIntType, w, n, r, consts...>::operator()(void)
+{
+  if (++m_i == n)
+  {
+    encrypt(m_y);
+    detail::counter_based_engine_increment<UIntType, w>(m_x, 1);
+    m_i = 0;
+  }
+
+  return m_y[m_i];
+} // end philox_engine::operator()()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename OutputIterator>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::generate(OutputIterator first, OutputIterator last)
+{
+  // drain the current block
+  for (; first != last && m_i + 1 < n; ++first)
+  {
+    *first = m_y[++m_i];
+  }
+
+  // then write whole blocks
+  while (first != last)
+  {
+    encrypt(m_y);
+    detail::counter_based_engine_increment<UIntType, w>(m_x, 1);
+
+    for (m_i = 0; m_i < n && first != last; ++m_i, ++first)
+    {
+      *first = m_y[m_i];
+    }
+    --m_i;
+  }
+} // end philox_engine::generate()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::discard(unsigned long long z)
+{
+  // stay within the current block
+  if (z <= n - 1 - m_i)
+  {
+    m_i += static_cast<size_t>(z);
+    return;
+  }
+
+  // skip the blocks in between without encrypting them
+  z -= n - 1 - m_i;
+  detail::counter_based_engine_increment<UIntType, w>(m_x, (z - 1) / n);
+
+  encrypt(m_y);
+  detail::counter_based_engine_increment<UIntType, w>(m_x, 1);
+  m_i = static_cast<size_t>((z - 1) % n);
+} // end philox_engine::discard()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+philox_engine<UIntType, w, n, r, consts...>::stream_out(std::basic_ostream<CharT, Traits>& os) const
+{
+  using ostream_type = std::basic_ostream<CharT, Traits>;
+  using ios_base     = typename ostream_type::ios_base;
+
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill                        = os.fill();
+  const CharT space                       = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_x[j] << space;
+  }
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    os << m_k[j] << space;
+  }
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_y[j] << space;
+  }
+  os << m_i;
+
+  os.flags(flags);
+  os.fill(fill);
+  return os;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+philox_engine<UIntType, w, n, r, consts...>::stream_in(std::basic_istream<CharT, Traits>& is)
+{
+  using istream_type = std::basic_istream<CharT, Traits>;
+  using ios_base     = typename istream_type::ios_base;
+
+  const typename ios_base::fmtflags flags = is.flags();
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_x[j];
+  }
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    is >> m_k[j];
+  }
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_y[j];
+  }
+  is >> m_i;
+
+  is.flags(flags);
+  return is;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE bool philox_engine<UIntType, w, n, r, consts...>::equal(const philox_engine& rhs) const
+{
+  // the buffer follows from the key and the counter wherever it is going to be read
+  bool result = (m_i == rhs.m_i);
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    result &= (m_x[j] == rhs.m_x[j]);
+  }
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    result &= (m_k[j] == rhs.m_k[j]);
+  }
+
+  return result;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const philox_engine<UIntType, w, n, r, consts...>& e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os, e);
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, philox_engine<UIntType, w, n, r, consts...>& e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is, e);
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE bool operator==(const philox_engine<UIntType, w, n, r, consts...>& lhs,
+                                  const philox_engine<UIntType, w, n, r, consts...>& rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs, rhs);
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE bool operator!=(const philox_engine<UIntType, w, n, r, consts...>& lhs,
+                                  const philox_engine<UIntType, w, n, r, consts...>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+} // namespace random
+
+THRUST_NAMESPACE_END
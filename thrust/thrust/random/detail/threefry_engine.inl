@@ -0,0 +1,303 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine_math.h>
+#include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/threefry_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE threefry_engine<UIntType, w, n, r>::threefry_engine(result_type value)
+{
+  seed(value);
+} // end threefry_engine::threefry_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::seed(result_type value)
+{
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_x[j] = 0;
+    m_y[j] = 0;
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_k[j] = 0;
+  }
+  m_k[0] = value & wordmask;
+
+  // the next invocation encrypts the counter
+  m_i = n - 1;
+} // end threefry_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void
+threefry_engine<UIntType, w, n, r>::set_counter(const ::cuda::std::array<result_type, n>& counter)
+{
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_x[n - 1 - j] = counter[j] & wordmask;
+  }
+
+  m_i = n - 1;
+} // end threefry_engine::set_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::encrypt(result_type (&y)[n]) const
+{
+  using word = std::uint64_t;
+
+  const word mask = wordmask;
+
+  // the key schedule cycles through the key words and their parity
+  word ks[n + 1];
+  ks[n] = w == 32 ? 0x1BD11BDAull : 0x1BD11BDAA9FC1A22ull;
+  for (size_t j = 0; j < n; ++j)
+  {
+    ks[j] = m_k[j];
+    ks[n] ^= ks[j];
+  }
+
+  word x[n];
+  for (size_t j = 0; j < n; ++j)
+  {
+    x[j] = (static_cast<word>(m_x[j]) + ks[j]) & mask;
+  }
+
+  for (size_t round = 0; round < r; ++round)
+  {
+    if (n == 2)
+    {
+      x[0] = (x[0] + x[1]) & mask;
+      x[1] = detail::counter_based_engine_rotl<w>(x[1], detail::threefry_rotation<w, n>::value(round % 8, 0)) ^ x[0];
+    }
+    else
+    {
+      // the even rounds mix the pairs (x0, x1) and (x2, x3), the odd rounds (x0, x3) and (x2, x1)
+      const size_t a = round % 2 == 0 ? 1 : n - 1;
+      const size_t b = round % 2 == 0 ? n - 1 : 1;
+
+      x[0] = (x[0] + x[a]) & mask;
+      x[a] = detail::counter_based_engine_rotl<w>(x[a], detail::threefry_rotation<w, n>::value(round % 8, 0)) ^ x[0];
+
+      x[n - 2] = (x[n - 2] + x[b]) & mask;
+      x[b] = detail::counter_based_engine_rotl<w>(x[b], detail::threefry_rotation<w, n>::value(round % 8, 1)) ^ x[n - 2];
+    }
+
+    // inject the key schedule after every four rounds
+    if (round % 4 == 3)
+    {
+      const size_t s = round / 4 + 1;
+
+      for (size_t j = 0; j < n; ++j)
+      {
+        x[j] = (x[j] + ks[(s + j) % (n + 1)]) & mask;
+      }
+      x[n - 1] = (x[n - 1] + s) & mask;
+    }
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    y[j] = static_cast<result_type>(x[j]);
+  }
+} // end threefry_engine::encrypt()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE typename threefry_engine<UIntType, w, n, r>::result_type
+threefry_engine<UIntType, w, n, r>::operator()(void)
+{
+  if (++m_i == n)
+  {
+    encrypt(m_y);
+    detail::counter_based_engine_increment<UIntType, w>(m_x, 1);
+    m_i = 0;
+  }
+
+  return m_y[m_i];
+} // end threefry_engine::operator()()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename OutputIterator>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::generate(OutputIterator first, OutputIterator last)
+{
+  // drain the current block
+  for (; first != last && m_i + 1 < n; ++first)
+  {
+    *first = m_y[++m_i];
+  }
+
+  // then write whole blocks
+  while (first != last)
+  {
+    encrypt(m_y);
+    detail::counter_based_engine_increment<UIntType, w>(m_x, 1);
+
+    for (m_i = 0; m_i < n && first != last; ++m_i, ++first)
+    {
+      *first = m_y[m_i];
+    }
+    --m_i;
+  }
+} // end threefry_engine::generate()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::discard(unsigned long long z)
+{
+  // stay within the current block
+  if (z <= n - 1 - m_i)
+  {
+    m_i += static_cast<size_t>(z);
+    return;
+  }
+
+  // skip the blocks in between without encrypting them
+  z -= n - 1 - m_i;
+  detail::counter_based_engine_increment<UIntType, w>(m_x, (z - 1) / n);
+
+  encrypt(m_y);
+  detail::counter_based_engine_increment<UIntType, w>(m_x, 1);
+  m_i = static_cast<size_t>((z - 1) % n);
+} // end threefry_engine::discard()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+threefry_engine<UIntType, w, n, r>::stream_out(std::basic_ostream<CharT, Traits>& os) const
+{
+  using ostream_type = std::basic_ostream<CharT, Traits>;
+  using ios_base     = typename ostream_type::ios_base;
+
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill                        = os.fill();
+  const CharT space                       = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_x[j] << space;
+  }
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_k[j] << space;
+  }
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_y[j] << space;
+  }
+  os << m_i;
+
+  os.flags(flags);
+  os.fill(fill);
+  return os;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+threefry_engine<UIntType, w, n, r>::stream_in(std::basic_istream<CharT, Traits>& is)
+{
+  using istream_type = std::basic_istream<CharT, Traits>;
+  using ios_base     = typename istream_type::ios_base;
+
+  const typename ios_base::fmtflags flags = is.flags();
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_x[j];
+  }
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_k[j];
+  }
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_y[j];
+  }
+  is >> m_i;
+
+  is.flags(flags);
+  return is;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE bool threefry_engine<UIntType, w, n, r>::equal(const threefry_engine& rhs) const
+{
+  // the buffer follows from the key and the counter wherever it is going to be read
+  bool result = (m_i == rhs.m_i);
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    result &= (m_x[j] == rhs.m_x[j]);
+  }
+  for (size_t j = 0; j < n; ++j)
+  {
+    result &= (m_k[j] == rhs.m_k[j]);
+  }
+
+  return result;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const threefry_engine<UIntType, w, n, r>& e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os, e);
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, threefry_engine<UIntType, w, n, r>& e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is, e);
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE bool operator==(const threefry_engine<UIntType, w, n, r>& lhs,
+                                  const threefry_engine<UIntType, w, n, r>& rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs, rhs);
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE bool operator!=(const threefry_engine<UIntType, w, n, r>& lhs,
+                                  const threefry_engine<UIntType, w, n, r>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+} // namespace random
+
+THRUST_NAMESPACE_END
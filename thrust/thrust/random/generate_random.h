@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file generate_random.h
+ *  \brief Fills a range with the output of a counter-based random number engine in parallel.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random
+ *  \{
+ */
+
+/*! \p generate_random fills the range <tt>[first, last)</tt> with the next <tt>last - first</tt> values of the
+ *  counter-based random number engine \p e and advances \p e past them, with the same result as
+ *  <tt>thrust::generate(first, last, std::ref(e))</tt> in sequence.
+ *
+ *  Since the engine can jump to any position in constant time, the range is split into chunks of a few blocks that
+ *  are filled independently, each with a single encryption per block of \c Engine::word_count values. Unlike
+ *  \p thrust::tabulate with a functor that discards up to the index of every element, every value is encrypted only
+ *  once.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the range.
+ *  \param last The end of the range.
+ *  \param e The engine to draw the values from.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *  href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and \c
+ *  Engine::result_type is convertible to its \c value_type.
+ *  \tparam Engine is \p philox_engine or \p threefry_engine.
+ *
+ *  The following code snippet demonstrates how to use \p generate_random to fill a \p device_vector with random
+ *  numbers:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  thrust::device_vector<unsigned int> v(1 << 24);
+ *  thrust::philox4x32 rng(42);
+ *  thrust::random::generate_random(thrust::device, v.begin(), v.end(), rng);
+ *  \endcode
+ *
+ *  \see thrust::random::philox_engine
+ *  \see thrust::random::threefry_engine
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Engine>
+void generate_random(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                     RandomAccessIterator first,
+                     RandomAccessIterator last,
+                     Engine& e);
+
+/*! \p generate_random fills the range <tt>[first, last)</tt> with the next <tt>last - first</tt> values of the
+ *  counter-based random number engine \p e and advances \p e past them, with the same result as
+ *  <tt>thrust::generate(first, last, std::ref(e))</tt> in sequence.
+ *
+ *  \param first The beginning of the range.
+ *  \param last The end of the range.
+ *  \param e The engine to draw the values from.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ *  href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and \c
+ *  Engine::result_type is convertible to its \c value_type.
+ *  \tparam Engine is \p philox_engine or \p threefry_engine.
+ *
+ *  \see thrust::random::philox_engine
+ *  \see thrust::random::threefry_engine
+ */
+template <typename RandomAccessIterator, typename Engine>
+void generate_random(RandomAccessIterator first, RandomAccessIterator last, Engine& e);
+
+/*! \} // end random
+ */
+
+} // namespace random
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/generate_random.inl>
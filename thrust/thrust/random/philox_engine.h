@@ -0,0 +1,280 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file philox_engine.h
+ *  \brief A counter-based pseudorandom number generator
+ *         based on Salmon, Moraes, Dror & Shaw.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine_math.h>
+#include <thrust/random/detail/random_core_access.h>
+
+#include <cuda/std/array>
+
+#include <cstddef> // for size_t
+#include <cstdint>
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class philox_engine
+ *  \brief A \p philox_engine random number engine produces unsigned integer random numbers
+ *         by encrypting a counter with the Philox block cipher of Salmon, Moraes, Dror & Shaw.
+ *
+ *         The state of a \p philox_engine consists of an \c n word counter \c X, an <tt>n/2</tt>
+ *         word key \c K, a buffer \c Y of \c n words and an index \c i into \c Y. The generation
+ *         algorithm is performed as follows:
+ *         -# Increment \c i. If <tt>i == n</tt>, set \c Y to the encryption of \c X under \c K,
+ *            increment \c X and set \c i to \c 0.
+ *         -# Return <tt>Y_i</tt>.
+ *
+ *         Since every block of \c n values depends on the counter only, \p discard takes constant
+ *         time, and an engine that was seeded once and advanced by \c k with \p discard produces
+ *         an independent stream per index \c k.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values (<tt>w <= sizeof(UIntType)</tt>, at most 64).
+ *  \tparam n The number of words of the counter, \c 2 or \c 4.
+ *  \tparam r The number of rounds of the block cipher.
+ *  \tparam consts The multipliers and the round constants of the block cipher, alternating.
+ *
+ *  \note The interface and the predefined engines follow \c std::philox_engine of C++26.
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p philox4x32 or \p philox4x64, which are instances of \p philox_engine.
+ *
+ *  \see thrust::random::philox4x32
+ *  \see thrust::random::philox4x64
+ */
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+class philox_engine
+{
+  static_assert(n == 2 || n == 4, "philox_engine supports counters of 2 or 4 words");
+  static_assert(sizeof...(consts) == n, "philox_engine needs a multiplier and a round constant per pair of words");
+  static_assert(w > 0 && w <= 64 && w <= 8 * sizeof(UIntType), "unsupported word size");
+
+  /*! \cond
+   */
+
+private:
+  static const UIntType wordmask = detail::counter_based_engine_wordmask<UIntType, w>::value;
+  /*! \endcond
+   */
+
+public:
+  // types
+
+  /*! \typedef result_type
+   *  \brief The type of the unsigned integer produced by this \p philox_engine.
+   */
+  using result_type = UIntType;
+
+  // engine characteristics
+
+  /*! The word size of the produced values.
+   */
+  static const size_t word_size = w;
+
+  /*! The number of words of the counter, and the number of values produced per encryption.
+   */
+  static const size_t word_count = n;
+
+  /*! The number of rounds of the block cipher.
+   */
+  static const size_t round_count = r;
+
+  /*! The smallest value this \p philox_engine may potentially produce.
+   */
+  static const result_type min = 0;
+
+  /*! The largest value this \p philox_engine may potentially produce.
+   */
+  static const result_type max = wordmask;
+
+  /*! The default seed of this \p philox_engine.
+   */
+  static const result_type default_seed = 20111115u;
+
+  // constructors and seeding functions
+
+  /*! This constructor, which optionally accepts a seed, initializes a new
+   *  \p philox_engine.
+   *
+   *  \param value The seed used to intialize this \p philox_engine's state.
+   */
+  _CCCL_HOST_DEVICE explicit philox_engine(result_type value = default_seed);
+
+  /*! This method initializes this \p philox_engine's state, and optionally accepts
+   *  a seed value. The seed becomes the first word of the key, the counter starts at zero.
+   *
+   *  \param value The seed used to initializes this \p philox_engine's state.
+   */
+  _CCCL_HOST_DEVICE void seed(result_type value = default_seed);
+
+  /*! This method sets the counter of this \p philox_engine, so that the next value produced is the
+   *  first word of the encryption of \p counter.
+   *
+   *  \param counter The new counter, most significant word first.
+   */
+  _CCCL_HOST_DEVICE void set_counter(const ::cuda::std::array<result_type, n>& counter);
+
+  // generating functions
+
+  /*! This member function produces a new random value and updates this \p philox_engine's state.
+   *  \return A new random number.
+   */
+  _CCCL_HOST_DEVICE result_type operator()(void);
+
+  /*! This member function writes the next <tt>last - first</tt> values of this \p philox_engine to
+   *  <tt>[first, last)</tt>, a whole block of \c n values per encryption, and updates its state as if
+   *  \p operator() had been called that often.
+   *
+   *  \param first The beginning of the range to fill.
+   *  \param last The end of the range to fill.
+   */
+  template <typename OutputIterator>
+  _CCCL_HOST_DEVICE void generate(OutputIterator first, OutputIterator last);
+
+  /*! This member function advances this \p philox_engine's state a given number of times
+   *  and discards the results, in constant time.
+   *
+   *  \param z The number of random values to discard.
+   */
+  _CCCL_HOST_DEVICE void discard(unsigned long long z);
+
+  /*! \cond
+   */
+
+private:
+  result_type m_x[n];
+  result_type m_k[n / 2];
+  result_type m_y[n];
+  size_t m_i;
+
+  friend struct thrust::random::detail::random_core_access;
+
+  _CCCL_HOST_DEVICE void encrypt(result_type (&y)[n]) const;
+
+  _CCCL_HOST_DEVICE bool equal(const philox_engine& rhs) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_ostream<CharT, Traits>& stream_out(std::basic_ostream<CharT, Traits>& os) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_istream<CharT, Traits>& stream_in(std::basic_istream<CharT, Traits>& is);
+
+  /*! \endcond
+   */
+}; // end philox_engine
+
+/*! This function checks two \p philox_engines for equality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator==(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs);
+
+/*! This function checks two \p philox_engines for inequality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator!=(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs);
+
+/*! This function streams a philox_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p philox_engine to stream out.
+ *  \return \p os
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const philox_engine<UIntType_, w_, n_, r_, consts_...>& e);
+
+/*! This function streams a philox_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p philox_engine to stream in.
+ *  \return \p is
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, philox_engine<UIntType_, w_, n_, r_, consts_...>& e);
+
+/*! \} // end random_number_engine_templates
+ */
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef philox4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x32-10 counter-based random number generator.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x32
+ *        shall produce the value \c 1955073260 .
+ */
+using philox4x32 = philox_engine<std::uint32_t, 32, 4, 10, 0xCD9E8D57, 0x9E3779B9, 0xD2511F53, 0xBB67AE85>;
+
+/*! \typedef philox4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x64-10 counter-based random number generator.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x64
+ *        shall produce the value \c 3409172418970261260 .
+ */
+using philox4x64 =
+  philox_engine<std::uint64_t,
+                64,
+                4,
+                10,
+                0xCA5A826395121157,
+                0x9E3779B97F4A7C15,
+                0xD2E7470EE14C6C93,
+                0xBB67AE8584CAA73B>;
+
+/*! \} // end predefined_random
+ */
+
+} // namespace random
+
+// import names into thrust::
+using random::philox4x32;
+using random::philox4x64;
+using random::philox_engine;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/philox_engine.inl>
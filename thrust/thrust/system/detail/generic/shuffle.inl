@@ -68,22 +68,56 @@ public:
 
   _CCCL_HOST_DEVICE std::uint64_t operator()(const std::uint64_t val) const
   {
-    std::uint32_t state[2] = {static_cast<std::uint32_t>(val >> right_side_bits),
-                              static_cast<std::uint32_t>(val & right_side_mask)};
+    round_state state = {static_cast<std::uint32_t>(val >> right_side_bits),
+                         static_cast<std::uint32_t>(val & right_side_mask)};
     for (std::uint32_t i = 0; i < num_rounds; i++)
     {
-      std::uint32_t hi, lo;
-      constexpr std::uint64_t M0 = UINT64_C(0xD2B74407B1CE6E93);
-      mulhilo(M0, state[0], hi, lo);
-      lo       = (lo << (right_side_bits - left_side_bits)) | state[1] >> left_side_bits;
-      state[0] = ((hi ^ key[i]) ^ state[1]) & left_side_mask;
-      state[1] = lo & right_side_mask;
+      do_round(i, state);
     }
     // Combine the left and right sides together to get result
-    return (static_cast<std::uint64_t>(state[0]) << right_side_bits) | static_cast<std::uint64_t>(state[1]);
+    return combine(state);
+  }
+
+  // Evaluates the bijection at the N consecutive values starting at first. Every round runs for all of them before
+  // the next one, so that the rounds of different values overlap instead of waiting on each other.
+  template <std::uint32_t N>
+  _CCCL_HOST_DEVICE void operator()(const std::uint64_t first, std::uint64_t (&result)[N]) const
+  {
+    round_state state[N];
+    for (std::uint32_t j = 0; j < N; j++)
+    {
+      state[j] = {static_cast<std::uint32_t>((first + j) >> right_side_bits),
+                  static_cast<std::uint32_t>((first + j) & right_side_mask)};
+    }
+    for (std::uint32_t i = 0; i < num_rounds; i++)
+    {
+      for (std::uint32_t j = 0; j < N; j++)
+      {
+        do_round(i, state[j]);
+      }
+    }
+    for (std::uint32_t j = 0; j < N; j++)
+    {
+      result[j] = combine(state[j]);
+    }
   }
 
 private:
+  _CCCL_HOST_DEVICE void do_round(std::uint32_t i, round_state& state) const
+  {
+    std::uint32_t hi, lo;
+    constexpr std::uint64_t M0 = UINT64_C(0xD2B74407B1CE6E93);
+    mulhilo(M0, state.left, hi, lo);
+    lo          = (lo << (right_side_bits - left_side_bits)) | state.right >> left_side_bits;
+    state.left  = ((hi ^ key[i]) ^ state.right) & left_side_mask;
+    state.right = lo & right_side_mask;
+  }
+
+  _CCCL_HOST_DEVICE std::uint64_t combine(const round_state& state) const
+  {
+    return (static_cast<std::uint64_t>(state.left) << right_side_bits) | static_cast<std::uint64_t>(state.right);
+  }
+
   // Perform 64 bit multiplication and save result in two 32 bit int
   static _CCCL_HOST_DEVICE void mulhilo(std::uint64_t a, std::uint64_t b, std::uint32_t& hi, std::uint32_t& lo)
   {
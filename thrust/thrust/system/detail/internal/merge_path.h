@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file merge_path.h
+ *  \brief Partitioning of merge-like operations into independent tiles.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/binary_search.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Returns the number of elements of the first range that precede the
+// diagonal-th element of the merged output, a.k.a. the co-rank of diagonal.
+// Ties are broken in favor of the first range, which keeps the merge stable.
+template <typename Size, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+Size merge_path(RandomAccessIterator1 first1,
+                Size n1,
+                RandomAccessIterator2 first2,
+                Size n2,
+                Size diagonal,
+                StrictWeakOrdering comp)
+{
+  Size lo = diagonal > n2 ? diagonal - n2 : Size(0);
+  Size hi = (thrust::min)(diagonal, n1);
+
+  while (lo < hi)
+  {
+    const Size mid = lo + (hi - lo) / 2;
+
+    if (comp(thrust::raw_reference_cast(first2[diagonal - 1 - mid]), thrust::raw_reference_cast(first1[mid])))
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+// Returns the split of the run of the elements equivalent to x that begins at
+// begin1 and begin2 and is cut by the merge path split i, j.
+template <typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename T,
+          typename StrictWeakOrdering>
+thrust::pair<Size, Size> balanced_path_in_run(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size i,
+  Size j,
+  const T& x,
+  StrictWeakOrdering comp)
+{
+  const Size begin1 = static_cast<Size>(thrust::lower_bound(thrust::seq, first1, first1 + i, x, comp) - first1);
+  const Size begin2 = static_cast<Size>(thrust::lower_bound(thrust::seq, first2, first2 + j, x, comp) - first2);
+  const Size end1   = static_cast<Size>(thrust::upper_bound(thrust::seq, first1 + i, first1 + n1, x, comp) - first1);
+  const Size end2   = static_cast<Size>(thrust::upper_bound(thrust::seq, first2 + j, first2 + n2, x, comp) - first2);
+
+  // the rank of the split in the run, and the number of elements of either range paired up
+  const Size rank   = (i - begin1) + (j - begin2);
+  const Size paired = (thrust::min)(end1 - begin1, end2 - begin2);
+
+  if (rank <= 2 * paired)
+  {
+    return thrust::make_pair(begin1 + rank / 2, begin2 + rank / 2);
+  }
+
+  if (end1 - begin1 == paired)
+  {
+    return thrust::make_pair(end1, begin2 + (rank - paired));
+  }
+
+  return thrust::make_pair(begin1 + (rank - paired), end2);
+}
+
+// Returns the split of both ranges at the diagonal-th element of their balanced path.
+// Set operations treat their inputs as multisets: they pair up the k-th elements of
+// the runs of equivalent elements of both ranges, and then handle the unpaired rest
+// of the longer run. The balanced path walks a run in that order, so a split inside
+// a run takes as many of its elements from either range, or the whole shorter run
+// and part of the rest of the longer one. A split at an odd rank in the paired part
+// of a run is moved back by one element.
+template <typename Size, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+thrust::pair<Size, Size> balanced_path(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size diagonal,
+  StrictWeakOrdering comp)
+{
+  const Size i = merge_path(first1, n1, first2, n2, diagonal, comp);
+  const Size j = diagonal - i;
+
+  if (i == n1 && j == n2)
+  {
+    return thrust::make_pair(n1, n2);
+  }
+
+  // the run that is cut is the one of the element following the merge path split in merged order
+  // everything before the merge path split is ordered before or equivalent to that element
+  const bool next_is_first = (j == n2) || (i < n1 && !comp(thrust::raw_reference_cast(first2[j]),
+                                                            thrust::raw_reference_cast(first1[i])));
+
+  if (next_is_first)
+  {
+    return balanced_path_in_run(first1, n1, first2, n2, i, j, thrust::raw_reference_cast(first1[i]), comp);
+  }
+
+  return balanced_path_in_run(first1, n1, first2, n2, i, j, thrust::raw_reference_cast(first2[j]), comp);
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
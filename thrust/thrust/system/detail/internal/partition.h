@@ -0,0 +1,147 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file partition.h
+ *  \brief Sequential building blocks for tiled, parallel stable partitions.
+ *
+ *  A parallel stable partition splits its input into contiguous tiles and
+ *  proceeds in three passes:
+ *
+ *    1. every tile counts its true elements with \p stable_partition_tile_count,
+ *       which also records the answer of the predicate for every element,
+ *    2. the counts are turned into output offsets, sequentially over the tiles,
+ *    3. every tile writes its elements with \p stable_partition_tile, reading
+ *       the recorded answers through \p partition_flag.
+ *
+ *  The predicate is thus evaluated once per element, and the writes of a tile
+ *  always agree with its count.
+ *
+ *  The false elements of a tile go to the tile's first index minus its offset
+ *  in the true output, so a single count per tile places both outputs.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_reference_cast.h>
+
+#include <new>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// writes an element through an output iterator
+struct partition_assign
+{
+  template <typename OutputIterator, typename Reference>
+  void operator()(OutputIterator out, Reference&& value) const
+  {
+    *out = value;
+  }
+};
+
+// copy constructs an element in uninitialized storage
+struct partition_construct
+{
+  template <typename T, typename Reference>
+  void operator()(T* out, Reference&& value) const
+  {
+    ::new (static_cast<void*>(out)) T(thrust::raw_reference_cast(value));
+  }
+};
+
+// reads back the answers of the predicate recorded by stable_partition_tile_count
+struct partition_flag
+{
+  bool operator()(unsigned char flag) const
+  {
+    return flag != 0;
+  }
+};
+
+// the number of i in [tile_begin, tile_end) for which pred(stencil[i]) is true, which is also stored in flags[i]
+template <typename Size, typename RandomAccessIterator, typename Predicate>
+Size stable_partition_tile_count(
+  RandomAccessIterator stencil, Size tile_begin, Size tile_end, unsigned char* flags, Predicate pred)
+{
+  Size count = 0;
+
+  for (Size i = tile_begin; i < tile_end; ++i)
+  {
+    const bool flag = pred(stencil[i]);
+    flags[i]        = flag;
+    count += flag;
+  }
+
+  return count;
+}
+
+// writes first[i] for every i in [tile_begin, tile_end) to out_true if pred(stencil[i]) is true and to out_false
+// otherwise, both in order, and returns the number of true elements
+template <typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate,
+          typename Write>
+Size stable_partition_tile(
+  RandomAccessIterator1 first,
+  RandomAccessIterator2 stencil,
+  Size tile_begin,
+  Size tile_end,
+  OutputIterator1 out_true,
+  OutputIterator2 out_false,
+  Predicate pred,
+  Write write)
+{
+  Size count = 0;
+
+  for (Size i = tile_begin; i < tile_end; ++i)
+  {
+    if (pred(stencil[i]))
+    {
+      write(out_true, first[i]);
+      ++out_true;
+      ++count;
+    }
+    else
+    {
+      write(out_false, first[i]);
+      ++out_false;
+    }
+  }
+
+  return count;
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
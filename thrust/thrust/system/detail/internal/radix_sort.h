@@ -0,0 +1,252 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file radix_sort.h
+ *  \brief Sequential building blocks for tiled, parallel LSD radix sorts.
+ *
+ *  Keys are mapped to unsigned integers that compare like the keys and are
+ *  sorted one 8 bit digit at a time, least significant digit first. Every
+ *  pass splits the input into tiles and proceeds in three steps:
+ *
+ *    1. every tile counts its digits with \p radix_sort_tile_count,
+ *    2. \p radix_sort_scan_counts turns the counts into output offsets,
+ *       digit by digit and tile by tile within a digit, which keeps the sort
+ *       stable,
+ *    3. every tile scatters its elements to their offsets with
+ *       \p radix_sort_tile_scatter.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/functional.h>
+
+#include <cuda/std/type_traits>
+
+#include <cstdint>
+#include <cstring>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+const unsigned int radix_sort_digit_bits  = 8;
+const unsigned int radix_sort_num_buckets = 1u << radix_sort_digit_bits;
+const unsigned int radix_sort_digit_mask  = radix_sort_num_buckets - 1;
+
+// arithmetic keys of up to 64 bits compared with less or greater are sorted by their bits
+template <typename Key, typename Compare>
+struct use_radix_sort
+    : ::cuda::std::_And<::cuda::std::is_arithmetic<Key>,
+                        ::cuda::std::bool_constant<sizeof(Key) <= sizeof(std::uint64_t)>,
+                        ::cuda::std::disjunction<::cuda::std::is_same<Compare, thrust::less<Key>>,
+                                                 ::cuda::std::is_same<Compare, thrust::greater<Key>>>>
+{};
+
+template <typename Key, typename Enable = void>
+struct radix_key_traits;
+
+template <>
+struct radix_key_traits<bool>
+{
+  using bits_type = unsigned char;
+
+  static bits_type to_bits(bool key)
+  {
+    return static_cast<bits_type>(key);
+  }
+};
+
+// flip the sign bit of signed integers so that negative keys come first
+template <typename Key>
+struct radix_key_traits<Key,
+                        ::cuda::std::enable_if_t<::cuda::std::is_integral<Key>::value
+                                                 && !::cuda::std::is_same<Key, bool>::value>>
+{
+  using bits_type = ::cuda::std::make_unsigned_t<Key>;
+
+  static bits_type to_bits(Key key)
+  {
+    const bits_type sign_bit =
+      ::cuda::std::is_signed<Key>::value ? static_cast<bits_type>(bits_type(1) << (8 * sizeof(bits_type) - 1)) : 0;
+
+    return static_cast<bits_type>(static_cast<bits_type>(key) ^ sign_bit);
+  }
+};
+
+// flip all bits of negative floating point keys and the sign bit of positive ones, -0.0 sorts as +0.0 so that it
+// stays in place relative to the keys it compares equal to
+template <typename Key>
+struct radix_key_traits<Key, ::cuda::std::enable_if_t<::cuda::std::is_floating_point<Key>::value>>
+{
+  using bits_type = ::cuda::std::conditional_t<sizeof(Key) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+  static_assert(sizeof(Key) == sizeof(bits_type), "unsupported floating point key");
+
+  static bits_type to_bits(Key key)
+  {
+    const bits_type sign_bit = bits_type(1) << (8 * sizeof(bits_type) - 1);
+
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(bits_type));
+
+    if (bits == sign_bit)
+    {
+      bits = 0;
+    }
+
+    return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+  }
+};
+
+template <typename Key>
+struct radix_sort_num_passes
+    : ::cuda::std::integral_constant<unsigned int,
+                                     8 * sizeof(typename radix_key_traits<Key>::bits_type) / radix_sort_digit_bits>
+{};
+
+// extracts one digit of a key, inverting the key first for a descending sort
+template <typename Key, bool Descending>
+struct radix_digit
+{
+  using bits_type = typename radix_key_traits<Key>::bits_type;
+
+  unsigned int shift;
+
+  explicit radix_digit(unsigned int pass)
+      : shift(pass * radix_sort_digit_bits)
+  {}
+
+  unsigned int operator()(Key key) const
+  {
+    bits_type bits = radix_key_traits<Key>::to_bits(key);
+
+    if (Descending)
+    {
+      bits = static_cast<bits_type>(~bits);
+    }
+
+    return static_cast<unsigned int>(bits >> shift) & radix_sort_digit_mask;
+  }
+};
+
+template <typename Key, typename Compare>
+struct radix_digit_for
+{
+  using type = radix_digit<Key, ::cuda::std::is_same<Compare, thrust::greater<Key>>::value>;
+};
+
+// counts the digits of the keys in [begin, end) into counts[0, radix_sort_num_buckets)
+template <typename RandomAccessIterator, typename Size, typename Digit>
+void radix_sort_tile_count(RandomAccessIterator keys, Size begin, Size end, Digit digit, Size* counts)
+{
+  for (unsigned int bucket = 0; bucket < radix_sort_num_buckets; ++bucket)
+  {
+    counts[bucket] = 0;
+  }
+
+  for (Size i = begin; i < end; ++i)
+  {
+    ++counts[digit(keys[i])];
+  }
+}
+
+// Replaces the per tile counts with the offset at which every tile writes its first key of every digit. Returns false
+// if all n keys share the same digit, in which case the pass would not move anything and can be skipped.
+template <typename Size>
+bool radix_sort_scan_counts(Size* counts, Size num_tiles, Size n)
+{
+  for (unsigned int bucket = 0; bucket < radix_sort_num_buckets; ++bucket)
+  {
+    Size total = 0;
+
+    for (Size tile = 0; tile < num_tiles; ++tile)
+    {
+      total += counts[tile * radix_sort_num_buckets + bucket];
+    }
+
+    if (total == n)
+    {
+      return false;
+    }
+  }
+
+  Size sum = 0;
+
+  for (unsigned int bucket = 0; bucket < radix_sort_num_buckets; ++bucket)
+  {
+    for (Size tile = 0; tile < num_tiles; ++tile)
+    {
+      const Size count                               = counts[tile * radix_sort_num_buckets + bucket];
+      counts[tile * radix_sort_num_buckets + bucket] = sum;
+      sum += count;
+    }
+  }
+
+  return true;
+}
+
+// moves the keys in [begin, end) to their offsets, note that the offsets are advanced
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename Digit>
+void radix_sort_tile_scatter(
+  RandomAccessIterator1 keys, RandomAccessIterator2 keys_result, Size begin, Size end, Digit digit, Size* offsets)
+{
+  for (Size i = begin; i < end; ++i)
+  {
+    keys_result[offsets[digit(keys[i])]++] = keys[i];
+  }
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename Digit>
+void radix_sort_by_key_tile_scatter(
+  RandomAccessIterator1 keys,
+  RandomAccessIterator2 values,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  Size begin,
+  Size end,
+  Digit digit,
+  Size* offsets)
+{
+  for (Size i = begin; i < end; ++i)
+  {
+    const Size offset     = offsets[digit(keys[i])]++;
+    keys_result[offset]   = keys[i];
+    values_result[offset] = values[i];
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
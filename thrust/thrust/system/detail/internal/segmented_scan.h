@@ -0,0 +1,280 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file segmented_scan.h
+ *  \brief Sequential building blocks for tiled, parallel scan_by_key.
+ *
+ *  A parallel scan_by_key splits the input into tiles and proceeds in three passes:
+ *
+ *    1. every tile reduces its last segment with \p reduce_last_segment,
+ *    2. the per-tile partial sums are turned into per-tile carries with
+ *       \p accumulate_segment_carries, sequentially over the tiles,
+ *    3. every tile is scanned with \p inclusive_scan_by_key_tile or
+ *       \p exclusive_scan_by_key_tile, seeded with its carry.
+ *
+ *  Passes 1 and 3 only read the keys and values of their own tile, except for the
+ *  key immediately preceding the tile which is read in pass 1, before any output is
+ *  written. This keeps in-place scans on either the keys or the values correct.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+template <typename ValueType>
+struct segment_carry
+{
+  // after pass 1: the reduction of the tile's last segment
+  // after pass 2: the carry flowing into the tile
+  ValueType sum;
+
+  // the tile's first element belongs to the same segment as the previous tile's last element
+  bool continues_in;
+
+  // the tile's last segment begins at the tile's first element
+  bool spans_tile;
+};
+
+template <typename ValueType,
+          typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+segment_carry<ValueType> reduce_last_segment(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  Size tile_begin,
+  Size tile_end,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  segment_carry<ValueType> result;
+
+  result.continues_in = false;
+
+  if (tile_begin > 0)
+  {
+    KeyType prev_key    = keys_first[tile_begin - 1];
+    KeyType key         = keys_first[tile_begin];
+    result.continues_in = binary_pred(prev_key, key);
+  }
+
+  // walk backward to the head of the last segment
+  Size segment_begin = tile_end - 1;
+  KeyType key        = keys_first[segment_begin];
+
+  while (segment_begin > tile_begin)
+  {
+    KeyType prev_key = keys_first[segment_begin - 1];
+
+    if (!binary_pred(prev_key, key))
+    {
+      break;
+    }
+
+    key = prev_key;
+    --segment_begin;
+  }
+
+  result.spans_tile = segment_begin == tile_begin;
+
+  ValueType sum = values_first[segment_begin];
+  for (Size i = segment_begin + 1; i < tile_end; ++i)
+  {
+    const ValueType value = values_first[i];
+    sum                   = wrapped_binary_op(sum, value);
+  }
+  result.sum = sum;
+
+  return result;
+}
+
+// inclusive flavor: a segment that continues through a tile extends its carry
+template <typename ValueType, typename Size, typename BinaryFunction>
+void accumulate_segment_carries(segment_carry<ValueType>* carries, Size num_tiles, BinaryFunction binary_op)
+{
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  ValueType carry = carries[0].sum;
+
+  for (Size i = 1; i < num_tiles; ++i)
+  {
+    const ValueType partial = carries[i].sum;
+    carries[i].sum          = carry;
+
+    if (carries[i].spans_tile && carries[i].continues_in)
+    {
+      carry = wrapped_binary_op(carry, partial);
+    }
+    else
+    {
+      carry = partial;
+    }
+  }
+}
+
+// exclusive flavor: every segment's running sum starts from init
+template <typename ValueType, typename Size, typename BinaryFunction>
+void accumulate_segment_carries(
+  segment_carry<ValueType>* carries, Size num_tiles, const ValueType& init, BinaryFunction binary_op)
+{
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  ValueType carry = wrapped_binary_op(init, carries[0].sum);
+
+  for (Size i = 1; i < num_tiles; ++i)
+  {
+    const ValueType partial = carries[i].sum;
+    carries[i].sum          = carry;
+
+    if (carries[i].spans_tile && carries[i].continues_in)
+    {
+      carry = wrapped_binary_op(carry, partial);
+    }
+    else
+    {
+      carry = wrapped_binary_op(init, partial);
+    }
+  }
+}
+
+template <typename ValueType,
+          typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+void inclusive_scan_by_key_tile(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  RandomAccessIterator3 result,
+  Size tile_begin,
+  Size tile_end,
+  const segment_carry<ValueType>& carry,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  KeyType prev_key     = keys_first[tile_begin];
+  ValueType prev_value = values_first[tile_begin];
+
+  if (carry.continues_in)
+  {
+    prev_value = wrapped_binary_op(carry.sum, prev_value);
+  }
+
+  result[tile_begin] = prev_value;
+
+  for (Size i = tile_begin + 1; i < tile_end; ++i)
+  {
+    KeyType key = keys_first[i];
+
+    if (binary_pred(prev_key, key))
+    {
+      result[i] = prev_value = wrapped_binary_op(prev_value, values_first[i]);
+    }
+    else
+    {
+      result[i] = prev_value = values_first[i];
+    }
+
+    prev_key = key;
+  }
+}
+
+template <typename ValueType,
+          typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+void exclusive_scan_by_key_tile(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  RandomAccessIterator3 result,
+  Size tile_begin,
+  Size tile_end,
+  const segment_carry<ValueType>& carry,
+  const ValueType& init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  KeyType temp_key     = keys_first[tile_begin];
+  ValueType temp_value = values_first[tile_begin];
+
+  ValueType next = carry.continues_in ? carry.sum : init;
+
+  result[tile_begin] = next;
+
+  next = binary_op(next, temp_value);
+
+  for (Size i = tile_begin + 1; i < tile_end; ++i)
+  {
+    KeyType key = keys_first[i];
+
+    // use temp to permit in-place scans
+    temp_value = values_first[i];
+
+    if (!binary_pred(temp_key, key))
+    {
+      next = init; // reset sum
+    }
+
+    result[i] = next;
+    next      = binary_op(next, temp_value);
+
+    temp_key = key;
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file set_operations.h
+ *  \brief Sequential building blocks for tiled, parallel set operations.
+ *
+ *  A parallel set operation splits the merged order of its inputs into tiles
+ *  along the balanced path and proceeds in three passes:
+ *
+ *    1. every tile counts its output with \p set_operation_tile_count,
+ *    2. the counts are turned into output offsets, sequentially over the tiles,
+ *    3. every tile writes its output with \p set_operation_tile at its offset.
+ *
+ *  The operation itself is one of the \p serial_set_* function objects.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+struct serial_set_difference
+{
+  template <typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename OutputIterator,
+            typename StrictWeakOrdering>
+  OutputIterator operator()(
+    RandomAccessIterator1 first1,
+    RandomAccessIterator1 last1,
+    RandomAccessIterator2 first2,
+    RandomAccessIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_intersection
+{
+  template <typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename OutputIterator,
+            typename StrictWeakOrdering>
+  OutputIterator operator()(
+    RandomAccessIterator1 first1,
+    RandomAccessIterator1 last1,
+    RandomAccessIterator2 first2,
+    RandomAccessIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_symmetric_difference
+{
+  template <typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename OutputIterator,
+            typename StrictWeakOrdering>
+  OutputIterator operator()(
+    RandomAccessIterator1 first1,
+    RandomAccessIterator1 last1,
+    RandomAccessIterator2 first2,
+    RandomAccessIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_union
+{
+  template <typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename OutputIterator,
+            typename StrictWeakOrdering>
+  OutputIterator operator()(
+    RandomAccessIterator1 first1,
+    RandomAccessIterator1 last1,
+    RandomAccessIterator2 first2,
+    RandomAccessIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+template <typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename SetOperation,
+          typename StrictWeakOrdering>
+Size set_operation_tile_count(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size tile_begin,
+  Size tile_end,
+  SetOperation set_op,
+  StrictWeakOrdering comp)
+{
+  const thrust::pair<Size, Size> begin = balanced_path(first1, n1, first2, n2, tile_begin, comp);
+  const thrust::pair<Size, Size> end   = balanced_path(first1, n1, first2, n2, tile_end, comp);
+
+  const thrust::discard_iterator<> discard = thrust::make_discard_iterator();
+
+  return static_cast<Size>(
+    set_op(first1 + begin.first, first1 + end.first, first2 + begin.second, first2 + end.second, discard, comp)
+    - discard);
+}
+
+template <typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename SetOperation,
+          typename StrictWeakOrdering>
+void set_operation_tile(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  RandomAccessIterator3 result,
+  Size tile_begin,
+  Size tile_end,
+  Size output_offset,
+  SetOperation set_op,
+  StrictWeakOrdering comp)
+{
+  const thrust::pair<Size, Size> begin = balanced_path(first1, n1, first2, n2, tile_begin, comp);
+  const thrust::pair<Size, Size> end   = balanced_path(first1, n1, first2, n2, tile_end, comp);
+
+  set_op(first1 + begin.first,
+         first1 + end.first,
+         first2 + begin.second,
+         first2 + end.second,
+         result + output_offset,
+         comp);
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file shuffle.h
+ *  \brief Sequential building blocks for tiled, parallel shuffles.
+ *
+ *  shuffle_copy gathers the elements of an input of size m in the order of
+ *  a Feistel bijection over [0, n), where n is the power of two the
+ *  bijection rounds m up to: first[bijection(i)] is written for every i in
+ *  [0, n) whose image is below m, in increasing order of i. A parallel
+ *  shuffle_copy splits [0, n) into contiguous tiles and proceeds in three
+ *  passes:
+ *
+ *    1. every tile counts the images below m with \p shuffle_tile_count,
+ *    2. the counts of the tiles are turned into output offsets, sequentially
+ *       over the tiles,
+ *    3. every tile evaluates the bijection again and gathers its elements
+ *       with \p shuffle_tile_gather.
+ *
+ *  Only one count per tile is stored between the passes. Evaluating the
+ *  bijection twice is cheaper than writing and reading back an image for
+ *  every index of [0, n), which may be twice as large as the input.
+ *
+ *  The permutation only depends on the bijection, which is built from the
+ *  URBG before any tile runs, so the output is the same for every tiling and
+ *  the same as that of the generic shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// the number of indices a tile hands to the bijection at once
+constexpr std::uint32_t shuffle_batch_size = 16;
+
+// calls f(bijection(i)) for every i in [tile_begin, tile_end), in order
+template <typename Bijection, typename Function>
+void shuffle_tile_for_each_image(
+  const Bijection& bijection, std::uint64_t tile_begin, std::uint64_t tile_end, Function f)
+{
+  std::uint64_t i = tile_begin;
+
+  for (; tile_end - i >= shuffle_batch_size; i += shuffle_batch_size)
+  {
+    std::uint64_t images[shuffle_batch_size];
+    bijection(i, images);
+
+    for (std::uint32_t j = 0; j < shuffle_batch_size; ++j)
+    {
+      f(images[j]);
+    }
+  }
+
+  for (; i < tile_end; ++i)
+  {
+    f(bijection(i));
+  }
+}
+
+// returns the number of i in [tile_begin, tile_end) with bijection(i) < m
+template <typename Bijection>
+std::uint64_t
+shuffle_tile_count(const Bijection& bijection, std::uint64_t m, std::uint64_t tile_begin, std::uint64_t tile_end)
+{
+  std::uint64_t count = 0;
+
+  shuffle_tile_for_each_image(bijection, tile_begin, tile_end, [&](std::uint64_t key) {
+    count += key < m;
+  });
+
+  return count;
+}
+
+// writes first[bijection(i)] for every i in [tile_begin, tile_end) with bijection(i) < m to result, in order, and
+// returns the end of the output
+template <typename Bijection, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator shuffle_tile_gather(
+  const Bijection& bijection,
+  std::uint64_t m,
+  std::uint64_t tile_begin,
+  std::uint64_t tile_end,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  shuffle_tile_for_each_image(bijection, tile_begin, tile_end, [&](std::uint64_t key) {
+    if (key < m)
+    {
+      *result = first[key];
+      ++result;
+    }
+  });
+
+  return result;
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tile_offsets.h
+ *  \brief The sequential pass of tiled count-scan-scatter algorithms.
+ *
+ *  Tiled parallel algorithms of the host systems, such as the set
+ *  operations, first count the outputs of every tile, then turn the counts
+ *  into the offsets the tiles write at with \p accumulate_tile_counts, and
+ *  finally let every tile write its outputs.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// turns per-tile output counts into per-tile output offsets in place and returns the total
+template <typename Size, typename Index>
+Size accumulate_tile_counts(Size* counts, Index num_tiles)
+{
+  Size total = 0;
+
+  for (Index i = 0; i < num_tiles; ++i)
+  {
+    const Size count = counts[i];
+    counts[i]        = total;
+    total += count;
+  }
+
+  return total;
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
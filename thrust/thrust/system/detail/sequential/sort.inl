@@ -132,9 +132,11 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   thrust::system::detail::sequential::stable_merge_sort_by_key(exec, first1, last1, first2, comp);
 }
 
+// the radix sort handles keys of up to 64 bits
 template <typename KeyType, typename Compare>
 struct use_primitive_sort
     : ::cuda::std::_And<::cuda::std::is_arithmetic<KeyType>,
+                        ::cuda::std::bool_constant<sizeof(KeyType) <= 8>,
                         ::cuda::std::disjunction<::cuda::std::is_same<Compare, thrust::less<KeyType>>,
                                                  ::cuda::std::is_same<Compare, thrust::greater<KeyType>>>>
 {};
@@ -25,8 +25,10 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/copy_if.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -49,8 +51,11 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  stencil_selector<InputIterator2, Predicate> select{stencil, {pred}};
+
+  return thrust::system::omp::detail::stream_compact(exec, first, Size(thrust::distance(first, last)), result, select);
 } // end copy_if()
 
 } // namespace detail
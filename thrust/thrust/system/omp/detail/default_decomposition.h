@@ -30,6 +30,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/parallel_params.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -42,6 +43,11 @@ namespace detail
 template <typename IndexType>
 thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n);
 
+// honors the thread count, schedule and grain size requested through the modifiers of omp::par
+template <typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(const parallel_params& params, IndexType n);
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/integer_math.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 
 // don't attempt to #include this file without omp support
@@ -59,6 +60,41 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
 #endif
 }
 
+template <typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(const parallel_params& params, IndexType n)
+{
+  if (params.num_threads <= 0 && params.schedule == schedule_kind::static_ && params.grain == 0)
+  {
+    return thrust::system::omp::detail::default_decomposition(n);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const IndexType num_threads = params.num_threads > 0 ? params.num_threads : omp_get_num_procs();
+#else
+  const IndexType num_threads = 1;
+#endif
+
+  // a static schedule gives every thread one interval of at least grain elements
+  if (params.schedule == schedule_kind::static_)
+  {
+    const IndexType granularity = params.grain > 0 ? static_cast<IndexType>(params.grain) : IndexType(1);
+
+    return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, granularity, num_threads);
+  }
+
+  // the other schedules need more intervals than threads to balance anything, grain elements each or eight per
+  // thread if no grain was requested
+  const IndexType oversubscription = 8;
+  const IndexType granularity =
+    params.grain > 0
+      ? static_cast<IndexType>(params.grain)
+      : static_cast<IndexType>(thrust::detail::divide_ri(n, oversubscription * num_threads));
+
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(
+    n, granularity > 0 ? granularity : IndexType(1), n);
+}
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
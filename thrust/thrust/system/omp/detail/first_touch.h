@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file first_touch.h
+ *  \brief Writes to the pages of a new allocation from the threads that the
+ *         OpenMP algorithms will later assign them to.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstddef>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// Splits the pages like default_decomposition splits the elements of an array, so that a thread of a later
+// algorithm finds the pages of its tile on its own node.
+struct first_touch_pages
+{
+  void operator()(char* pages, std::size_t num_pages, std::size_t page_size) const
+  {
+    using index_type = std::ptrdiff_t;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    const index_type num_tiles = omp_get_num_procs();
+#else
+    const index_type num_tiles = 1;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+    thrust::system::detail::internal::uniform_decomposition<index_type> decomp(
+      static_cast<index_type>(num_pages), 1, num_tiles);
+
+    const index_type n = decomp.size();
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type i = 0; i < n; ++i)
+    {
+      for (index_type page = decomp[i].begin(); page < decomp[i].end(); ++page)
+      {
+        pages[page * static_cast<index_type>(page_size)] = 0;
+      }
+    }
+  }
+};
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -30,7 +30,7 @@
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/parallel_params.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -39,9 +39,28 @@ namespace omp
 {
 namespace detail
 {
+namespace for_each_detail
+{
+
+template <typename RandomAccessIterator, typename Function>
+struct body
+{
+  RandomAccessIterator first;
+  Function f;
+
+  template <typename Size>
+  void operator()(Size i) const
+  {
+    RandomAccessIterator temp = first + i;
+    f(*temp);
+  }
+};
+
+} // end namespace for_each_detail
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -65,12 +84,10 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   using DifferenceType    = typename thrust::iterator_difference<RandomAccessIterator>::type;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (DifferenceType i = 0; i < signed_n; ++i)
-  {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
-  }
+  for_each_detail::body<RandomAccessIterator, thrust::detail::wrapped_function<UnaryFunction, void>> body{
+    first, wrapped_f};
+
+  thrust::system::omp::detail::parallel_for(parallel_params_of(exec), signed_n, body);
 
   return first + n;
 } // end for_each_n()
@@ -0,0 +1,229 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/merge.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace merge_detail
+{
+
+// Sequentially produces the elements [tile_begin, tile_end) of the merge of
+// [first1, first1 + n1) and [first2, first2 + n2).
+template <typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename StrictWeakOrdering>
+void merge_tile(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  RandomAccessIterator3 result,
+  Size tile_begin,
+  Size tile_end,
+  StrictWeakOrdering comp)
+{
+  const Size begin1 = thrust::system::detail::internal::merge_path(first1, n1, first2, n2, tile_begin, comp);
+  const Size end1   = thrust::system::detail::internal::merge_path(first1, n1, first2, n2, tile_end, comp);
+  const Size begin2 = tile_begin - begin1;
+  const Size end2   = tile_end - end1;
+
+  thrust::merge(
+    thrust::seq, first1 + begin1, first1 + end1, first2 + begin2, first2 + end2, result + tile_begin, comp);
+}
+
+template <typename Size,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename RandomAccessIterator5,
+          typename RandomAccessIterator6,
+          typename StrictWeakOrdering>
+void merge_by_key_tile(
+  RandomAccessIterator1 keys_first1,
+  Size n1,
+  RandomAccessIterator2 keys_first2,
+  Size n2,
+  RandomAccessIterator3 values_first1,
+  RandomAccessIterator4 values_first2,
+  RandomAccessIterator5 keys_result,
+  RandomAccessIterator6 values_result,
+  Size tile_begin,
+  Size tile_end,
+  StrictWeakOrdering comp)
+{
+  const Size begin1 = thrust::system::detail::internal::merge_path(keys_first1, n1, keys_first2, n2, tile_begin, comp);
+  const Size end1   = thrust::system::detail::internal::merge_path(keys_first1, n1, keys_first2, n2, tile_end, comp);
+  const Size begin2 = tile_begin - begin1;
+  const Size end2   = tile_end - end1;
+
+  thrust::merge_by_key(
+    thrust::seq,
+    keys_first1 + begin1,
+    keys_first1 + end1,
+    keys_first2 + begin2,
+    keys_first2 + end2,
+    values_first1 + begin1,
+    values_first2 + begin2,
+    keys_result + tile_begin,
+    values_result + tile_begin,
+    comp);
+}
+
+} // end namespace merge_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator
+merge(execution_policy<DerivedPolicy>&,
+      InputIterator1 first1,
+      InputIterator1 last1,
+      InputIterator2 first2,
+      InputIterator2 last2,
+      OutputIterator result,
+      StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const Size n1 = last1 - first1;
+  const Size n2 = static_cast<Size>(last2 - first2);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(n1 + n2);
+
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  // every tile of the output merges its own slice of the inputs
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    merge_detail::merge_tile(first1, n1, first2, n2, result, decomp[i].begin(), decomp[i].end(), comp);
+  }
+
+  return result + (n1 + n2);
+} // end merge()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  execution_policy<DerivedPolicy>&,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first1,
+  InputIterator4 values_first2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const Size n1 = keys_last1 - keys_first1;
+  const Size n2 = static_cast<Size>(keys_last2 - keys_first2);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(n1 + n2);
+
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  // every tile of the output merges its own slice of the inputs
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    merge_detail::merge_by_key_tile(
+      keys_first1,
+      n1,
+      keys_first2,
+      n2,
+      values_first1,
+      values_first2,
+      keys_result,
+      values_result,
+      decomp[i].begin(),
+      decomp[i].end(),
+      comp);
+  }
+
+  return thrust::make_pair(keys_result + (n1 + n2), values_result + (n1 + n2));
+} // end merge_by_key()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
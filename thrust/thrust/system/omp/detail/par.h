@@ -27,6 +27,9 @@
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_params.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,13 +39,73 @@ namespace omp
 namespace detail
 {
 
+template <typename Derived>
+struct execute_with_params_base : thrust::system::omp::detail::execution_policy<Derived>
+{
+private:
+  parallel_params params;
+
+public:
+  _CCCL_HOST_DEVICE constexpr execute_with_params_base()
+      : thrust::system::omp::detail::execution_policy<Derived>()
+      , params()
+  {}
+
+  // runs the parallel loops on teams of num_threads threads instead of omp_get_max_threads()
+  Derived on(int num_threads) const
+  {
+    Derived result            = thrust::detail::derived_cast(*this);
+    result.params.num_threads = num_threads;
+    return result;
+  }
+
+  // the number of iterations handed out at once, which is also the smallest tile of the tiled algorithms
+  Derived grain(std::size_t grain_size) const
+  {
+    Derived result      = thrust::detail::derived_cast(*this);
+    result.params.grain = grain_size;
+    return result;
+  }
+
+  Derived schedule(schedule_kind kind) const
+  {
+    Derived result         = thrust::detail::derived_cast(*this);
+    result.params.schedule = kind;
+    return result;
+  }
+
+private:
+  friend parallel_params get_parallel_params(const execute_with_params_base& exec)
+  {
+    return exec.params;
+  }
+};
+
+struct execute_with_params : execute_with_params_base<execute_with_params>
+{};
+
 struct par_t
     : thrust::system::omp::detail::execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<thrust::system::omp::detail::execution_policy>
+    , thrust::detail::allocator_aware_execution_policy<execute_with_params_base>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::omp::detail::execution_policy<par_t>()
   {}
+
+  execute_with_params on(int num_threads) const
+  {
+    return execute_with_params().on(num_threads);
+  }
+
+  execute_with_params grain(std::size_t grain_size) const
+  {
+    return execute_with_params().grain(grain_size);
+  }
+
+  execute_with_params schedule(schedule_kind kind) const
+  {
+    return execute_with_params().schedule(kind);
+  }
 };
 
 } // namespace detail
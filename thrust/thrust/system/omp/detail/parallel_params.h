@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_params.h
+ *  \brief Team size, schedule and grain size of the parallel loops of the
+ *         OpenMP backend, as requested through the modifiers of \p omp::par.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <climits>
+#include <cstddef>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+
+/*! \p schedule_kind selects how the iterations of the parallel loops of the
+ *  OpenMP backend are handed out to the threads of a team. The kinds have the
+ *  meaning of the corresponding arguments of the OpenMP \c schedule clause.
+ */
+enum class schedule_kind
+{
+  /*! Every thread receives its blocks up front. This is the default. */
+  static_,
+
+  /*! Idle threads grab the next chunk of iterations, which balances loops
+   *  whose iterations have different costs.
+   */
+  dynamic,
+
+  /*! Like \p dynamic, with chunks that shrink as the loop drains. */
+  guided
+};
+
+namespace detail
+{
+
+struct parallel_params
+{
+  // 0 runs the loops on as many threads as omp_get_max_threads() reports
+  int num_threads;
+
+  // 0 lets every algorithm pick its own chunk size
+  std::size_t grain;
+
+  schedule_kind schedule;
+
+  _CCCL_HOST_DEVICE constexpr parallel_params()
+      : num_threads(0)
+      , grain(0)
+      , schedule(schedule_kind::static_)
+  {}
+};
+
+// policies that were not tuned through the modifiers of omp::par run with the defaults
+template <typename DerivedPolicy>
+parallel_params get_parallel_params(execution_policy<DerivedPolicy>&)
+{
+  return parallel_params();
+}
+
+template <typename DerivedPolicy>
+parallel_params parallel_params_of(execution_policy<DerivedPolicy>& exec)
+{
+  return get_parallel_params(thrust::detail::derived_cast(exec));
+}
+
+// the number of threads of the teams that run the parallel loops
+inline int team_size(const parallel_params& params)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  return params.num_threads > 0 ? params.num_threads : omp_get_max_threads();
+#else
+  THRUST_UNUSED_VAR(params);
+  return 1;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+// Calls f(i) for every i in [0, n) on a team of team_size(params) threads. Without a requested schedule or grain
+// size the iterations are split into one contiguous block per thread, otherwise grain is the chunk size that the
+// requested schedule hands out, with the OpenMP default chunk size if grain is 0.
+template <typename Size, typename Function>
+void parallel_for(const parallel_params& params, Size n, Function f)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<Size, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int num_threads = team_size(params);
+
+  if (params.schedule == schedule_kind::static_ && params.grain == 0)
+  {
+    THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
+    for (Size i = 0; i < n; ++i)
+    {
+      f(i);
+    }
+
+    return;
+  }
+
+  const omp_sched_t kind = params.schedule == schedule_kind::dynamic ? omp_sched_dynamic
+                         : params.schedule == schedule_kind::guided  ? omp_sched_guided
+                                                                     : omp_sched_static;
+  const int chunk        = params.grain < static_cast<std::size_t>(INT_MAX) ? static_cast<int>(params.grain) : INT_MAX;
+
+  // schedule(runtime) reads the schedule of the calling task, so swap in the requested one for the duration of the
+  // loop
+  omp_sched_t saved_kind;
+  int saved_chunk;
+  omp_get_schedule(&saved_kind, &saved_chunk);
+  omp_set_schedule(kind, chunk);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(runtime))
+  for (Size i = 0; i < n; ++i)
+  {
+    f(i);
+  }
+
+  omp_set_schedule(saved_kind, saved_chunk);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+
+// alias schedule_kind here
+namespace omp
+{
+
+using thrust::system::omp::schedule_kind;
+
+} // end namespace omp
+THRUST_NAMESPACE_END
@@ -29,9 +29,22 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/partition.h>
+#include <thrust/copy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/internal/partition.h>
+#include <thrust/system/detail/internal/tile_offsets.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_params.h>
 #include <thrust/system/omp/detail/partition.h>
 
+#include <cstdint>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -39,13 +52,233 @@ namespace omp
 {
 namespace detail
 {
+namespace partition_detail
+{
+
+template <typename InputIterator, typename Predicate, typename Size, typename Decomposition>
+struct count_body
+{
+  InputIterator stencil;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+  unsigned char* flags;
+  Size* counts;
+  Decomposition decomp;
+
+  template <typename Index>
+  void operator()(Index i) const
+  {
+    counts[i] = thrust::system::detail::internal::stable_partition_tile_count(
+      stencil, decomp[i].begin(), decomp[i].end(), flags, pred);
+  }
+};
+
+template <typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Write,
+          typename Size,
+          typename Decomposition>
+struct scatter_body
+{
+  InputIterator first;
+  const unsigned char* flags;
+  OutputIterator1 out_true;
+  OutputIterator2 out_false;
+  Write write;
+  const Size* offsets;
+  Decomposition decomp;
+
+  template <typename Index>
+  void operator()(Index i) const
+  {
+    const Size tile_begin = decomp[i].begin();
+
+    thrust::system::detail::internal::stable_partition_tile(
+      first,
+      flags,
+      tile_begin,
+      decomp[i].end(),
+      out_true + offsets[i],
+      out_false + (tile_begin - offsets[i]),
+      thrust::system::detail::internal::partition_flag(),
+      write);
+  }
+};
+
+// the decomposition of n elements into tiles and the offsets of the tiles in the true output
+template <typename DerivedPolicy, typename Size>
+struct tiling
+{
+  using decomposition_type = thrust::system::detail::internal::uniform_decomposition<Size>;
+
+  parallel_params params;
+  decomposition_type decomp;
+  // the offsets of the tiles, followed by the answer of the predicate for every element, which count() records and
+  // scatter() reads back
+  thrust::detail::temporary_array<unsigned char, DerivedPolicy> storage;
+
+  tiling(execution_policy<DerivedPolicy>& exec, Size n)
+      : params(parallel_params_of(exec))
+      , decomp(thrust::system::omp::detail::default_decomposition(params, n))
+      , storage(0, exec, decomp.size() * sizeof(Size) + n)
+  {
+    // the grain size of the policy is already reflected in the size of the tiles, so they are handed out one at a
+    // time
+    params.grain = 0;
+  }
+
+  std::intptr_t num_tiles() const
+  {
+    return static_cast<std::intptr_t>(decomp.size());
+  }
+
+  Size* offsets_ptr()
+  {
+    return reinterpret_cast<Size*>(thrust::raw_pointer_cast(storage.data()));
+  }
+
+  unsigned char* flags_ptr()
+  {
+    return thrust::raw_pointer_cast(storage.data()) + decomp.size() * sizeof(Size);
+  }
+
+  // counts the true elements of every tile and returns their total
+  template <typename InputIterator, typename Predicate>
+  Size count(InputIterator stencil, Predicate pred)
+  {
+    count_body<InputIterator, Predicate, Size, decomposition_type> body{
+      stencil, {pred}, flags_ptr(), offsets_ptr(), decomp};
+    thrust::system::omp::detail::parallel_for(params, num_tiles(), body);
+
+    return thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr(), num_tiles());
+  }
+
+  // writes every tile at its offsets, after count()
+  template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename Write>
+  void scatter(InputIterator first, OutputIterator1 out_true, OutputIterator2 out_false, Write write)
+  {
+    using body_type = scatter_body<InputIterator, OutputIterator1, OutputIterator2, Write, Size, decomposition_type>;
+
+    body_type body{first, flags_ptr(), out_true, out_false, write, offsets_ptr(), decomp};
+    thrust::system::omp::detail::parallel_for(params, num_tiles(), body);
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate>
+thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator1 out_true,
+  OutputIterator2 out_false,
+  Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const Size n = thrust::distance(first, last);
+
+  // a single tile gains nothing from the counting pass
+  if (thrust::system::omp::detail::default_decomposition(parallel_params_of(exec), n).size() <= 1)
+  {
+    thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+    const Size num_true = thrust::system::detail::internal::stable_partition_tile(
+      first,
+      stencil,
+      Size(0),
+      n,
+      out_true,
+      out_false,
+      wrapped_pred,
+      thrust::system::detail::internal::partition_assign());
+
+    return thrust::make_pair(out_true + num_true, out_false + (n - num_true));
+  }
+
+  tiling<DerivedPolicy, Size> tiles(exec, n);
+
+  const Size num_true = tiles.count(stencil, pred);
+
+  tiles.scatter(first, out_true, out_false, thrust::system::detail::internal::partition_assign());
+
+  return thrust::make_pair(out_true + num_true, out_false + (n - num_true));
+}
+
+// Partitions into a buffer, the false elements right after the true ones, and copies it back. Besides the flags of one
+// byte per element, the buffer is the only temporary of the size of the input, and every element of it is copy
+// constructed by exactly one tile. It's allocated apart from the offsets and flags, only once their counts show that
+// some elements move.
+template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
+ForwardIterator stable_partition(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator stencil,
+  Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<ForwardIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size      = typename thrust::iterator_difference<ForwardIterator>::type;
+  using ValueType = typename thrust::iterator_value<ForwardIterator>::type;
+
+  const Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  tiling<DerivedPolicy, Size> tiles(exec, n);
+
+  const Size num_true = tiles.count(stencil, pred);
+
+  // nothing moves
+  if (num_true == 0 || num_true == n)
+  {
+    return first + num_true;
+  }
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> buffer(0, exec, n);
+  ValueType* buffer_ptr = thrust::raw_pointer_cast(buffer.data());
+
+  tiles.scatter(first, buffer_ptr, buffer_ptr + num_true, thrust::system::detail::internal::partition_construct());
+
+  thrust::copy(exec, buffer.begin(), buffer.end(), first);
+
+  return first + num_true;
+}
+
+} // end namespace partition_detail
 
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  return partition_detail::stable_partition(exec, first, last, first, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -56,8 +289,7 @@ ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  return partition_detail::stable_partition(exec, first, last, stencil, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy,
@@ -73,8 +305,7 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  return partition_detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
@@ -92,8 +323,7 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return partition_detail::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 } // end namespace detail
@@ -25,9 +25,23 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/reduce.h>
+#include <thrust/system/detail/internal/tile_offsets.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_params.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
+
+#include <cstdint>
+#include <new>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,7 +50,102 @@ namespace omp
 {
 namespace detail
 {
+namespace reduce_by_key_detail
+{
+
+// Reduces the segments of tile i. The segments which start in the tile are written from the offset of the tile on,
+// except for the value of the last one, which may continue into the next tiles and goes to tails[i] instead. The
+// elements in front of the first segment of the tile continue a segment of an earlier tile, their reduction goes to
+// prefixes[i]. Both slots are constructed by every tile, with a copy of the first value of the tile where the tile
+// has nothing to hold in them.
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryFunction,
+          typename ValueType,
+          typename Size,
+          typename Decomposition>
+struct reduce_body
+{
+  InputIterator1 keys_first;
+  InputIterator2 values_first;
+  OutputIterator1 keys_output;
+  OutputIterator2 values_output;
+  // whether a segment starts at every element, as recorded by the counting pass
+  const unsigned char* heads;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+  const Size* offsets;
+  ValueType* prefixes;
+  ValueType* tails;
+  Decomposition decomp;
+
+  template <typename Index>
+  void operator()(Index i) const
+  {
+    const Size tile_begin = decomp[i].begin();
+    const Size tile_end   = decomp[i].end();
+
+    Size out           = offsets[i];
+    Size segment_begin = tile_begin;
+    bool in_prefix     = !heads[tile_begin];
+
+    ValueType partial = values_first[tile_begin];
 
+    for (Size j = tile_begin + 1; j < tile_end; ++j)
+    {
+      if (!heads[j])
+      {
+        partial = binary_op(partial, values_first[j]);
+        continue;
+      }
+
+      if (in_prefix)
+      {
+        ::new (static_cast<void*>(prefixes + i)) ValueType(partial);
+        in_prefix = false;
+      }
+      else
+      {
+        keys_output[out]   = keys_first[segment_begin];
+        values_output[out] = partial;
+        ++out;
+      }
+
+      segment_begin = j;
+      partial       = values_first[j];
+    }
+
+    if (in_prefix)
+    {
+      // no segment starts in this tile
+      ::new (static_cast<void*>(prefixes + i)) ValueType(partial);
+      ::new (static_cast<void*>(tails + i)) ValueType(values_first[tile_begin]);
+      return;
+    }
+
+    if (heads[tile_begin])
+    {
+      ::new (static_cast<void*>(prefixes + i)) ValueType(values_first[tile_begin]);
+    }
+
+    keys_output[out] = keys_first[segment_begin];
+    ::new (static_cast<void*>(tails + i)) ValueType(partial);
+  }
+};
+
+} // end namespace reduce_by_key_detail
+
+// Reduces the tiles of the default decomposition in three passes:
+//
+//   1. every tile counts the segments which start in it in parallel,
+//   2. the counts are scanned sequentially into per-tile output offsets,
+//   3. every tile reduces its segments in parallel, and writes all of them but the value of its last one, which may
+//      continue into the next tiles.
+//
+// A sequential fix-up over the tiles then folds the reduction of the elements in front of the first segment of every
+// tile into the open segment of the tiles before it, and writes the values of the last segments. Every output is
+// written exactly once, binary_op is applied in the order of the input and only needs to be associative.
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -54,9 +163,112 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size               = typename thrust::iterator_difference<InputIterator1>::type;
+  using decomposition_type = thrust::system::detail::internal::uniform_decomposition<Size>;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator2>::type;
+
+  const Size n = thrust::distance(keys_first, keys_last);
+
+  const parallel_params params = parallel_params_of(exec);
+
+  const decomposition_type decomp = thrust::system::omp::detail::default_decomposition(params, n);
+
+  const std::intptr_t num_tiles = static_cast<std::intptr_t>(decomp.size());
+
+  // a single tile gains nothing from the counting pass
+  if (num_tiles <= 1)
+  {
+    return thrust::reduce_by_key(
+      thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(0, exec, num_tiles);
+  Size* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  // the grain size of the policy is already reflected in the size of the tiles, so they are handed out one at a time
+  parallel_params tile_params = params;
+  tile_params.grain           = 0;
+
+  using selector_type = unique_selector<InputIterator1, BinaryPredicate>;
+  const selector_type is_head{keys_first, {binary_pred}};
+
+  thrust::detail::temporary_array<unsigned char, DerivedPolicy> heads(0, exec, n);
+  unsigned char* heads_ptr = thrust::raw_pointer_cast(heads.data());
+
+  stream_compaction_detail::count_body<selector_type, Size, decomposition_type> count{
+    is_head, heads_ptr, offsets_ptr, decomp};
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, count);
+
+  const Size num_segments = thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr, num_tiles);
+
+  // every slot is copy constructed by its tile
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> prefixes(0, exec, num_tiles);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> tails(0, exec, num_tiles);
+  ValueType* prefixes_ptr = thrust::raw_pointer_cast(prefixes.data());
+  ValueType* tails_ptr    = thrust::raw_pointer_cast(tails.data());
+
+  reduce_by_key_detail::reduce_body<InputIterator1,
+                                    InputIterator2,
+                                    OutputIterator1,
+                                    OutputIterator2,
+                                    BinaryFunction,
+                                    ValueType,
+                                    Size,
+                                    decomposition_type>
+    reduce{keys_first,
+           values_first,
+           keys_output,
+           values_output,
+           heads_ptr,
+           {binary_op},
+           offsets_ptr,
+           prefixes_ptr,
+           tails_ptr,
+           decomp};
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, reduce);
+
+  // the first tile starts a segment, so there is an open segment from then on
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  ValueType* open  = nullptr;
+  Size open_output = 0;
+
+  for (std::intptr_t i = 0; i < num_tiles; ++i)
+  {
+    if (!heads_ptr[decomp[i].begin()])
+    {
+      *open = wrapped_binary_op(*open, prefixes_ptr[i]);
+    }
+
+    const Size next_offset = i + 1 < num_tiles ? offsets_ptr[i + 1] : num_segments;
+
+    if (next_offset > offsets_ptr[i])
+    {
+      if (open != nullptr)
+      {
+        values_output[open_output] = *open;
+      }
+
+      open        = tails_ptr + i;
+      open_output = next_offset - 1;
+    }
+  }
+
+  values_output[open_output] = *open;
+
+  return thrust::make_pair(keys_output + num_segments, values_output + num_segments);
 } // end reduce_by_key()
 
 } // namespace detail
@@ -28,7 +28,7 @@
 #include <thrust/detail/function.h>
 #include <thrust/detail/static_assert.h> // for depend_on_instantiation
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/parallel_params.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 
 #include <cstdint>
@@ -41,13 +41,52 @@ namespace omp
 namespace detail
 {
 
+namespace reduce_intervals_detail
+{
+
+template <typename InputIterator, typename OutputIterator, typename BinaryFunction, typename Decomposition>
+struct body
+{
+  using OutputType = typename thrust::iterator_value<OutputIterator>::type;
+
+  InputIterator input;
+  OutputIterator output;
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> binary_op;
+  Decomposition decomp;
+
+  template <typename Size>
+  void operator()(Size i) const
+  {
+    InputIterator begin = input + decomp[i].begin();
+    InputIterator end   = input + decomp[i].end();
+
+    if (begin != end)
+    {
+      OutputType sum = thrust::raw_reference_cast(*begin);
+
+      ++begin;
+
+      while (begin != end)
+      {
+        sum = binary_op(sum, *begin);
+        ++begin;
+      }
+
+      OutputIterator tmp = output + i;
+      *tmp               = sum;
+    }
+  }
+};
+
+} // end namespace reduce_intervals_detail
+
 template <typename DerivedPolicy,
           typename InputIterator,
           typename OutputIterator,
           typename BinaryFunction,
           typename Decomposition>
 void reduce_intervals(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator input,
   OutputIterator output,
   BinaryFunction binary_op,
@@ -73,28 +112,15 @@ void reduce_intervals(
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (index_type i = 0; i < n; i++)
-  {
-    InputIterator begin = input + decomp[i].begin();
-    InputIterator end   = input + decomp[i].end();
-
-    if (begin != end)
-    {
-      OutputType sum = thrust::raw_reference_cast(*begin);
-
-      ++begin;
+  // the grain size of the policy counts elements and is already reflected in the size of the intervals, so the
+  // intervals are handed out one at a time
+  parallel_params params = parallel_params_of(exec);
+  params.grain           = 0;
 
-      while (begin != end)
-      {
-        sum = wrapped_binary_op(sum, *begin);
-        ++begin;
-      }
+  reduce_intervals_detail::body<InputIterator, OutputIterator, BinaryFunction, Decomposition> body{
+    input, output, wrapped_binary_op, decomp};
 
-      OutputIterator tmp = output + i;
-      *tmp               = sum;
-    }
-  }
+  thrust::system::omp::detail::parallel_for(params, n, body);
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -25,8 +25,11 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/remove.h>
 #include <thrust/system/omp/detail/remove.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -40,8 +43,11 @@ template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 remove_if(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  stencil_selector<ForwardIterator, Predicate, true> select{first, {pred}};
+
+  return thrust::system::omp::detail::stream_compact_in_place(exec, first, Size(thrust::distance(first, last)), select);
 }
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -52,8 +58,11 @@ ForwardIterator remove_if(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  stencil_selector<InputIterator, Predicate, true> select{stencil, {pred}};
+
+  return thrust::system::omp::detail::stream_compact_in_place(exec, first, Size(thrust::distance(first, last)), select);
 }
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
@@ -0,0 +1,288 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_params.h>
+#include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/scan.h>
+
+#include <cuda/std/__functional/invoke.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+// scans tile i of the decomposition, seeded with its carry
+template <bool Inclusive,
+          bool HasInit,
+          typename ValueType,
+          typename InputIterator,
+          typename OutputIterator,
+          typename CarryIterator,
+          typename BinaryFunction,
+          typename Decomposition>
+struct scan_tile_body
+{
+  InputIterator first;
+  OutputIterator result;
+  CarryIterator carries;
+  BinaryFunction binary_op;
+  Decomposition decomp;
+
+  template <typename Size>
+  void operator()(Size i) const
+  {
+    InputIterator tile_first   = first + decomp[i].begin();
+    InputIterator tile_last    = first + decomp[i].end();
+    OutputIterator tile_result = result + decomp[i].begin();
+
+    _CCCL_IF_CONSTEXPR (!Inclusive)
+    {
+      const ValueType carry = carries[i];
+      thrust::exclusive_scan(thrust::seq, tile_first, tile_last, tile_result, carry, binary_op);
+    }
+    else
+    {
+      if (!HasInit && i == 0)
+      {
+        thrust::inclusive_scan(thrust::seq, tile_first, tile_last, tile_result, binary_op);
+      }
+      else
+      {
+        const ValueType carry = carries[i];
+        thrust::inclusive_scan(thrust::seq, tile_first, tile_last, tile_result, carry, binary_op);
+      }
+    }
+  }
+};
+
+// Reduce-then-scan over the tiles of the default decomposition:
+//
+//   1. every tile is reduced in parallel to a single partial sum,
+//   2. the partial sums are scanned sequentially into per-tile carries,
+//   3. every tile is scanned in parallel, seeded with its carry.
+//
+// When HasInit is false the first tile is scanned without a seed, which
+// matches the semantics of the init-less inclusive_scan.
+template <bool Inclusive,
+          bool HasInit,
+          typename ValueType,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+OutputIterator reduce_then_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const ValueType* init,
+  BinaryFunction binary_op)
+{
+  using Size = typename thrust::iterator_difference<InputIterator>::type;
+
+  const Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  const parallel_params params = parallel_params_of(exec);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(params, n);
+
+  // a single tile gains nothing from the extra reduction pass
+  if (decomp.size() == 1)
+  {
+    _CCCL_IF_CONSTEXPR (!Inclusive)
+    {
+      return thrust::exclusive_scan(thrust::seq, first, last, result, *init, binary_op);
+    }
+    else _CCCL_IF_CONSTEXPR (HasInit)
+    {
+      return thrust::inclusive_scan(thrust::seq, first, last, result, *init, binary_op);
+    }
+    else
+    {
+      return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+    }
+  }
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+
+  // reduce each tile to a partial sum (first pass)
+  thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin(), binary_op, decomp);
+
+  // turn the partial sums into an exclusive scan of carries, seeded with init if there is one
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  {
+    index_type i = HasInit ? 0 : 1;
+
+    ValueType carry = HasInit ? *init : static_cast<ValueType>(carries[0]);
+
+    for (; i < num_tiles; ++i)
+    {
+      ValueType partial = carries[i];
+      carries[i]        = carry;
+      carry             = wrapped_binary_op(carry, partial);
+    }
+  }
+
+  // scan each tile seeded with its carry (second pass), the tiles are handed out one at a time
+  parallel_params tile_params = params;
+  tile_params.grain           = 0;
+
+  scan_tile_body<Inclusive,
+                 HasInit,
+                 ValueType,
+                 InputIterator,
+                 OutputIterator,
+                 typename thrust::detail::temporary_array<ValueType, DerivedPolicy>::iterator,
+                 BinaryFunction,
+                 thrust::system::detail::internal::uniform_decomposition<Size>>
+    body{first, result, carries.begin(), binary_op, decomp};
+
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, body);
+
+  return result + n;
+}
+
+} // end namespace scan_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator>::type;
+
+  return scan_detail::reduce_then_scan<true, false, ValueType>(
+    exec, first, last, result, static_cast<const ValueType*>(nullptr), binary_op);
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type and the initial value type per wg21.link/p2322
+  using ValueType = typename ::cuda::std::
+    __accumulator_t<BinaryFunction, typename ::cuda::std::iterator_traits<InputIterator>::value_type, InitialValueType>;
+
+  const ValueType seed = init;
+
+  return scan_detail::reduce_then_scan<true, true, ValueType>(exec, first, last, result, &seed, binary_op);
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator exclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = InitialValueType;
+
+  return scan_detail::reduce_then_scan<false, true, ValueType>(exec, first, last, result, &init, binary_op);
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
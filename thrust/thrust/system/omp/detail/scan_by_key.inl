@@ -0,0 +1,191 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/internal/segmented_scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/scan_by_key.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size      = typename thrust::iterator_difference<InputIterator1>::type;
+  using ValueType = typename thrust::iterator_value<InputIterator2>::type;
+  using carry_t   = thrust::system::detail::internal::segment_carry<ValueType>;
+
+  const Size n = last1 - first1;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  // a single tile gains nothing from the extra pass
+  if (decomp.size() <= 1)
+  {
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<carry_t, DerivedPolicy> carries(exec, num_tiles);
+  carry_t* carries_ptr = thrust::raw_pointer_cast(carries.data());
+
+  // reduce the last segment of every tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    carries_ptr[i] = thrust::system::detail::internal::reduce_last_segment<ValueType>(
+      first1, first2, decomp[i].begin(), decomp[i].end(), binary_pred, binary_op);
+  }
+
+  // propagate the partial sums of segments spanning tile boundaries
+  thrust::system::detail::internal::accumulate_segment_carries(carries_ptr, num_tiles, binary_op);
+
+  // scan every tile seeded with its carry
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::inclusive_scan_by_key_tile(
+      first1, first2, result, decomp[i].begin(), decomp[i].end(), carries_ptr[i], binary_pred, binary_op);
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size      = typename thrust::iterator_difference<InputIterator1>::type;
+  using ValueType = T;
+  using carry_t   = thrust::system::detail::internal::segment_carry<ValueType>;
+
+  const Size n = last1 - first1;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  // a single tile gains nothing from the extra pass
+  if (decomp.size() <= 1)
+  {
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<carry_t, DerivedPolicy> carries(exec, num_tiles);
+  carry_t* carries_ptr = thrust::raw_pointer_cast(carries.data());
+
+  // reduce the last segment of every tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    carries_ptr[i] = thrust::system::detail::internal::reduce_last_segment<ValueType>(
+      first1, first2, decomp[i].begin(), decomp[i].end(), binary_pred, binary_op);
+  }
+
+  // propagate the partial sums of segments spanning tile boundaries
+  thrust::system::detail::internal::accumulate_segment_carries(carries_ptr, num_tiles, init, binary_op);
+
+  // scan every tile seeded with its carry
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::exclusive_scan_by_key_tile(
+      first1, first2, result, decomp[i].begin(), decomp[i].end(), carries_ptr[i], init, binary_pred, binary_op);
+  }
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
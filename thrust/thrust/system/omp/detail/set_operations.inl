@@ -0,0 +1,201 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/system/detail/internal/tile_offsets.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/set_operations.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const Size n1 = last1 - first1;
+  const Size n2 = static_cast<Size>(last2 - first2);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(n1 + n2);
+
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  if (num_tiles <= 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_tiles);
+  Size* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  // count the output of every tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    offsets_ptr[i] = thrust::system::detail::internal::set_operation_tile_count(
+      first1, n1, first2, n2, decomp[i].begin(), decomp[i].end(), set_op, comp);
+  }
+
+  const Size num_outputs =
+    thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr, num_tiles);
+
+  // every tile writes its output at its offset
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::set_operation_tile(
+      first1, n1, first2, n2, result, decomp[i].begin(), decomp[i].end(), offsets_ptr[i], set_op, comp);
+  }
+
+  return result + num_outputs;
+}
+
+} // end namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference());
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection());
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::serial_set_symmetric_difference());
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union());
+} // end set_union()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
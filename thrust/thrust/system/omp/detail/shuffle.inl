@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/detail/internal/tile_offsets.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_params.h>
+#include <thrust/system/omp/detail/shuffle.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace shuffle_detail
+{
+
+using bijection_type = thrust::system::detail::generic::feistel_bijection;
+
+// counts the images below m of the indices of tile i
+template <typename Decomposition>
+struct count_body
+{
+  bijection_type bijection;
+  std::uint64_t m;
+  std::uint64_t* counts;
+  Decomposition decomp;
+
+  template <typename Index>
+  void operator()(Index i) const
+  {
+    counts[i] =
+      thrust::system::detail::internal::shuffle_tile_count(bijection, m, decomp[i].begin(), decomp[i].end());
+  }
+};
+
+// gathers the elements of tile i to its offset in the output
+template <typename RandomIterator, typename OutputIterator, typename Decomposition>
+struct gather_body
+{
+  bijection_type bijection;
+  std::uint64_t m;
+  RandomIterator first;
+  OutputIterator result;
+  const std::uint64_t* offsets;
+  Decomposition decomp;
+
+  template <typename Index>
+  void operator()(Index i) const
+  {
+    thrust::system::detail::internal::shuffle_tile_gather(
+      bijection, m, decomp[i].begin(), decomp[i].end(), first, result + offsets[i]);
+  }
+};
+
+} // end namespace shuffle_detail
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using decomposition_type = thrust::system::detail::internal::uniform_decomposition<std::uint64_t>;
+
+  // the bijection draws from g exactly as the generic shuffle_copy does, so both permute alike
+  const std::uint64_t m = thrust::distance(first, last);
+  const shuffle_detail::bijection_type bijection(m, g);
+  const std::uint64_t n = bijection.nearest_power_of_two();
+
+  const parallel_params params = parallel_params_of(exec);
+
+  const decomposition_type decomp = thrust::system::omp::detail::default_decomposition(params, n);
+
+  const std::intptr_t num_tiles = static_cast<std::intptr_t>(decomp.size());
+
+  // a single tile gains nothing from counting its outputs first
+  if (num_tiles <= 1)
+  {
+    thrust::system::detail::internal::shuffle_tile_gather(bijection, m, 0, n, first, result);
+    return;
+  }
+
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> offsets(0, exec, num_tiles);
+  std::uint64_t* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  // the grain size of the policy is already reflected in the size of the tiles, so they are handed out one at a time
+  parallel_params tile_params = params;
+  tile_params.grain           = 0;
+
+  shuffle_detail::count_body<decomposition_type> count_pass{bijection, m, offsets_ptr, decomp};
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, count_pass);
+
+  thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr, num_tiles);
+
+  shuffle_detail::gather_body<RandomIterator, OutputIterator, decomposition_type> gather_pass{
+    bijection, m, first, result, offsets_ptr, decomp};
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, gather_pass);
+} // end shuffle_copy()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
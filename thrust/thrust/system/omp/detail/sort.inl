@@ -31,13 +31,17 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
-#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/parallel_params.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -49,46 +53,436 @@ namespace detail
 namespace sort_detail
 {
 
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+template <typename L, typename R>
+inline L divide_ri(const L x, const R y)
+{
+  return (x + (y - 1)) / y;
+}
+
+// the grain size of the policy bounds the size of the tiles from below
+template <typename DerivedPolicy, typename IndexType>
+IndexType tile_granularity(execution_policy<DerivedPolicy>& exec, IndexType default_granularity)
+{
+  const parallel_params params = parallel_params_of(exec);
+
+  return params.grain > 0 ? static_cast<IndexType>(params.grain) : default_granularity;
+}
+
+// returns the offset of the first element of the given tile, or the size of
+// the decomposed range if the tile lies past the end
+template <typename Decomposition, typename IndexType>
+IndexType tile_begin(const Decomposition& decomp, IndexType tile)
+{
+  return tile < decomp.size() ? decomp[tile].begin() : decomp[decomp.size() - 1].end();
+}
+
+// Merges every pair of adjacent runs of tiles_per_run sorted tiles from src
+// into dst. The output of each pair is split into chunks with merge path so
+// that the last levels of the merge tree still keep every thread busy.
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename IndexType,
+          typename StrictWeakOrdering>
+void merge_adjacent_runs(
+  RandomAccessIterator1 src,
+  RandomAccessIterator2 dst,
+  const thrust::system::detail::internal::uniform_decomposition<IndexType>& decomp,
+  IndexType tiles_per_run,
+  IndexType num_threads,
+  StrictWeakOrdering comp)
+{
+  const IndexType num_pairs       = divide_ri(decomp.size(), 2 * tiles_per_run);
+  const IndexType chunks_per_pair = divide_ri(num_threads, num_pairs);
+  const IndexType num_tasks       = num_pairs * chunks_per_pair;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
+  for (IndexType task = 0; task < num_tasks; ++task)
+  {
+    const IndexType pair  = task / chunks_per_pair;
+    const IndexType chunk = task % chunks_per_pair;
+
+    const IndexType begin  = tile_begin(decomp, 2 * pair * tiles_per_run);
+    const IndexType middle = tile_begin(decomp, (2 * pair + 1) * tiles_per_run);
+    const IndexType end    = tile_begin(decomp, (2 * pair + 2) * tiles_per_run);
+
+    thrust::system::detail::internal::uniform_decomposition<IndexType> chunks(end - begin, 1, chunks_per_pair);
+
+    if (chunk < chunks.size())
+    {
+      merge_detail::merge_tile(
+        src + begin,
+        middle - begin,
+        src + middle,
+        end - middle,
+        dst + begin,
+        chunks[chunk].begin(),
+        chunks[chunk].end(),
+        comp);
+    }
+  }
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename IndexType,
+          typename StrictWeakOrdering>
+void merge_adjacent_runs_by_key(
+  RandomAccessIterator1 keys_src,
+  RandomAccessIterator2 values_src,
+  RandomAccessIterator3 keys_dst,
+  RandomAccessIterator4 values_dst,
+  const thrust::system::detail::internal::uniform_decomposition<IndexType>& decomp,
+  IndexType tiles_per_run,
+  IndexType num_threads,
+  StrictWeakOrdering comp)
+{
+  const IndexType num_pairs       = divide_ri(decomp.size(), 2 * tiles_per_run);
+  const IndexType chunks_per_pair = divide_ri(num_threads, num_pairs);
+  const IndexType num_tasks       = num_pairs * chunks_per_pair;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
+  for (IndexType task = 0; task < num_tasks; ++task)
+  {
+    const IndexType pair  = task / chunks_per_pair;
+    const IndexType chunk = task % chunks_per_pair;
+
+    const IndexType begin  = tile_begin(decomp, 2 * pair * tiles_per_run);
+    const IndexType middle = tile_begin(decomp, (2 * pair + 1) * tiles_per_run);
+    const IndexType end    = tile_begin(decomp, (2 * pair + 2) * tiles_per_run);
+
+    thrust::system::detail::internal::uniform_decomposition<IndexType> chunks(end - begin, 1, chunks_per_pair);
+
+    if (chunk < chunks.size())
+    {
+      merge_detail::merge_by_key_tile(
+        keys_src + begin,
+        middle - begin,
+        keys_src + middle,
+        end - middle,
+        values_src + begin,
+        values_src + middle,
+        keys_dst + begin,
+        values_dst + begin,
+        chunks[chunk].begin(),
+        chunks[chunk].end(),
+        comp);
+    }
+  }
+}
+
+// sorts a tile per thread, then merges the sorted tiles pairwise, ping-ponging between the input and a temporary buffer
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering, typename IndexType>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 IndexType num_threads,
+                 thrust::detail::false_type)
 {
   using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
+    last - first, tile_granularity(exec, IndexType(1)), num_threads);
+
+  const IndexType num_tiles = decomp.size();
+
+  // every thread sorts its own tile
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::stable_sort(thrust::seq, first + decomp[i].begin(), first + decomp[i].end(), comp);
+  }
+
+  if (num_tiles == 1)
+  {
+    return;
+  }
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, last - first);
+
+  bool in_buffer = false;
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+  for (IndexType tiles_per_run = 1; tiles_per_run < num_tiles; tiles_per_run *= 2)
+  {
+    if (in_buffer)
+    {
+      merge_adjacent_runs(buffer.begin(), first, decomp, tiles_per_run, num_threads, comp);
+    }
+    else
+    {
+      merge_adjacent_runs(first, buffer.begin(), decomp, tiles_per_run, num_threads, comp);
+    }
+
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer)
+  {
+    thrust::copy(exec, buffer.begin(), buffer.end(), first);
+  }
 }
 
 template <typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
-          typename StrictWeakOrdering>
-void inplace_merge_by_key(
+          typename StrictWeakOrdering,
+          typename IndexType>
+void stable_sort_by_key(
   execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp,
+  IndexType num_threads,
+  thrust::detail::false_type)
 {
   using value_type1 = typename thrust::iterator_value<RandomAccessIterator1>::type;
   using value_type2 = typename thrust::iterator_value<RandomAccessIterator2>::type;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+  const IndexType n = keys_last - keys_first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
+    n, tile_granularity(exec, IndexType(1)), num_threads);
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+  const IndexType num_tiles = decomp.size();
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+  // every thread sorts its own tile
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::stable_sort_by_key(
+      thrust::seq,
+      keys_first + decomp[i].begin(),
+      keys_first + decomp[i].end(),
+      values_first + decomp[i].begin(),
+      comp);
+  }
+
+  if (num_tiles == 1)
+  {
+    return;
+  }
+
+  thrust::detail::temporary_array<value_type1, DerivedPolicy> keys_buffer(exec, n);
+  thrust::detail::temporary_array<value_type2, DerivedPolicy> values_buffer(exec, n);
+
+  bool in_buffer = false;
+
+  for (IndexType tiles_per_run = 1; tiles_per_run < num_tiles; tiles_per_run *= 2)
+  {
+    if (in_buffer)
+    {
+      merge_adjacent_runs_by_key(
+        keys_buffer.begin(), values_buffer.begin(), keys_first, values_first, decomp, tiles_per_run, num_threads, comp);
+    }
+    else
+    {
+      merge_adjacent_runs_by_key(
+        keys_first, values_first, keys_buffer.begin(), values_buffer.begin(), decomp, tiles_per_run, num_threads, comp);
+    }
+
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer)
+  {
+    thrust::copy(exec, keys_buffer.begin(), keys_buffer.end(), keys_first);
+    thrust::copy(exec, values_buffer.begin(), values_buffer.end(), values_first);
+  }
+}
+
+// the smallest tile a radix sort pass hands to a thread
+const static int radix_sort_tile_granularity = 16 * 1024;
+
+// counts the digits of every tile and turns the counts into offsets, returns false if the pass can be skipped
+template <typename RandomAccessIterator, typename IndexType, typename Digit>
+bool radix_sort_count(RandomAccessIterator keys,
+                      const thrust::system::detail::internal::uniform_decomposition<IndexType>& decomp,
+                      IndexType n,
+                      Digit digit,
+                      IndexType* counts)
+{
+  using thrust::system::detail::internal::radix_sort_num_buckets;
+
+  const IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_sort_tile_count(
+      keys, decomp[i].begin(), decomp[i].end(), digit, counts + i * radix_sort_num_buckets);
+  }
+
+  return thrust::system::detail::internal::radix_sort_scan_counts(counts, num_tiles, n);
+}
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename IndexType, typename Digit>
+bool radix_sort_pass(RandomAccessIterator1 keys,
+                     RandomAccessIterator2 keys_result,
+                     const thrust::system::detail::internal::uniform_decomposition<IndexType>& decomp,
+                     IndexType n,
+                     Digit digit,
+                     IndexType* counts)
+{
+  using thrust::system::detail::internal::radix_sort_num_buckets;
+
+  if (!radix_sort_count(keys, decomp, n, digit, counts))
+  {
+    return false;
+  }
+
+  const IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_sort_tile_scatter(
+      keys, keys_result, decomp[i].begin(), decomp[i].end(), digit, counts + i * radix_sort_num_buckets);
+  }
+
+  return true;
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename IndexType,
+          typename Digit>
+bool radix_sort_by_key_pass(
+  RandomAccessIterator1 keys,
+  RandomAccessIterator2 values,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  const thrust::system::detail::internal::uniform_decomposition<IndexType>& decomp,
+  IndexType n,
+  Digit digit,
+  IndexType* counts)
+{
+  using thrust::system::detail::internal::radix_sort_num_buckets;
+
+  if (!radix_sort_count(keys, decomp, n, digit, counts))
+  {
+    return false;
+  }
+
+  const IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_sort_by_key_tile_scatter(
+      keys,
+      values,
+      keys_result,
+      values_result,
+      decomp[i].begin(),
+      decomp[i].end(),
+      digit,
+      counts + i * radix_sort_num_buckets);
+  }
+
+  return true;
+}
+
+// LSD radix sort of arithmetic keys, every pass ping-pongs between the input and a temporary buffer
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering, typename IndexType>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering,
+                 IndexType num_threads,
+                 thrust::detail::true_type)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using digit_type = typename thrust::system::detail::internal::radix_digit_for<value_type, StrictWeakOrdering>::type;
+
+  using thrust::system::detail::internal::radix_sort_num_buckets;
+  using thrust::system::detail::internal::radix_sort_num_passes;
+
+  const IndexType n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
+    n, tile_granularity(exec, IndexType(radix_sort_tile_granularity)), num_threads);
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, n);
+  thrust::detail::temporary_array<IndexType, DerivedPolicy> counts(exec, decomp.size() * radix_sort_num_buckets);
+
+  IndexType* counts_ptr = thrust::raw_pointer_cast(counts.data());
+
+  bool in_buffer = false;
+
+  for (unsigned int pass = 0; pass < radix_sort_num_passes<value_type>::value; ++pass)
+  {
+    const digit_type digit(pass);
+
+    const bool moved = in_buffer ? radix_sort_pass(buffer.begin(), first, decomp, n, digit, counts_ptr)
+                                 : radix_sort_pass(first, buffer.begin(), decomp, n, digit, counts_ptr);
+
+    in_buffer = in_buffer != moved;
+  }
+
+  if (in_buffer)
+  {
+    thrust::copy(exec, buffer.begin(), buffer.end(), first);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering,
+          typename IndexType>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering,
+  IndexType num_threads,
+  thrust::detail::true_type)
+{
+  using value_type1 = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using value_type2 = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using digit_type  = typename thrust::system::detail::internal::radix_digit_for<value_type1, StrictWeakOrdering>::type;
+
+  using thrust::system::detail::internal::radix_sort_num_buckets;
+  using thrust::system::detail::internal::radix_sort_num_passes;
+
+  const IndexType n = keys_last - keys_first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
+    n, tile_granularity(exec, IndexType(radix_sort_tile_granularity)), num_threads);
+
+  thrust::detail::temporary_array<value_type1, DerivedPolicy> keys_buffer(exec, n);
+  thrust::detail::temporary_array<value_type2, DerivedPolicy> values_buffer(exec, n);
+  thrust::detail::temporary_array<IndexType, DerivedPolicy> counts(exec, decomp.size() * radix_sort_num_buckets);
+
+  IndexType* counts_ptr = thrust::raw_pointer_cast(counts.data());
+
+  bool in_buffer = false;
+
+  for (unsigned int pass = 0; pass < radix_sort_num_passes<value_type1>::value; ++pass)
+  {
+    const digit_type digit(pass);
+
+    const bool moved =
+      in_buffer
+        ? radix_sort_by_key_pass(
+            keys_buffer.begin(), values_buffer.begin(), keys_first, values_first, decomp, n, digit, counts_ptr)
+        : radix_sort_by_key_pass(
+            keys_first, values_first, keys_buffer.begin(), values_buffer.begin(), decomp, n, digit, counts_ptr);
+
+    in_buffer = in_buffer != moved;
+  }
+
+  if (in_buffer)
+  {
+    thrust::copy(exec, keys_buffer.begin(), keys_buffer.end(), keys_first);
+    thrust::copy(exec, values_buffer.begin(), values_buffer.end(), values_first);
+  }
 }
 
 } // namespace sort_detail
@@ -107,61 +501,20 @@ void stable_sort(
                                              (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
     "OpenMP compiler support is not enabled");
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
+  // Avoid issues on compilers that don't provide `omp_get_max_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = typename thrust::iterator_difference<RandomAccessIterator>::type;
+  using IndexType  = typename thrust::iterator_difference<RandomAccessIterator>::type;
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
   if (first == last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
-  {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
-
-    // process id
-    IndexType p_i = omp_get_thread_num();
-
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
-    {
-      thrust::stable_sort(thrust::seq, first + decomp[p_i].begin(), first + decomp[p_i].end(), comp);
-    }
-
-    THRUST_PRAGMA_OMP(barrier)
+  const IndexType num_threads = team_size(parallel_params_of(exec));
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
-
-    while (nseg > 1)
-    {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
-
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
-
-        b = c;
-        c += h;
-      }
-
-      nseg = (nseg + 1) / 2;
-      h *= 2;
-
-      THRUST_PRAGMA_OMP(barrier)
-    }
-  }
+  thrust::system::detail::internal::use_radix_sort<value_type, StrictWeakOrdering> use_radix_sort;
+  sort_detail::stable_sort(exec, first, last, comp, num_threads, use_radix_sort);
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -186,72 +539,20 @@ void stable_sort_by_key(
                                              (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
     "OpenMP compiler support is not enabled");
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
+  // Avoid issues on compilers that don't provide `omp_get_max_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using IndexType   = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using value_type1 = typename thrust::iterator_value<RandomAccessIterator1>::type;
 
   if (keys_first == keys_last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
-  {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
-
-    // process id
-    IndexType p_i = omp_get_thread_num();
-
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
-    {
-      thrust::stable_sort_by_key(
-        thrust::seq,
-        keys_first + decomp[p_i].begin(),
-        keys_first + decomp[p_i].end(),
-        values_first + decomp[p_i].begin(),
-        comp);
-    }
-
-    THRUST_PRAGMA_OMP(barrier)
+  const IndexType num_threads = team_size(parallel_params_of(exec));
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
-
-    while (nseg > 1)
-    {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
-
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
-      }
-
-      nseg = (nseg + 1) / 2;
-      h *= 2;
-
-      THRUST_PRAGMA_OMP(barrier)
-    }
-  }
+  thrust::system::detail::internal::use_radix_sort<value_type1, StrictWeakOrdering> use_radix_sort;
+  sort_detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp, num_threads, use_radix_sort);
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file stream_compaction.h
+ *  \brief Count-scan-scatter stream compaction shared by the OpenMP
+ *         copy_if, remove_if and unique.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// selects i if pred(stencil[i]) is true, or if it is false when Negate
+template <typename InputIterator, typename Predicate, bool Negate = false>
+struct stencil_selector
+{
+  InputIterator stencil;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+
+  template <typename Size>
+  bool operator()(Size i) const
+  {
+    return pred(stencil[i]) != Negate;
+  }
+};
+
+// selects the first element of every group of consecutive equivalent elements
+template <typename InputIterator, typename BinaryPredicate>
+struct unique_selector
+{
+  InputIterator first;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  template <typename Size>
+  bool operator()(Size i) const
+  {
+    return i == 0 || !binary_pred(first[i - 1], first[i]);
+  }
+};
+
+// Copies every first[i] with i in [0, n) for which select(i) is true to result, in order, and returns the end of the
+// output. select is called twice per element, from any thread, and must not depend on the output.
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator, typename Selector>
+OutputIterator stream_compact(
+  execution_policy<DerivedPolicy>& exec, InputIterator first, Size n, OutputIterator result, Selector select);
+
+// Like stream_compact with result == first. select may read any element of [first, first + n), all of them are
+// selected before the first one is overwritten.
+template <typename DerivedPolicy, typename ForwardIterator, typename Size, typename Selector>
+ForwardIterator
+stream_compact_in_place(execution_policy<DerivedPolicy>& exec, ForwardIterator first, Size n, Selector select);
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/omp/detail/stream_compaction.inl>
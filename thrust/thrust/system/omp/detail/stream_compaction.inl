@@ -0,0 +1,281 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/tile_offsets.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/parallel_params.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
+
+#include <cstdint>
+#include <new>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace stream_compaction_detail
+{
+
+// counts the selected elements of tile i, and records which ones they are for the scatter pass
+template <typename Selector, typename Size, typename Decomposition>
+struct count_body
+{
+  Selector select;
+  unsigned char* flags;
+  Size* counts;
+  Decomposition decomp;
+
+  template <typename Index>
+  void operator()(Index i) const
+  {
+    Size count = 0;
+
+    for (Size j = decomp[i].begin(); j < decomp[i].end(); ++j)
+    {
+      const bool selected = select(j);
+      flags[j]            = selected;
+      count += selected;
+    }
+
+    counts[i] = count;
+  }
+};
+
+// copies the selected elements of tile i to the output, starting at the offset of the tile
+template <typename InputIterator, typename OutputIterator, typename Size, typename Decomposition>
+struct scatter_body
+{
+  InputIterator first;
+  OutputIterator result;
+  const unsigned char* flags;
+  const Size* offsets;
+  Decomposition decomp;
+
+  template <typename Index>
+  void operator()(Index i) const
+  {
+    OutputIterator out = result + offsets[i];
+    InputIterator in   = first + decomp[i].begin();
+
+    for (Size j = decomp[i].begin(); j < decomp[i].end(); ++j, ++in)
+    {
+      if (flags[j])
+      {
+        *out = *in;
+        ++out;
+      }
+    }
+  }
+};
+
+// copy constructs the selected elements of tile i into uninitialized storage, starting at the offset of the tile
+template <typename InputIterator, typename ValueType, typename Size, typename Decomposition>
+struct construct_body
+{
+  InputIterator first;
+  ValueType* result;
+  const unsigned char* flags;
+  const Size* offsets;
+  Decomposition decomp;
+
+  template <typename Index>
+  void operator()(Index i) const
+  {
+    ValueType* out   = result + offsets[i];
+    InputIterator in = first + decomp[i].begin();
+
+    for (Size j = decomp[i].begin(); j < decomp[i].end(); ++j, ++in)
+    {
+      if (flags[j])
+      {
+        ::new (static_cast<void*>(out)) ValueType(*in);
+        ++out;
+      }
+    }
+  }
+};
+
+} // end namespace stream_compaction_detail
+
+// Count-scan-scatter over the tiles of the default decomposition:
+//
+//   1. every tile counts its selected elements in parallel, and flags them,
+//   2. the counts are scanned sequentially into per-tile output offsets,
+//   3. every tile copies its flagged elements to its offset in parallel.
+//
+// select is evaluated exactly once per element, so an expensive or stateful selector neither costs twice nor makes
+// the scatter pass disagree with the offsets computed from the counts.
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator, typename Selector>
+OutputIterator stream_compact(
+  execution_policy<DerivedPolicy>& exec, InputIterator first, Size n, OutputIterator result, Selector select)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using decomposition_type = thrust::system::detail::internal::uniform_decomposition<Size>;
+
+  const parallel_params params = parallel_params_of(exec);
+
+  const decomposition_type decomp = thrust::system::omp::detail::default_decomposition(params, n);
+
+  const std::intptr_t num_tiles = static_cast<std::intptr_t>(decomp.size());
+
+  // a single tile gains nothing from the counting pass
+  if (num_tiles <= 1)
+  {
+    for (Size j = 0; j < n; ++j, ++first)
+    {
+      if (select(j))
+      {
+        *result = *first;
+        ++result;
+      }
+    }
+
+    return result;
+  }
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(0, exec, num_tiles);
+  Size* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  thrust::detail::temporary_array<unsigned char, DerivedPolicy> flags(0, exec, n);
+  unsigned char* flags_ptr = thrust::raw_pointer_cast(flags.data());
+
+  // the grain size of the policy is already reflected in the size of the tiles, so they are handed out one at a time
+  parallel_params tile_params = params;
+  tile_params.grain           = 0;
+
+  stream_compaction_detail::count_body<Selector, Size, decomposition_type> count{
+    select, flags_ptr, offsets_ptr, decomp};
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, count);
+
+  const Size num_selected = thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr, num_tiles);
+
+  stream_compaction_detail::scatter_body<InputIterator, OutputIterator, Size, decomposition_type> scatter{
+    first, result, flags_ptr, offsets_ptr, decomp};
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, scatter);
+
+  return result + num_selected;
+}
+
+// The output of a tile may overlap the input of the tiles before it, so the tiles can't be scattered in place
+// concurrently. They are scattered into a buffer of the selected elements instead, which is copied back in parallel.
+template <typename DerivedPolicy, typename ForwardIterator, typename Size, typename Selector>
+ForwardIterator
+stream_compact_in_place(execution_policy<DerivedPolicy>& exec, ForwardIterator first, Size n, Selector select)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<ForwardIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using decomposition_type = thrust::system::detail::internal::uniform_decomposition<Size>;
+  using ValueType          = typename thrust::iterator_value<ForwardIterator>::type;
+
+  const parallel_params params = parallel_params_of(exec);
+
+  const decomposition_type decomp = thrust::system::omp::detail::default_decomposition(params, n);
+
+  const std::intptr_t num_tiles = static_cast<std::intptr_t>(decomp.size());
+
+  // sequentially the writes trail the reads, select(j) still sees the original elements j - 1 and j
+  if (num_tiles <= 1)
+  {
+    ForwardIterator in  = first;
+    ForwardIterator out = first;
+
+    for (Size j = 0; j < n; ++j, ++in)
+    {
+      if (select(j))
+      {
+        if (out != in)
+        {
+          *out = *in;
+        }
+        ++out;
+      }
+    }
+
+    return out;
+  }
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(0, exec, num_tiles);
+  Size* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  thrust::detail::temporary_array<unsigned char, DerivedPolicy> flags(0, exec, n);
+  unsigned char* flags_ptr = thrust::raw_pointer_cast(flags.data());
+
+  // the grain size of the policy is already reflected in the size of the tiles, so they are handed out one at a time
+  parallel_params tile_params = params;
+  tile_params.grain           = 0;
+
+  stream_compaction_detail::count_body<Selector, Size, decomposition_type> count{
+    select, flags_ptr, offsets_ptr, decomp};
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, count);
+
+  const Size num_selected = thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr, num_tiles);
+
+  // nothing to remove
+  if (num_selected == n)
+  {
+    return first + n;
+  }
+
+  // every element of the buffer is copy constructed by exactly one tile
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> buffer(0, exec, num_selected);
+
+  stream_compaction_detail::construct_body<ForwardIterator, ValueType, Size, decomposition_type> construct{
+    first, thrust::raw_pointer_cast(buffer.data()), flags_ptr, offsets_ptr, decomp};
+  thrust::system::omp::detail::parallel_for(tile_params, num_tiles, construct);
+
+  return thrust::copy(exec, buffer.begin(), buffer.end(), first);
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -25,8 +25,11 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
 #include <thrust/system/omp/detail/unique.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -41,8 +44,11 @@ template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredi
 ForwardIterator
 unique(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique to cpp::unique
-  return thrust::system::detail::generic::unique(exec, first, last, binary_pred);
+  using Size = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  unique_selector<ForwardIterator, BinaryPredicate> select{first, {binary_pred}};
+
+  return thrust::system::omp::detail::stream_compact_in_place(exec, first, Size(thrust::distance(first, last)), select);
 } // end unique()
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryPredicate>
@@ -53,8 +59,11 @@ OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_copy to cpp::unique_copy
-  return thrust::system::detail::generic::unique_copy(exec, first, last, output, binary_pred);
+  using Size = typename thrust::iterator_difference<InputIterator>::type;
+
+  unique_selector<InputIterator, BinaryPredicate> select{first, {binary_pred}};
+
+  return thrust::system::omp::detail::stream_compact(exec, first, Size(thrust::distance(first, last)), output, select);
 } // end unique_copy()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
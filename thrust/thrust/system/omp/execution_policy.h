@@ -146,6 +146,21 @@ struct tag : thrust::system::omp::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  The parallel loops behind \p for_each, \p reduce, the scans, \p copy_if and \p stable_sort can be
+ *  tuned by modifiers which return a new policy and may be chained, also after attaching an allocator:
+ *
+ *  - <tt>par.on(n)</tt> runs the loops on teams of \c n threads instead of <tt>omp_get_max_threads()</tt>,
+ *    for example to avoid oversubscription when an algorithm is called from within a parallel region,
+ *  - <tt>par.schedule(k)</tt> hands out iterations according to the \p thrust::omp::schedule_kind \c k,
+ *    \p schedule_kind::dynamic and \p schedule_kind::guided balance functors of uneven cost,
+ *  - <tt>par.grain(g)</tt> hands out \c g iterations at a time and keeps the tiles of the tiled
+ *    algorithms at least \c g elements long.
+ *
+ *  \code
+ *  thrust::for_each(thrust::omp::par.schedule(thrust::omp::schedule_kind::dynamic).grain(64),
+ *                   vec.begin(), vec.end(), printf_functor());
+ *  \endcode
  */
 static const unspecified par;
 
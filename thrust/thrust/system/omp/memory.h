@@ -91,6 +91,21 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<T, thrust::
 template <typename T>
 using universal_host_pinned_allocator =
   thrust::mr::stateless_resource_allocator<T, thrust::system::omp::universal_host_pinned_memory_resource>;
+
+/*! \p omp::first_touch_allocator allocates memory for the \p omp system whose pages are placed on the NUMA nodes of
+ *  the threads that process them, see \p omp::first_touch_memory_resource. Use it as the allocator of
+ *  <tt>omp::vector</tt> for bandwidth bound algorithms on multi-socket machines.
+ */
+template <typename T>
+using first_touch_allocator =
+  thrust::mr::stateless_resource_allocator<T, thrust::system::omp::first_touch_memory_resource>;
+
+/*! \p omp::interleaved_allocator allocates memory for the \p omp system whose pages are interleaved over all NUMA
+ *  nodes, see \p omp::interleaved_memory_resource.
+ */
+template <typename T>
+using interleaved_allocator =
+  thrust::mr::stateless_resource_allocator<T, thrust::system::omp::interleaved_memory_resource>;
 } // namespace omp
 } // namespace system
 
@@ -100,7 +115,9 @@ using universal_host_pinned_allocator =
 namespace omp
 {
 using thrust::system::omp::allocator;
+using thrust::system::omp::first_touch_allocator;
 using thrust::system::omp::free;
+using thrust::system::omp::interleaved_allocator;
 using thrust::system::omp::malloc;
 using thrust::system::omp::universal_allocator;
 using thrust::system::omp::universal_host_pinned_allocator;
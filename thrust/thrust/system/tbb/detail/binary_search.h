@@ -14,6 +14,10 @@
  *  limitations under the License.
  */
 
+/*! \file binary_search.h
+ *  \brief TBB implementations of vectorized binary search functions.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -25,6 +29,64 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/tbb/detail/execution_policy.h>
 
-// this system inherits binary_search
+// this system inherits the scalar binary search functions
 #include <thrust/system/cpp/detail/binary_search.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp);
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/tbb/detail/binary_search.inl>
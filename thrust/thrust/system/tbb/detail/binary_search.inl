@@ -0,0 +1,333 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/binary_search.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/intervals.h>
+
+#include <cuda/std/type_traits>
+
+#include <cassert>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace binary_search_detail
+{
+
+// Every search finds the first position of the haystack whose element does not
+// precede the query, and then stores its result for that position.
+
+struct lower_bound_search
+{
+  template <typename Reference, typename T, typename StrictWeakOrdering>
+  static bool precedes(const Reference& element, const T& value, StrictWeakOrdering comp)
+  {
+    return comp(element, value);
+  }
+
+  template <typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+  static Size result(RandomAccessIterator, Size, Size position, const T&, StrictWeakOrdering)
+  {
+    return position;
+  }
+};
+
+struct upper_bound_search
+{
+  template <typename Reference, typename T, typename StrictWeakOrdering>
+  static bool precedes(const Reference& element, const T& value, StrictWeakOrdering comp)
+  {
+    return !comp(value, element);
+  }
+
+  template <typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+  static Size result(RandomAccessIterator, Size, Size position, const T&, StrictWeakOrdering)
+  {
+    return position;
+  }
+};
+
+struct binary_search_search
+{
+  template <typename Reference, typename T, typename StrictWeakOrdering>
+  static bool precedes(const Reference& element, const T& value, StrictWeakOrdering comp)
+  {
+    return comp(element, value);
+  }
+
+  template <typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+  static bool result(RandomAccessIterator begin, Size n, Size position, const T& value, StrictWeakOrdering comp)
+  {
+    return position < n && !comp(value, begin[position]);
+  }
+};
+
+// returns the first position in [lo, hi) whose element does not precede value
+template <typename Search, typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+Size partition_point(RandomAccessIterator begin, Size lo, Size hi, const T& value, StrictWeakOrdering comp)
+{
+  while (lo < hi)
+  {
+    const Size mid = lo + (hi - lo) / 2;
+
+    if (Search::precedes(begin[mid], value, comp))
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+// like partition_point over [from, n), but gallops forward from the result of
+// the previous, smaller query, which is known to precede the result of value
+template <typename Search, typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+Size gallop(RandomAccessIterator begin, Size from, Size n, const T& value, StrictWeakOrdering comp)
+{
+  Size lo   = from;
+  Size hi   = from;
+  Size step = 1;
+
+  while (hi < n && Search::precedes(begin[hi], value, comp))
+  {
+    lo = hi + 1;
+    hi = (thrust::min)(lo + step, n);
+    step *= 2;
+  }
+
+  return partition_point<Search>(begin, lo, hi, value, comp);
+}
+
+template <typename QueryType, typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+bool is_sorted_interval(
+  RandomAccessIterator values, Size first, Size last, StrictWeakOrdering comp, thrust::detail::true_type)
+{
+  QueryType prev = values[first];
+
+  for (Size i = first + 1; i < last; ++i)
+  {
+    QueryType value = values[i];
+
+    if (comp(value, prev))
+    {
+      return false;
+    }
+
+    prev = value;
+  }
+
+  return true;
+}
+
+// queries of a different type than the haystack may not be comparable with each other
+template <typename QueryType, typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+bool is_sorted_interval(RandomAccessIterator, Size, Size, StrictWeakOrdering, thrust::detail::false_type)
+{
+  return false;
+}
+
+template <typename Iterator1, typename Iterator2, typename Iterator3, typename StrictWeakOrdering, typename Search>
+struct body
+{
+  using haystack_size_type = typename thrust::iterator_difference<Iterator1>::type;
+  using size_type          = typename thrust::iterator_difference<Iterator2>::type;
+  using haystack_type      = typename thrust::iterator_value<Iterator1>::type;
+  using query_type         = typename thrust::iterator_value<Iterator2>::type;
+
+  Iterator1 begin;
+  Iterator2 values_begin;
+  Iterator3 output;
+
+  haystack_size_type haystack_size;
+  size_type num_values;
+  size_type interval_size;
+
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp;
+
+  body(Iterator1 begin,
+       Iterator2 values_begin,
+       Iterator3 output,
+       haystack_size_type haystack_size,
+       size_type num_values,
+       size_type interval_size,
+       StrictWeakOrdering comp)
+      : begin(begin)
+      , values_begin(values_begin)
+      , output(output)
+      , haystack_size(haystack_size)
+      , num_values(num_values)
+      , interval_size(interval_size)
+      , comp{comp}
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    assert(r.size() == 1);
+
+    const size_type interval_idx = r.begin();
+
+    const size_type offset_to_first = interval_size * interval_idx;
+    const size_type offset_to_last  = (thrust::min)(num_values, offset_to_first + interval_size);
+
+    if (is_sorted_interval<query_type>(
+          values_begin, offset_to_first, offset_to_last, comp, ::cuda::std::is_same<query_type, haystack_type>()))
+    {
+      // sorted queries are merged against the haystack: every search starts
+      // where the previous one ended, so the haystack is swept front to back
+      haystack_size_type position = 0;
+
+      for (size_type i = offset_to_first; i < offset_to_last; ++i)
+      {
+        const query_type value = values_begin[i];
+
+        position  = gallop<Search>(begin, position, haystack_size, value, comp);
+        output[i] = Search::result(begin, haystack_size, position, value, comp);
+      }
+    }
+    else
+    {
+      for (size_type i = offset_to_first; i < offset_to_last; ++i)
+      {
+        const query_type value = values_begin[i];
+
+        const haystack_size_type position =
+          partition_point<Search>(begin, haystack_size_type(0), haystack_size, value, comp);
+        output[i] = Search::result(begin, haystack_size, position, value, comp);
+      }
+    }
+  }
+};
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename Search>
+OutputIterator vectorized_search(
+  execution_policy<DerivedPolicy>&,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp,
+  Search)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator>::type;
+
+  const difference_type num_values    = values_end - values_begin;
+  // every query costs O(log n), so intervals are smaller than for linear algorithms
+  const difference_type interval_size = intervals_detail::interval_size(num_values, difference_type(1000));
+  const difference_type num_intervals = intervals_detail::divide_ri(num_values, interval_size);
+
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    body<ForwardIterator, InputIterator, OutputIterator, StrictWeakOrdering, Search>(
+      begin, values_begin, output, end - begin, num_values, interval_size, comp),
+    ::tbb::simple_partitioner());
+
+  return output + num_values;
+}
+
+} // end namespace binary_search_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::vectorized_search(
+    exec, begin, end, values_begin, values_end, output, comp, binary_search_detail::lower_bound_search());
+} // end lower_bound()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::vectorized_search(
+    exec, begin, end, values_begin, values_end, output, comp, binary_search_detail::upper_bound_search());
+} // end upper_bound()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::vectorized_search(
+    exec, begin, end, values_begin, values_end, output, comp, binary_search_detail::binary_search_search());
+} // end binary_search()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file first_touch.h
+ *  \brief Writes to the pages of a new allocation from the worker threads of
+ *         the TBB system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+#include <cstddef>
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace first_touch_detail
+{
+
+struct body
+{
+  using index_type = std::ptrdiff_t;
+
+  char* pages;
+  index_type page_size;
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp;
+
+  void operator()(const ::tbb::blocked_range<index_type>& r) const
+  {
+    for (index_type i = r.begin(); i < r.end(); ++i)
+    {
+      for (index_type page = decomp[i].begin(); page < decomp[i].end(); ++page)
+      {
+        pages[page * page_size] = 0;
+      }
+    }
+  }
+};
+
+} // end namespace first_touch_detail
+
+// Splits the pages into one tile per hardware thread like the tiled TBB algorithms split arrays. The static
+// partitioner hands every worker one tile and keeps assigning the same tiles to the same workers from one parallel
+// loop to the next, as far as TBB can.
+struct first_touch_pages
+{
+  void operator()(char* pages, std::size_t num_pages, std::size_t page_size) const
+  {
+    using index_type = first_touch_detail::body::index_type;
+
+    const index_type num_tiles = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+    first_touch_detail::body body{
+      pages,
+      static_cast<index_type>(page_size),
+      thrust::system::detail::internal::uniform_decomposition<index_type>(
+        static_cast<index_type>(num_pages), 1, num_tiles)};
+
+    ::tbb::parallel_for(::tbb::blocked_range<index_type>(0, body.decomp.size(), 1), body, ::tbb::static_partitioner());
+  }
+};
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
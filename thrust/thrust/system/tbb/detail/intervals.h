@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace intervals_detail
+{
+
+template <typename L, typename R>
+inline L divide_ri(const L x, const R y)
+{
+  return (x + (y - 1)) / y;
+}
+
+// the size of the intervals of sequential work n elements are split into
+template <typename Size>
+Size interval_size(Size n, Size parallelism_threshold = 10000)
+{
+  // XXX the threshold is a tuning opportunity
+
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate O(P) intervals of sequential work, but don't bother parallelizing for small n
+  return thrust::max<Size>(parallelism_threshold, divide_ri(n, Size(p)));
+}
+
+} // end namespace intervals_detail
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
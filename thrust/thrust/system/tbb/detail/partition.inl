@@ -25,9 +25,24 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/partition.h>
+#include <thrust/copy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/internal/partition.h>
+#include <thrust/system/detail/internal/tile_offsets.h>
+#include <thrust/system/tbb/detail/intervals.h>
 #include <thrust/system/tbb/detail/partition.h>
 
+#include <cassert>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -35,13 +50,221 @@ namespace tbb
 {
 namespace detail
 {
+namespace partition_detail
+{
+
+template <typename InputIterator, typename Predicate, typename Size>
+struct count_body
+{
+  InputIterator stencil;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+  unsigned char* flags;
+  Size* counts;
+
+  Size n;
+  Size interval_size;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size interval_idx = r.begin();
+
+    const Size offset_to_first = interval_size * interval_idx;
+    const Size offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+    counts[interval_idx] = thrust::system::detail::internal::stable_partition_tile_count(
+      stencil, offset_to_first, offset_to_last, flags, pred);
+  }
+};
+
+template <typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Write,
+          typename Size>
+struct scatter_body
+{
+  InputIterator first;
+  const unsigned char* flags;
+  OutputIterator1 out_true;
+  OutputIterator2 out_false;
+  Write write;
+  const Size* offsets;
+
+  Size n;
+  Size interval_size;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size interval_idx = r.begin();
+
+    const Size offset_to_first = interval_size * interval_idx;
+    const Size offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+    thrust::system::detail::internal::stable_partition_tile(
+      first,
+      flags,
+      offset_to_first,
+      offset_to_last,
+      out_true + offsets[interval_idx],
+      out_false + (offset_to_first - offsets[interval_idx]),
+      thrust::system::detail::internal::partition_flag(),
+      write);
+  }
+};
+
+// the intervals of n elements and their offsets in the true output
+template <typename DerivedPolicy, typename Size>
+struct tiling
+{
+  Size n;
+  Size interval_size;
+  Size num_intervals;
+  // the offsets of the intervals, followed by the answer of the predicate for every element, which count() records
+  // and scatter() reads back
+  thrust::detail::temporary_array<unsigned char, DerivedPolicy> storage;
+
+  tiling(execution_policy<DerivedPolicy>& exec, Size n)
+      : n(n)
+      , interval_size(intervals_detail::interval_size(n))
+      , num_intervals(intervals_detail::divide_ri(n, interval_size))
+      , storage(0, exec, num_intervals * sizeof(Size) + n)
+  {}
+
+  Size* offsets_ptr()
+  {
+    return reinterpret_cast<Size*>(thrust::raw_pointer_cast(storage.data()));
+  }
+
+  unsigned char* flags_ptr()
+  {
+    return thrust::raw_pointer_cast(storage.data()) + num_intervals * sizeof(Size);
+  }
+
+  // counts the true elements of every interval and returns their total
+  template <typename InputIterator, typename Predicate>
+  Size count(InputIterator stencil, Predicate pred)
+  {
+    // force grainsize == 1 with simple_partioner()
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                        count_body<InputIterator, Predicate, Size>{
+                          stencil, {pred}, flags_ptr(), offsets_ptr(), n, interval_size},
+                        ::tbb::simple_partitioner());
+
+    return thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr(), num_intervals);
+  }
+
+  // writes every interval at its offsets, after count()
+  template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename Write>
+  void scatter(InputIterator first, OutputIterator1 out_true, OutputIterator2 out_false, Write write)
+  {
+    using body_type = scatter_body<InputIterator, OutputIterator1, OutputIterator2, Write, Size>;
+
+    // force grainsize == 1 with simple_partioner()
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                        body_type{first, flags_ptr(), out_true, out_false, write, offsets_ptr(), n, interval_size},
+                        ::tbb::simple_partitioner());
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate>
+thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator1 out_true,
+  OutputIterator2 out_false,
+  Predicate pred)
+{
+  using Size = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const Size n = thrust::distance(first, last);
+
+  if (intervals_detail::divide_ri(n, intervals_detail::interval_size(n)) <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+    const Size num_true = thrust::system::detail::internal::stable_partition_tile(
+      first,
+      stencil,
+      Size(0),
+      n,
+      out_true,
+      out_false,
+      wrapped_pred,
+      thrust::system::detail::internal::partition_assign());
+
+    return thrust::make_pair(out_true + num_true, out_false + (n - num_true));
+  }
+
+  tiling<DerivedPolicy, Size> tiles(exec, n);
+
+  const Size num_true = tiles.count(stencil, pred);
+
+  tiles.scatter(first, out_true, out_false, thrust::system::detail::internal::partition_assign());
+
+  return thrust::make_pair(out_true + num_true, out_false + (n - num_true));
+}
+
+// Partitions into a buffer, the false elements right after the true ones, and copies it back. Besides the flags of one
+// byte per element, the buffer is the only temporary of the size of the input, and every element of it is copy
+// constructed by exactly one interval. It's allocated apart from the offsets and flags, only once their counts show that
+// some elements move.
+template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
+ForwardIterator stable_partition(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator stencil,
+  Predicate pred)
+{
+  using Size      = typename thrust::iterator_difference<ForwardIterator>::type;
+  using ValueType = typename thrust::iterator_value<ForwardIterator>::type;
+
+  const Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  tiling<DerivedPolicy, Size> tiles(exec, n);
+
+  const Size num_true = tiles.count(stencil, pred);
+
+  // nothing moves
+  if (num_true == 0 || num_true == n)
+  {
+    return first + num_true;
+  }
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> buffer(0, exec, n);
+  ValueType* buffer_ptr = thrust::raw_pointer_cast(buffer.data());
+
+  tiles.scatter(first, buffer_ptr, buffer_ptr + num_true, thrust::system::detail::internal::partition_construct());
+
+  thrust::copy(exec, buffer.begin(), buffer.end(), first);
+
+  return first + num_true;
+}
+
+} // end namespace partition_detail
 
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // tbb prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  return partition_detail::stable_partition(exec, first, last, first, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -52,8 +275,7 @@ ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
-  // tbb prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  return partition_detail::stable_partition(exec, first, last, stencil, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy,
@@ -69,8 +291,7 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  return partition_detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
@@ -88,8 +309,7 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return partition_detail::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 } // end namespace detail
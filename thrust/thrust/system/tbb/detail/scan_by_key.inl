@@ -0,0 +1,352 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/internal/segmented_scan.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/intervals.h>
+#include <thrust/system/tbb/detail/scan_by_key.h>
+
+#include <cassert>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace scan_by_key_detail
+{
+
+template <typename ValueType,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+struct reduce_last_segment_body
+{
+  using size_type = typename thrust::iterator_difference<Iterator1>::type;
+
+  Iterator1 keys_first;
+  Iterator2 values_first;
+  Iterator3 carry_result;
+
+  size_type n;
+  size_type interval_size;
+
+  BinaryPredicate binary_pred;
+  BinaryFunction binary_op;
+
+  reduce_last_segment_body(
+    Iterator1 keys_first,
+    Iterator2 values_first,
+    Iterator3 carry_result,
+    size_type n,
+    size_type interval_size,
+    BinaryPredicate binary_pred,
+    BinaryFunction binary_op)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , carry_result(carry_result)
+      , n(n)
+      , interval_size(interval_size)
+      , binary_pred(binary_pred)
+      , binary_op(binary_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    assert(r.size() == 1);
+
+    const size_type interval_idx = r.begin();
+
+    const size_type offset_to_first = interval_size * interval_idx;
+    const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+    carry_result[interval_idx] = thrust::system::detail::internal::reduce_last_segment<ValueType>(
+      keys_first, values_first, offset_to_first, offset_to_last, binary_pred, binary_op);
+  }
+};
+
+template <typename ValueType,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+struct inclusive_scan_body
+{
+  using size_type = typename thrust::iterator_difference<Iterator1>::type;
+
+  Iterator1 keys_first;
+  Iterator2 values_first;
+  Iterator3 result;
+  Iterator4 carries;
+
+  size_type n;
+  size_type interval_size;
+
+  BinaryPredicate binary_pred;
+  BinaryFunction binary_op;
+
+  inclusive_scan_body(
+    Iterator1 keys_first,
+    Iterator2 values_first,
+    Iterator3 result,
+    Iterator4 carries,
+    size_type n,
+    size_type interval_size,
+    BinaryPredicate binary_pred,
+    BinaryFunction binary_op)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , result(result)
+      , carries(carries)
+      , n(n)
+      , interval_size(interval_size)
+      , binary_pred(binary_pred)
+      , binary_op(binary_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    assert(r.size() == 1);
+
+    const size_type interval_idx = r.begin();
+
+    const size_type offset_to_first = interval_size * interval_idx;
+    const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+    thrust::system::detail::internal::inclusive_scan_by_key_tile(
+      keys_first, values_first, result, offset_to_first, offset_to_last, carries[interval_idx], binary_pred, binary_op);
+  }
+};
+
+template <typename ValueType,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+struct exclusive_scan_body
+{
+  using size_type = typename thrust::iterator_difference<Iterator1>::type;
+
+  Iterator1 keys_first;
+  Iterator2 values_first;
+  Iterator3 result;
+  Iterator4 carries;
+
+  size_type n;
+  size_type interval_size;
+
+  ValueType init;
+  BinaryPredicate binary_pred;
+  BinaryFunction binary_op;
+
+  exclusive_scan_body(
+    Iterator1 keys_first,
+    Iterator2 values_first,
+    Iterator3 result,
+    Iterator4 carries,
+    size_type n,
+    size_type interval_size,
+    ValueType init,
+    BinaryPredicate binary_pred,
+    BinaryFunction binary_op)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , result(result)
+      , carries(carries)
+      , n(n)
+      , interval_size(interval_size)
+      , init(init)
+      , binary_pred(binary_pred)
+      , binary_op(binary_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    assert(r.size() == 1);
+
+    const size_type interval_idx = r.begin();
+
+    const size_type offset_to_first = interval_size * interval_idx;
+    const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+    thrust::system::detail::internal::exclusive_scan_by_key_tile(
+      keys_first,
+      values_first,
+      result,
+      offset_to_first,
+      offset_to_last,
+      carries[interval_idx],
+      init,
+      binary_pred,
+      binary_op);
+  }
+};
+
+} // namespace scan_by_key_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+  using ValueType       = typename thrust::iterator_value<InputIterator2>::type;
+  using carry_type      = thrust::system::detail::internal::segment_carry<ValueType>;
+
+  const difference_type n             = last1 - first1;
+  const difference_type interval_size = intervals_detail::interval_size(n);
+  const difference_type num_intervals = intervals_detail::divide_ri(n, interval_size);
+
+  if (num_intervals <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+  thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(exec, num_intervals);
+  carry_type* carries_ptr = thrust::raw_pointer_cast(carries.data());
+
+  // reduce the last segment of every interval
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    scan_by_key_detail::
+      reduce_last_segment_body<ValueType, InputIterator1, InputIterator2, carry_type*, BinaryPredicate, BinaryFunction>(
+        first1, first2, carries_ptr, n, interval_size, binary_pred, binary_op),
+    ::tbb::simple_partitioner());
+
+  // propagate the partial sums of segments spanning interval boundaries
+  thrust::system::detail::internal::accumulate_segment_carries(carries_ptr, num_intervals, binary_op);
+
+  // scan every interval seeded with its carry
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    scan_by_key_detail::inclusive_scan_body<ValueType,
+                                            InputIterator1,
+                                            InputIterator2,
+                                            OutputIterator,
+                                            carry_type*,
+                                            BinaryPredicate,
+                                            BinaryFunction>(
+      first1, first2, result, carries_ptr, n, interval_size, binary_pred, binary_op),
+    ::tbb::simple_partitioner());
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+  using ValueType       = T;
+  using carry_type      = thrust::system::detail::internal::segment_carry<ValueType>;
+
+  const difference_type n             = last1 - first1;
+  const difference_type interval_size = intervals_detail::interval_size(n);
+  const difference_type num_intervals = intervals_detail::divide_ri(n, interval_size);
+
+  if (num_intervals <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+  thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(exec, num_intervals);
+  carry_type* carries_ptr = thrust::raw_pointer_cast(carries.data());
+
+  // reduce the last segment of every interval
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    scan_by_key_detail::
+      reduce_last_segment_body<ValueType, InputIterator1, InputIterator2, carry_type*, BinaryPredicate, BinaryFunction>(
+        first1, first2, carries_ptr, n, interval_size, binary_pred, binary_op),
+    ::tbb::simple_partitioner());
+
+  // propagate the partial sums of segments spanning interval boundaries
+  thrust::system::detail::internal::accumulate_segment_carries(carries_ptr, num_intervals, init, binary_op);
+
+  // scan every interval seeded with its carry
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    scan_by_key_detail::exclusive_scan_body<ValueType,
+                                            InputIterator1,
+                                            InputIterator2,
+                                            OutputIterator,
+                                            carry_type*,
+                                            BinaryPredicate,
+                                            BinaryFunction>(
+      first1, first2, result, carries_ptr, n, interval_size, init, binary_pred, binary_op),
+    ::tbb::simple_partitioner());
+
+  return result + n;
+}
+
+} // namespace detail
+} // namespace tbb
+} // namespace system
+THRUST_NAMESPACE_END
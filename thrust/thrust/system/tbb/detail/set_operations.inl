@@ -0,0 +1,292 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/system/detail/internal/tile_offsets.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/intervals.h>
+#include <thrust/system/tbb/detail/set_operations.h>
+
+#include <cassert>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+template <typename Iterator1, typename Iterator2, typename SetOperation, typename StrictWeakOrdering>
+struct count_body
+{
+  using size_type = typename thrust::iterator_difference<Iterator1>::type;
+
+  Iterator1 first1;
+  Iterator2 first2;
+  size_type* counts;
+
+  size_type n1;
+  size_type n2;
+  size_type interval_size;
+
+  SetOperation set_op;
+  StrictWeakOrdering comp;
+
+  count_body(Iterator1 first1,
+             Iterator2 first2,
+             size_type* counts,
+             size_type n1,
+             size_type n2,
+             size_type interval_size,
+             SetOperation set_op,
+             StrictWeakOrdering comp)
+      : first1(first1)
+      , first2(first2)
+      , counts(counts)
+      , n1(n1)
+      , n2(n2)
+      , interval_size(interval_size)
+      , set_op(set_op)
+      , comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    assert(r.size() == 1);
+
+    const size_type interval_idx = r.begin();
+
+    const size_type offset_to_first = interval_size * interval_idx;
+    const size_type offset_to_last  = (thrust::min)(n1 + n2, offset_to_first + interval_size);
+
+    counts[interval_idx] = thrust::system::detail::internal::set_operation_tile_count(
+      first1, n1, first2, n2, offset_to_first, offset_to_last, set_op, comp);
+  }
+};
+
+template <typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename SetOperation,
+          typename StrictWeakOrdering>
+struct write_body
+{
+  using size_type = typename thrust::iterator_difference<Iterator1>::type;
+
+  Iterator1 first1;
+  Iterator2 first2;
+  Iterator3 result;
+  const size_type* offsets;
+
+  size_type n1;
+  size_type n2;
+  size_type interval_size;
+
+  SetOperation set_op;
+  StrictWeakOrdering comp;
+
+  write_body(Iterator1 first1,
+             Iterator2 first2,
+             Iterator3 result,
+             const size_type* offsets,
+             size_type n1,
+             size_type n2,
+             size_type interval_size,
+             SetOperation set_op,
+             StrictWeakOrdering comp)
+      : first1(first1)
+      , first2(first2)
+      , result(result)
+      , offsets(offsets)
+      , n1(n1)
+      , n2(n2)
+      , interval_size(interval_size)
+      , set_op(set_op)
+      , comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    assert(r.size() == 1);
+
+    const size_type interval_idx = r.begin();
+
+    const size_type offset_to_first = interval_size * interval_idx;
+    const size_type offset_to_last  = (thrust::min)(n1 + n2, offset_to_first + interval_size);
+
+    thrust::system::detail::internal::set_operation_tile(
+      first1, n1, first2, n2, result, offset_to_first, offset_to_last, offsets[interval_idx], set_op, comp);
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const difference_type n1            = last1 - first1;
+  const difference_type n2            = static_cast<difference_type>(last2 - first2);
+  const difference_type interval_size = intervals_detail::interval_size(n1 + n2);
+  const difference_type num_intervals = intervals_detail::divide_ri(n1 + n2, interval_size);
+
+  if (num_intervals <= 1)
+  {
+    // don't bother parallelizing for small n
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> offsets(exec, num_intervals);
+  difference_type* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  // count the output of every interval
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    count_body<InputIterator1, InputIterator2, SetOperation, StrictWeakOrdering>(
+      first1, first2, offsets_ptr, n1, n2, interval_size, set_op, comp),
+    ::tbb::simple_partitioner());
+
+  const difference_type num_outputs =
+    thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr, num_intervals);
+
+  // every interval writes its output at its offset
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    write_body<InputIterator1, InputIterator2, OutputIterator, SetOperation, StrictWeakOrdering>(
+      first1, first2, result, offsets_ptr, n1, n2, interval_size, set_op, comp),
+    ::tbb::simple_partitioner());
+
+  return result + num_outputs;
+}
+
+} // end namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference());
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection());
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::serial_set_symmetric_difference());
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union());
+} // end set_union()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
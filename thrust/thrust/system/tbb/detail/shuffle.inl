@@ -0,0 +1,147 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in ctbbliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/detail/internal/tile_offsets.h>
+#include <thrust/system/tbb/detail/intervals.h>
+#include <thrust/system/tbb/detail/shuffle.h>
+
+#include <cassert>
+#include <cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace shuffle_detail
+{
+
+using bijection_type = thrust::system::detail::generic::feistel_bijection;
+
+// counts the images below m of the indices of an interval
+struct count_body
+{
+  bijection_type bijection;
+  std::uint64_t m;
+  std::uint64_t* counts;
+
+  std::uint64_t n;
+  std::uint64_t interval_size;
+
+  void operator()(const ::tbb::blocked_range<std::uint64_t>& r) const
+  {
+    assert(r.size() == 1);
+
+    const std::uint64_t interval_idx = r.begin();
+
+    const std::uint64_t offset_to_first = interval_size * interval_idx;
+    const std::uint64_t offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+    counts[interval_idx] =
+      thrust::system::detail::internal::shuffle_tile_count(bijection, m, offset_to_first, offset_to_last);
+  }
+};
+
+// gathers the elements of an interval to its offset in the output
+template <typename RandomIterator, typename OutputIterator>
+struct gather_body
+{
+  bijection_type bijection;
+  std::uint64_t m;
+  RandomIterator first;
+  OutputIterator result;
+  const std::uint64_t* offsets;
+
+  std::uint64_t n;
+  std::uint64_t interval_size;
+
+  void operator()(const ::tbb::blocked_range<std::uint64_t>& r) const
+  {
+    assert(r.size() == 1);
+
+    const std::uint64_t interval_idx = r.begin();
+
+    const std::uint64_t offset_to_first = interval_size * interval_idx;
+    const std::uint64_t offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+    thrust::system::detail::internal::shuffle_tile_gather(
+      bijection, m, offset_to_first, offset_to_last, first, result + offsets[interval_idx]);
+  }
+};
+
+} // end namespace shuffle_detail
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  // the bijection draws from g exactly as the generic shuffle_copy does, so both permute alike
+  const std::uint64_t m = thrust::distance(first, last);
+  const shuffle_detail::bijection_type bijection(m, g);
+  const std::uint64_t n = bijection.nearest_power_of_two();
+
+  const std::uint64_t interval_size = intervals_detail::interval_size(n);
+  const std::uint64_t num_intervals = intervals_detail::divide_ri(n, interval_size);
+
+  if (num_intervals <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::system::detail::internal::shuffle_tile_gather(bijection, m, 0, n, first, result);
+    return;
+  }
+
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> offsets(0, exec, num_intervals);
+  std::uint64_t* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(::tbb::blocked_range<std::uint64_t>(0, num_intervals, 1),
+                      shuffle_detail::count_body{bijection, m, offsets_ptr, n, interval_size},
+                      ::tbb::simple_partitioner());
+
+  thrust::system::detail::internal::accumulate_tile_counts(offsets_ptr, num_intervals);
+
+  ::tbb::parallel_for(::tbb::blocked_range<std::uint64_t>(0, num_intervals, 1),
+                      shuffle_detail::gather_body<RandomIterator, OutputIterator>{
+                        bijection, m, first, result, offsets_ptr, n, interval_size},
+                      ::tbb::simple_partitioner());
+} // end shuffle_copy()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -32,7 +32,14 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/radix_sort.h>
 
+#include <cassert>
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -256,15 +263,313 @@ void merge_sort_by_key(
 
 } // namespace sort_by_key_detail
 
+namespace radix_sort_detail
+{
+
+// the smallest tile a radix sort pass hands to a task
+const static int tile_granularity = 16 * 1024;
+
+template <typename Iterator, typename Size, typename Digit>
+struct count_body
+{
+  Iterator keys;
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp;
+  Digit digit;
+  Size* counts;
+
+  count_body(Iterator keys,
+             const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+             Digit digit,
+             Size* counts)
+      : keys(keys)
+      , decomp(decomp)
+      , digit(digit)
+      , counts(counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size tile = r.begin();
+
+    thrust::system::detail::internal::radix_sort_tile_count(
+      keys,
+      decomp[tile].begin(),
+      decomp[tile].end(),
+      digit,
+      counts + tile * thrust::system::detail::internal::radix_sort_num_buckets);
+  }
+};
+
+template <typename Iterator1, typename Iterator2, typename Size, typename Digit>
+struct scatter_body
+{
+  Iterator1 keys;
+  Iterator2 keys_result;
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp;
+  Digit digit;
+  Size* offsets;
+
+  scatter_body(Iterator1 keys,
+               Iterator2 keys_result,
+               const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+               Digit digit,
+               Size* offsets)
+      : keys(keys)
+      , keys_result(keys_result)
+      , decomp(decomp)
+      , digit(digit)
+      , offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size tile = r.begin();
+
+    thrust::system::detail::internal::radix_sort_tile_scatter(
+      keys,
+      keys_result,
+      decomp[tile].begin(),
+      decomp[tile].end(),
+      digit,
+      offsets + tile * thrust::system::detail::internal::radix_sort_num_buckets);
+  }
+};
+
+template <typename Iterator1, typename Iterator2, typename Iterator3, typename Iterator4, typename Size, typename Digit>
+struct scatter_by_key_body
+{
+  Iterator1 keys;
+  Iterator2 values;
+  Iterator3 keys_result;
+  Iterator4 values_result;
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp;
+  Digit digit;
+  Size* offsets;
+
+  scatter_by_key_body(
+    Iterator1 keys,
+    Iterator2 values,
+    Iterator3 keys_result,
+    Iterator4 values_result,
+    const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+    Digit digit,
+    Size* offsets)
+      : keys(keys)
+      , values(values)
+      , keys_result(keys_result)
+      , values_result(values_result)
+      , decomp(decomp)
+      , digit(digit)
+      , offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    assert(r.size() == 1);
+
+    const Size tile = r.begin();
+
+    thrust::system::detail::internal::radix_sort_by_key_tile_scatter(
+      keys,
+      values,
+      keys_result,
+      values_result,
+      decomp[tile].begin(),
+      decomp[tile].end(),
+      digit,
+      offsets + tile * thrust::system::detail::internal::radix_sort_num_buckets);
+  }
+};
+
+template <typename Size>
+thrust::system::detail::internal::uniform_decomposition<Size> decompose(Size n)
+{
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  return thrust::system::detail::internal::uniform_decomposition<Size>(n, tile_granularity, p);
+}
+
+// counts the digits of every tile and turns the counts into offsets, returns false if the pass can be skipped
+template <typename Iterator, typename Size, typename Digit>
+bool count_digits(Iterator keys,
+                  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+                  Size n,
+                  Digit digit,
+                  Size* counts)
+{
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, decomp.size(), 1),
+                      count_body<Iterator, Size, Digit>(keys, decomp, digit, counts),
+                      ::tbb::simple_partitioner());
+
+  return thrust::system::detail::internal::radix_sort_scan_counts(counts, decomp.size(), n);
+}
+
+template <typename Iterator1, typename Iterator2, typename Size, typename Digit>
+bool pass(Iterator1 keys,
+          Iterator2 keys_result,
+          const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+          Size n,
+          Digit digit,
+          Size* counts)
+{
+  if (!count_digits(keys, decomp, n, digit, counts))
+  {
+    return false;
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, decomp.size(), 1),
+                      scatter_body<Iterator1, Iterator2, Size, Digit>(keys, keys_result, decomp, digit, counts),
+                      ::tbb::simple_partitioner());
+
+  return true;
+}
+
+template <typename Iterator1, typename Iterator2, typename Iterator3, typename Iterator4, typename Size, typename Digit>
+bool pass_by_key(
+  Iterator1 keys,
+  Iterator2 values,
+  Iterator3 keys_result,
+  Iterator4 values_result,
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+  Size n,
+  Digit digit,
+  Size* counts)
+{
+  if (!count_digits(keys, decomp, n, digit, counts))
+  {
+    return false;
+  }
+
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<Size>(0, decomp.size(), 1),
+    scatter_by_key_body<Iterator1, Iterator2, Iterator3, Iterator4, Size, Digit>(
+      keys, values, keys_result, values_result, decomp, digit, counts),
+    ::tbb::simple_partitioner());
+
+  return true;
+}
+
+// LSD radix sort of arithmetic keys, every pass ping-pongs between the input and a temporary buffer
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+void radix_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering)
+{
+  using size_type  = typename thrust::iterator_difference<RandomAccessIterator>::type;
+  using key_type   = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using digit_type = typename thrust::system::detail::internal::radix_digit_for<key_type, StrictWeakOrdering>::type;
+
+  using thrust::system::detail::internal::radix_sort_num_buckets;
+  using thrust::system::detail::internal::radix_sort_num_passes;
+
+  const size_type n = thrust::distance(first, last);
+
+  const thrust::system::detail::internal::uniform_decomposition<size_type> decomp = decompose(n);
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> buffer(exec, n);
+  thrust::detail::temporary_array<size_type, DerivedPolicy> counts(exec, decomp.size() * radix_sort_num_buckets);
+
+  size_type* counts_ptr = thrust::raw_pointer_cast(counts.data());
+
+  bool in_buffer = false;
+
+  for (unsigned int i = 0; i < radix_sort_num_passes<key_type>::value; ++i)
+  {
+    const digit_type digit(i);
+
+    const bool moved = in_buffer ? pass(buffer.begin(), first, decomp, n, digit, counts_ptr)
+                                 : pass(first, buffer.begin(), decomp, n, digit, counts_ptr);
+
+    in_buffer = in_buffer != moved;
+  }
+
+  if (in_buffer)
+  {
+    thrust::copy(exec, buffer.begin(), buffer.end(), first);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void radix_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering)
+{
+  using size_type  = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using key_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using val_type   = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using digit_type = typename thrust::system::detail::internal::radix_digit_for<key_type, StrictWeakOrdering>::type;
+
+  using thrust::system::detail::internal::radix_sort_num_buckets;
+  using thrust::system::detail::internal::radix_sort_num_passes;
+
+  const size_type n = thrust::distance(first1, last1);
+
+  const thrust::system::detail::internal::uniform_decomposition<size_type> decomp = decompose(n);
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys_buffer(exec, n);
+  thrust::detail::temporary_array<val_type, DerivedPolicy> values_buffer(exec, n);
+  thrust::detail::temporary_array<size_type, DerivedPolicy> counts(exec, decomp.size() * radix_sort_num_buckets);
+
+  size_type* counts_ptr = thrust::raw_pointer_cast(counts.data());
+
+  bool in_buffer = false;
+
+  for (unsigned int i = 0; i < radix_sort_num_passes<key_type>::value; ++i)
+  {
+    const digit_type digit(i);
+
+    const bool moved =
+      in_buffer
+        ? pass_by_key(keys_buffer.begin(), values_buffer.begin(), first1, first2, decomp, n, digit, counts_ptr)
+        : pass_by_key(first1, first2, keys_buffer.begin(), values_buffer.begin(), decomp, n, digit, counts_ptr);
+
+    in_buffer = in_buffer != moved;
+  }
+
+  if (in_buffer)
+  {
+    thrust::copy(exec, keys_buffer.begin(), keys_buffer.end(), first1);
+    thrust::copy(exec, values_buffer.begin(), values_buffer.end(), first2);
+  }
+}
+
+} // namespace radix_sort_detail
+
+namespace sort_detail
+{
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
+  radix_sort_detail::radix_sort(exec, first, last, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
   using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  merge_sort(exec, first, last, temp.begin(), comp, true);
 }
 
 template <typename DerivedPolicy,
@@ -276,7 +581,23 @@ void stable_sort_by_key(
   RandomAccessIterator1 first1,
   RandomAccessIterator1 last1,
   RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  radix_sort_detail::radix_sort_by_key(exec, first1, last1, first2, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
   using val_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
@@ -289,6 +610,35 @@ void stable_sort_by_key(
   sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
 }
 
+} // end namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  thrust::system::detail::internal::use_radix_sort<key_type, StrictWeakOrdering> use_radix_sort;
+  sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  thrust::system::detail::internal::use_radix_sort<key_type, StrictWeakOrdering> use_radix_sort;
+  sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);
+}
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
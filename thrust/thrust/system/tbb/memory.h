@@ -91,6 +91,21 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<T, thrust::
 template <typename T>
 using universal_host_pinned_allocator =
   thrust::mr::stateless_resource_allocator<T, thrust::system::tbb::universal_host_pinned_memory_resource>;
+
+/*! \p tbb::first_touch_allocator allocates memory for the \p tbb system whose pages are placed on the NUMA nodes of
+ *  the threads that process them, see \p tbb::first_touch_memory_resource. Use it as the allocator of
+ *  <tt>tbb::vector</tt> for bandwidth bound algorithms on multi-socket machines.
+ */
+template <typename T>
+using first_touch_allocator =
+  thrust::mr::stateless_resource_allocator<T, thrust::system::tbb::first_touch_memory_resource>;
+
+/*! \p tbb::interleaved_allocator allocates memory for the \p tbb system whose pages are interleaved over all NUMA
+ *  nodes, see \p tbb::interleaved_memory_resource.
+ */
+template <typename T>
+using interleaved_allocator =
+  thrust::mr::stateless_resource_allocator<T, thrust::system::tbb::interleaved_memory_resource>;
 } // namespace tbb
 } // namespace system
 
@@ -100,7 +115,9 @@ using universal_host_pinned_allocator =
 namespace tbb
 {
 using thrust::system::tbb::allocator;
+using thrust::system::tbb::first_touch_allocator;
 using thrust::system::tbb::free;
+using thrust::system::tbb::interleaved_allocator;
 using thrust::system::tbb::malloc;
 using thrust::system::tbb::universal_allocator;
 using thrust::system::tbb::universal_host_pinned_allocator;
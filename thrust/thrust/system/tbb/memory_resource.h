@@ -31,6 +31,8 @@
 #endif // no system header
 #include <thrust/mr/fancy_pointer_resource.h>
 #include <thrust/mr/new.h>
+#include <thrust/mr/numa.h>
+#include <thrust/system/tbb/detail/first_touch.h>
 #include <thrust/system/tbb/pointer.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -46,6 +48,14 @@ using native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::new_delet
 
 using universal_native_resource =
   thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::tbb::universal_pointer<void>>;
+
+using first_touch_native_resource =
+  thrust::mr::fancy_pointer_resource<thrust::mr::numa_resource<first_touch_pages, thrust::mr::numa_policy::first_touch>,
+                                     thrust::tbb::pointer<void>>;
+
+using interleaved_native_resource =
+  thrust::mr::fancy_pointer_resource<thrust::mr::numa_resource<first_touch_pages, thrust::mr::numa_policy::interleave>,
+                                     thrust::tbb::pointer<void>>;
 } // namespace detail
 //! \endcond
 
@@ -65,6 +75,16 @@ using universal_memory_resource = detail::universal_native_resource;
 // FIXME(bgruber): comment below is wrong or alias should be to universal_memory_resource
 /*! An alias for \p tbb::universal_memory_resource. */
 using universal_host_pinned_memory_resource = detail::native_resource;
+/*! A memory resource for the TBB system that backs the pages of large allocations with memory of the NUMA node of
+ *  the thread that the static decomposition of the TBB algorithms assigns them to. Uses \p mr::numa_resource
+ *  and tags it with \p tbb::pointer.
+ */
+using first_touch_memory_resource = detail::first_touch_native_resource;
+/*! A memory resource for the TBB system that interleaves the pages of large allocations over all NUMA nodes,
+ *  or places them like \p tbb::first_touch_memory_resource where interleaving is not available. Uses
+ *  \p mr::numa_resource and tags it with \p tbb::pointer.
+ */
+using interleaved_memory_resource = detail::interleaved_native_resource;
 
 /*! \} // memory_resources
  */